@@ -0,0 +1,411 @@
+/* alloc_replay.c -- replays an allocation trace through candidate allocators
+ *
+ * Reads a trace written by alloc_trace, puts the records of all threads back
+ * in the order they happened and matches every free and realloc to the block
+ * it gives back. The calls then run on one thread through each allocator, in
+ * a child process of its own so none inherits another's heap. Every block gets
+ * a byte written per page so it counts toward RSS the way the game's would.
+ *
+ * Reported per allocator: calls per second, peak RSS over the child's starting
+ * point, and fragmentation as that RSS against the peak of live bytes asked for.
+ *
+ * usage: alloc_replay [-v] [-a libc|slab] trace.bin
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "alloc_trace.h"
+#include "slab.h"
+
+#define NO_BLOCK 0xffffffff
+
+// A traced call with its pointers turned into block numbers
+typedef struct {
+	uint8_t op;
+	uint32_t size;
+	uint32_t align;
+	uint32_t block; // the one it returns, NO_BLOCK for a free
+	uint32_t old_block; // the one it gives back, NO_BLOCK if none
+} replay_op;
+
+typedef struct {
+	const char *name;
+	void (*init)(void);
+	void *(*malloc)(size_t size);
+	void *(*calloc)(size_t num, size_t size);
+	void *(*memalign)(size_t align, size_t size);
+	void *(*realloc)(void *ptr, size_t size);
+	void (*free)(void *ptr);
+} allocator;
+
+typedef struct {
+	uint64_t us;
+	long base_rss, peak_rss; // KB
+	int failed;
+} replay_result;
+
+static void libc_init(void) {
+}
+
+// The wrappers in main.c, with libc standing in for vitaGL
+static void *slab_malloc(size_t size) {
+	void *ptr = slab_alloc(size);
+	return ptr ? ptr : malloc(size);
+}
+
+static void *slab_calloc(size_t num, size_t size) {
+	uint64_t total = (uint64_t)num * size;
+	void *ptr = total <= SLAB_MAX ? slab_alloc(total) : NULL;
+	if (ptr)
+		memset(ptr, 0, total);
+	else
+		ptr = calloc(num, size);
+	return ptr;
+}
+
+static void *slab_memalign(size_t align, size_t size) {
+	void *ptr = align <= SLAB_ALIGN ? slab_alloc(size) : NULL;
+	return ptr ? ptr : memalign(align, size);
+}
+
+static void *slab_realloc(void *ptr, size_t size) {
+	size_t old_size = ptr ? slab_usable_size(ptr) : 0;
+	if (!ptr)
+		return slab_malloc(size);
+	if (!old_size)
+		return realloc(ptr, size);
+	if (size <= old_size)
+		return ptr;
+	void *new_ptr = slab_malloc(size);
+	if (new_ptr) {
+		memcpy(new_ptr, ptr, old_size);
+		slab_free(ptr);
+	}
+	return new_ptr;
+}
+
+static void slab_free_any(void *ptr) {
+	if (ptr && !slab_free(ptr))
+		free(ptr);
+}
+
+static const allocator allocators[] = {
+	{ "libc", libc_init, malloc, calloc, memalign, realloc, free },
+	{ "slab", slab_init, slab_malloc, slab_calloc, slab_memalign, slab_realloc, slab_free_any },
+};
+
+static struct {
+	replay_op *ops;
+	uint32_t num_ops, num_blocks;
+	uint32_t num_threads, unmatched, leaked;
+	uint64_t peak_live;
+} trace;
+
+static alloc_trace_record *read_trace(const char *path, uint32_t *num_records) {
+	FILE *f = fopen(path, "rb");
+	if (!f)
+		return NULL;
+
+	alloc_trace_header hdr;
+	if (fread(&hdr, sizeof(hdr), 1, f) != 1 || hdr.magic != ALLOC_TRACE_MAGIC || hdr.version != ALLOC_TRACE_VERSION ||
+		hdr.record_size != sizeof(alloc_trace_record)) {
+		fprintf(stderr, "alloc_replay: %s isn't a version %d trace\n", path, ALLOC_TRACE_VERSION);
+		fclose(f);
+		return NULL;
+	}
+
+	fseek(f, 0, SEEK_END);
+	long bytes = ftell(f) - sizeof(hdr);
+	fseek(f, sizeof(hdr), SEEK_SET);
+	*num_records = bytes / sizeof(alloc_trace_record);
+	alloc_trace_record *records = malloc(*num_records * sizeof(alloc_trace_record) + 1);
+	if (records && fread(records, sizeof(alloc_trace_record), *num_records, f) != *num_records) {
+		free(records);
+		records = NULL;
+	}
+	fclose(f);
+	return records;
+}
+
+static const alloc_trace_record *sort_base;
+
+// By time, and in file order within the same microsecond, which keeps each thread's own order
+static int by_time(const void *a, const void *b) {
+	uint32_t i = *(const uint32_t *)a, j = *(const uint32_t *)b;
+	if (sort_base[i].time != sort_base[j].time)
+		return sort_base[i].time < sort_base[j].time ? -1 : 1;
+	return i < j ? -1 : i > j;
+}
+
+/*
+ * live_map: traced pointer to the block living there, open addressing with
+ * linear probing. Kept out of the heap the replays measure.
+ */
+typedef struct {
+	uint32_t ptr;
+	uint32_t block;
+} live_entry;
+
+typedef struct {
+	live_entry *entries;
+	uint32_t mask;
+} live_map;
+
+static live_entry *live_find(live_map *m, uint32_t ptr) {
+	uint32_t i = (ptr >> 4) * 0x9e3779b1 & m->mask;
+	while (m->entries[i].ptr && m->entries[i].ptr != ptr)
+		i = (i + 1) & m->mask;
+	return &m->entries[i];
+}
+
+// Backward shift, so lookups never need tombstones
+static void live_remove(live_map *m, live_entry *e) {
+	uint32_t i = e - m->entries;
+	for (uint32_t j = (i + 1) & m->mask; m->entries[j].ptr; j = (j + 1) & m->mask) {
+		uint32_t home = (m->entries[j].ptr >> 4) * 0x9e3779b1 & m->mask;
+		if (((j - home) & m->mask) >= ((j - i) & m->mask)) {
+			m->entries[i] = m->entries[j];
+			i = j;
+		}
+	}
+	m->entries[i].ptr = 0;
+}
+
+static int build_ops(alloc_trace_record *records, uint32_t num_records) {
+	uint32_t *order = malloc(num_records * sizeof(uint32_t) + 1);
+	trace.ops = malloc(num_records * sizeof(replay_op) + 1);
+	uint32_t *sizes = malloc(num_records * sizeof(uint32_t) + 1);
+	live_map live;
+	live.mask = 1;
+	while (live.mask < num_records * 2)
+		live.mask <<= 1;
+	size_t map_bytes = (live.mask + 1) * sizeof(live_entry);
+	live.entries = mmap(NULL, map_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	live.mask--;
+	if (!order || !trace.ops || !sizes || live.entries == MAP_FAILED)
+		return -1;
+
+	for (uint32_t i = 0; i < num_records; i++)
+		order[i] = i;
+	sort_base = records;
+	qsort(order, num_records, sizeof(uint32_t), by_time);
+
+	uint64_t live_bytes = 0;
+	for (uint32_t i = 0; i < num_records; i++) {
+		const alloc_trace_record *rec = &records[order[i]];
+		replay_op op = { rec->op, rec->size, 0, NO_BLOCK, NO_BLOCK };
+		uint32_t old_ptr = 0;
+
+		// Failed on the Vita, and a failed realloc kept the old block
+		if (rec->op != ALLOC_TRACE_THREAD && rec->op != ALLOC_TRACE_FREE && !rec->ptr)
+			continue;
+
+		switch (rec->op) {
+		case ALLOC_TRACE_THREAD:
+			trace.num_threads++;
+			continue;
+		case ALLOC_TRACE_MEMALIGN:
+			op.align = rec->aux;
+			break;
+		case ALLOC_TRACE_REALLOC:
+			old_ptr = rec->aux;
+			break;
+		case ALLOC_TRACE_FREE:
+			old_ptr = rec->ptr;
+			break;
+		case ALLOC_TRACE_MALLOC:
+		case ALLOC_TRACE_CALLOC:
+			break;
+		default:
+			fprintf(stderr, "alloc_replay: unknown op %d\n", rec->op);
+			return -1;
+		}
+
+		// Blocks from before the trace started, or whose records got dropped, can't be replayed
+		if (old_ptr) {
+			live_entry *e = live_find(&live, old_ptr);
+			if (!e->ptr) {
+				trace.unmatched++;
+				if (rec->op == ALLOC_TRACE_FREE)
+					continue;
+			} else {
+				op.old_block = e->block;
+				live_bytes -= sizes[e->block];
+				live_remove(&live, e);
+			}
+		} else if (rec->op == ALLOC_TRACE_FREE) {
+			continue;
+		}
+
+		if (rec->op != ALLOC_TRACE_FREE) {
+			live_entry *e = live_find(&live, rec->ptr);
+			if (e->ptr) {
+				trace.leaked++; // its free went missing, it stays allocated
+				live_remove(&live, e);
+				e = live_find(&live, rec->ptr);
+			}
+			op.block = trace.num_blocks++;
+			sizes[op.block] = rec->size;
+			e->ptr = rec->ptr;
+			e->block = op.block;
+			live_bytes += rec->size;
+			if (live_bytes > trace.peak_live)
+				trace.peak_live = live_bytes;
+		}
+		trace.ops[trace.num_ops++] = op;
+	}
+
+	munmap(live.entries, map_bytes);
+	free(order);
+	free(sizes);
+	return 0;
+}
+
+// One byte per page, as the game would have used them
+static void touch(uint8_t *p, uint32_t size) {
+	for (uint32_t i = 0; i < size; i += 4096)
+		p[i] = 1;
+	if (size)
+		p[size - 1] = 1;
+}
+
+static void replay(const allocator *a, void **blocks, replay_result *res) {
+	struct rusage usage;
+
+	a->init();
+	memset(blocks, 0, trace.num_blocks * sizeof(void *)); // resident before the baseline
+	getrusage(RUSAGE_SELF, &usage);
+	res->base_rss = usage.ru_maxrss;
+
+	uint64_t start = host_time();
+	for (uint32_t i = 0; i < trace.num_ops; i++) {
+		const replay_op *op = &trace.ops[i];
+		void *old = op->old_block != NO_BLOCK ? blocks[op->old_block] : NULL;
+		void *p;
+
+		switch (op->op) {
+		case ALLOC_TRACE_MALLOC:
+			p = a->malloc(op->size);
+			break;
+		case ALLOC_TRACE_CALLOC:
+			p = a->calloc(1, op->size);
+			break;
+		case ALLOC_TRACE_MEMALIGN:
+			p = a->memalign(op->align, op->size);
+			break;
+		case ALLOC_TRACE_REALLOC:
+			p = a->realloc(old, op->size);
+			break;
+		default:
+			a->free(old);
+			continue;
+		}
+		if (!p && op->size) {
+			res->failed = 1;
+			return;
+		}
+		touch(p, op->size);
+		blocks[op->block] = p;
+	}
+	res->us = host_time() - start;
+
+	getrusage(RUSAGE_SELF, &usage);
+	res->peak_rss = usage.ru_maxrss;
+}
+
+// In a child, so every allocator starts from the same clean heap
+static int run(const allocator *a, replay_result *res) {
+	void **blocks = calloc(trace.num_blocks + 1, sizeof(void *));
+	if (!blocks)
+		return -1;
+	memset(res, 0, sizeof(*res));
+
+	pid_t pid = fork();
+	if (pid < 0) {
+		free(blocks);
+		return -1;
+	}
+	if (pid == 0) {
+		replay(a, blocks, res);
+		_exit(0);
+	}
+
+	int status;
+	waitpid(pid, &status, 0);
+	free(blocks);
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || res->failed)
+		return -1;
+	return 0;
+}
+
+int main(int argc, char *argv[]) {
+	const char *only = NULL, *path = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-v"))
+			verbose = 1;
+		else if (!strcmp(argv[i], "-a") && i + 1 < argc)
+			only = argv[++i];
+		else if (argv[i][0] != '-' && i == argc - 1)
+			path = argv[i];
+		else
+			break;
+	}
+	if (!path) {
+		fprintf(stderr, "usage: %s [-v] [-a libc|slab] trace.bin\n", argv[0]);
+		return 1;
+	}
+
+	uint32_t num_records;
+	alloc_trace_record *records = read_trace(path, &num_records);
+	if (!records) {
+		fprintf(stderr, "alloc_replay: can't read %s\n", path);
+		return 1;
+	}
+	if (build_ops(records, num_records) < 0) {
+		fprintf(stderr, "alloc_replay: can't prepare %u records\n", num_records);
+		return 1;
+	}
+	free(records);
+
+	printf("%s: %u calls from %u threads, %u blocks, %llu KB live at peak\n", path, trace.num_ops, trace.num_threads,
+		trace.num_blocks, (unsigned long long)trace.peak_live / 1024);
+	if (trace.unmatched || trace.leaked)
+		printf("%u frees of blocks from outside the trace, %u blocks never freed\n", trace.unmatched, trace.leaked);
+
+	replay_result *res = mmap(NULL, sizeof(replay_result), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (res == MAP_FAILED)
+		return 1;
+
+	int ran = 0, failed = 0;
+	for (int i = 0; i < sizeof(allocators) / sizeof(*allocators); i++) {
+		const allocator *a = &allocators[i];
+		if (only && strcmp(only, a->name))
+			continue;
+		ran++;
+		if (run(a, res) < 0) {
+			fprintf(stderr, "alloc_replay: %s failed\n", a->name);
+			failed++;
+			continue;
+		}
+
+		long rss = res->peak_rss - res->base_rss;
+		printf("%-5s %10.0f calls/s, peak RSS +%ld KB, %.2fx the live bytes\n", a->name,
+			res->us ? trace.num_ops * 1e6 / res->us : 0.0, rss, trace.peak_live ? rss * 1024.0 / trace.peak_live : 0.0);
+	}
+	if (!ran) {
+		fprintf(stderr, "alloc_replay: no allocator called %s\n", only);
+		return 1;
+	}
+	return failed ? 1 : 0;
+}
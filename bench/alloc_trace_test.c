@@ -0,0 +1,213 @@
+/* alloc_trace_test.c -- what alloc_trace writes against what the threads did
+ *
+ * Two waves of threads allocate and free through libc and log every call the
+ * way the malloc wrappers do, keeping their own copy of what they logged. The
+ * second wave starts once the flusher has drained and freed the first wave's
+ * rings, so it reuses them. The file then has to hold exactly those calls:
+ * each ring slot opening with the thread it belongs to, every thread's calls
+ * in order and nothing from before the trace started or after it stopped.
+ * The trace stays behind for alloc_replay.
+ *
+ * usage: alloc_trace_test [-v] [-n ops per thread] [out.bin]
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+#include "host.h"
+#include "alloc_trace.h"
+
+#define WAVE 4
+#define LIVE 32
+#define MAX_OPS 3000 // calls per thread, with the frees at the end well under a ring
+
+typedef struct {
+	int id, num_ops;
+	SceUID thid;
+	alloc_trace_record *log;
+	int num_logged, num_checked;
+} worker;
+
+static void traced(worker *w, int op, void *ptr, uint32_t size, uint32_t aux) {
+	alloc_trace(op, ptr, size, aux);
+	w->log[w->num_logged++] = (alloc_trace_record){ .ptr = (uintptr_t)ptr, .size = size, .aux = aux, .op = op };
+}
+
+static void *worker_main(void *arg) {
+	worker *w = arg;
+	void *live[LIVE] = { NULL };
+	unsigned seed = w->id;
+
+	w->thid = sceKernelGetThreadId();
+	for (int i = 0; i < w->num_ops; i++) {
+		int slot = rand_r(&seed) % LIVE;
+		uint32_t size = rand_r(&seed) % 2000 + 1;
+		void *p = live[slot];
+		if (!p) {
+			switch (rand_r(&seed) % 3) {
+			case 0:
+				p = malloc(size);
+				traced(w, ALLOC_TRACE_MALLOC, p, size, 0);
+				break;
+			case 1:
+				p = calloc(2, size);
+				traced(w, ALLOC_TRACE_CALLOC, p, 2 * size, 0);
+				break;
+			default:
+				p = memalign(64, size);
+				traced(w, ALLOC_TRACE_MEMALIGN, p, size, 64);
+				break;
+			}
+		} else if (rand_r(&seed) % 4 == 0) {
+			p = realloc(p, size);
+			traced(w, ALLOC_TRACE_REALLOC, p, size, (uintptr_t)live[slot]);
+		} else {
+			traced(w, ALLOC_TRACE_FREE, p, 0, 0);
+			free(p);
+			p = NULL;
+		}
+		live[slot] = p;
+	}
+
+	for (int slot = 0; slot < LIVE; slot++) {
+		if (live[slot]) {
+			traced(w, ALLOC_TRACE_FREE, live[slot], 0, 0);
+			free(live[slot]);
+		}
+	}
+	alloc_trace_thread_exit();
+	return NULL;
+}
+
+static void run_wave(worker *workers) {
+	pthread_t threads[WAVE];
+	for (int i = 0; i < WAVE; i++) {
+		if (pthread_create(&threads[i], NULL, worker_main, &workers[i]) != 0) {
+			fprintf(stderr, "alloc_trace_test: pthread_create failed\n");
+			exit(1);
+		}
+	}
+	for (int i = 0; i < WAVE; i++)
+		pthread_join(threads[i], NULL);
+}
+
+static worker *find_worker(worker *workers, int n, SceUID thid) {
+	for (int i = 0; i < n; i++) {
+		if (workers[i].thid == thid)
+			return &workers[i];
+	}
+	return NULL;
+}
+
+static void check_trace(const char *path, worker *workers, int n) {
+	FILE *f = fopen(path, "rb");
+	if (!f) {
+		fprintf(stderr, "alloc_trace_test: can't open %s\n", path);
+		host_failures++;
+		return;
+	}
+
+	alloc_trace_header hdr;
+	CHECK(fread(&hdr, sizeof(hdr), 1, f) == 1);
+	CHECK(hdr.magic == ALLOC_TRACE_MAGIC && hdr.version == ALLOC_TRACE_VERSION);
+	CHECK(hdr.record_size == sizeof(alloc_trace_record));
+
+	worker *owner[64] = { NULL };
+	uint32_t last_time[64] = { 0 };
+	int slot_owners[64] = { 0 };
+	int mismatches = 0, strays = 0, num_records = 0;
+	alloc_trace_record rec;
+
+	while (fread(&rec, sizeof(rec), 1, f) == 1) {
+		num_records++;
+		if (rec.thread >= 64) {
+			strays++;
+			continue;
+		}
+		if (rec.op == ALLOC_TRACE_THREAD) {
+			owner[rec.thread] = find_worker(workers, n, rec.ptr);
+			slot_owners[rec.thread]++;
+			if (!owner[rec.thread])
+				strays++;
+		} else {
+			worker *w = owner[rec.thread];
+			if (!w || w->num_checked == w->num_logged) {
+				strays++;
+				continue;
+			}
+			alloc_trace_record *want = &w->log[w->num_checked++];
+			if (rec.op != want->op || rec.ptr != want->ptr || rec.size != want->size || rec.aux != want->aux)
+				mismatches++;
+		}
+		if (rec.time < last_time[rec.thread])
+			mismatches++;
+		last_time[rec.thread] = rec.time;
+	}
+	fclose(f);
+
+	int expected = 0, reused = 0;
+	for (int i = 0; i < n; i++) {
+		CHECK(workers[i].num_checked == workers[i].num_logged);
+		expected += workers[i].num_logged + 1;
+	}
+	for (int i = 0; i < 64; i++)
+		reused += slot_owners[i] > 1;
+	if (verbose)
+		printf("%d records, %d slots reused, %d mismatched, %d strays\n", num_records, reused, mismatches, strays);
+	CHECK(num_records == expected);
+	CHECK(mismatches == 0 && strays == 0);
+	CHECK(reused > 0); // the second wave got the first wave's drained rings
+}
+
+int main(int argc, char *argv[]) {
+	const char *path = "allocs.bin";
+	int num_ops = 2000;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-v"))
+			verbose = 1;
+		else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			num_ops = atoi(argv[++i]);
+		else if (argv[i][0] != '-' && i == argc - 1)
+			path = argv[i];
+		else {
+			fprintf(stderr, "usage: %s [-v] [-n ops per thread] [out.bin]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (num_ops <= 0 || num_ops > MAX_OPS)
+		return 1;
+
+	worker workers[2 * WAVE];
+	for (int i = 0; i < 2 * WAVE; i++) {
+		workers[i] = (worker){ .id = i + 1, .num_ops = num_ops };
+		workers[i].log = malloc((num_ops + LIVE) * sizeof(alloc_trace_record));
+	}
+
+	alloc_trace(ALLOC_TRACE_MALLOC, (void *)0x1000, 16, 0); // not started, goes nowhere
+	if (alloc_trace_start(path) < 0) {
+		fprintf(stderr, "alloc_trace_test: can't write %s\n", path);
+		return 1;
+	}
+	uint64_t start = host_time();
+	run_wave(workers);
+	usleep(300 * 1000); // a few flushes, so the rings are drained and free again
+	run_wave(workers + WAVE);
+	alloc_trace_stop();
+	alloc_trace(ALLOC_TRACE_FREE, (void *)0x1000, 0, 0); // stopped
+	uint64_t us = host_time() - start;
+
+	check_trace(path, workers, 2 * WAVE);
+	printf("%d threads, %d calls each, traced in %llu us\n", 2 * WAVE, num_ops, (unsigned long long)us);
+
+	for (int i = 0; i < 2 * WAVE; i++)
+		free(workers[i].log);
+
+	return host_report("alloc_trace_test");
+}
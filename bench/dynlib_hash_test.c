@@ -0,0 +1,116 @@
+/* dynlib_hash_test.c -- precomputed import hashes against so_gnu_hash
+ *
+ * default_dynlib's hashes come from two places that never run so_gnu_hash:
+ * default_dynlib_hashes.h, generated from main.c by gen_dynlib_hashes.cmake,
+ * and SO_GNU_HASH folding literals at compile time. Both have to agree with it
+ * for every name, or the import index would silently miss entries.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "elf_gen.h"
+
+#define DYNLIB_HASH_NAMES
+#include "default_dynlib_hashes.h"
+
+#define NUM_GENERATED (sizeof(default_dynlib_hashes) / sizeof(*default_dynlib_hashes))
+
+// Static initializers, so these only build if the compiler folds them like main.c's tables need
+static const uint32_t folded[] = { SO_GNU_HASH(""), SO_GNU_HASH("abc"), SO_GNU_HASH("glPixelStorei") };
+
+#define LIT_63 "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_"
+#define LIT_64 LIT_63 "x"
+#define LIT_65 LIT_64 "y"
+
+static void check_literal(uint32_t hash, const char *s) {
+	uint32_t expected = so_gnu_hash((const uint8_t *)s);
+	if (hash != expected)
+		fprintf(stderr, "SO_GNU_HASH(\"%s\") = 0x%08x, so_gnu_hash 0x%08x\n", s, hash, expected);
+	CHECK(hash == expected);
+}
+
+#define CHECK_LITERAL(s) check_literal(SO_GNU_HASH(s), s)
+
+int main(int argc, char *argv[]) {
+	// Generated header: one entry per live default_dynlib line, in table order
+	CHECK(NUM_GENERATED > 100);
+	CHECK(sizeof(default_dynlib_names) / sizeof(*default_dynlib_names) == NUM_GENERATED);
+	for (int i = 0; i < NUM_GENERATED; i++) {
+		CHECK(default_dynlib_names[i][0] != '\0');
+		if (default_dynlib_hashes[i] != so_gnu_hash((const uint8_t *)default_dynlib_names[i])) {
+			fprintf(stderr, "default_dynlib_hashes[%d] (%s) is 0x%08x, so_gnu_hash 0x%08x\n", i, default_dynlib_names[i],
+				default_dynlib_hashes[i], so_gnu_hash((const uint8_t *)default_dynlib_names[i]));
+			host_failures++;
+		}
+	}
+
+	// Commented out lines in main.c mustn't end up in the table
+	for (int i = 0; i < NUM_GENERATED; i++)
+		CHECK(strchr(default_dynlib_names[i], '/') == NULL && strchr(default_dynlib_names[i], ' ') == NULL);
+
+	CHECK(folded[0] == 5381);
+	CHECK(folded[1] == 193485963);
+	CHECK(folded[2] == 0x6c1f6590);
+	CHECK_LITERAL("");
+	CHECK_LITERAL("a");
+	CHECK_LITERAL("<init>");
+	CHECK_LITERAL("getLanguage");
+	CHECK_LITERAL("__cxa_atexit");
+	CHECK_LITERAL("_ZNSt6__ndk16vectorIiNS_9allocatorIiEEE9push_backEOi");
+	CHECK_LITERAL("\xff\x80 high bytes");
+	CHECK_LITERAL(LIT_63);
+	CHECK_LITERAL(LIT_64);
+	// Too long to fold: 0, which lookups treat as "hash it yourself"
+	CHECK(SO_GNU_HASH(LIT_65) == 0);
+	CHECK(SO_GNU_HASH("_ZNSt6__ndk112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEE6appendEPKc") == 0);
+
+	// A table carrying the precomputed hashes resolves the same as one without
+	int n = NUM_GENERATED < 200 ? NUM_GENERATED : 200;
+	so_default_dynlib *with = calloc(n + 1, sizeof(so_default_dynlib));
+	so_default_dynlib *without = calloc(n + 1, sizeof(so_default_dynlib));
+	elf_gen *g = elf_gen_new("libhashed.so", ELF_GEN_GNU_HASH);
+	for (int i = 0; i < n; i++) {
+		// main.c has a few names twice, the first one wins
+		int first = 0;
+		while (strcmp(default_dynlib_names[first], default_dynlib_names[i]))
+			first++;
+		with[i].symbol = without[i].symbol = (char *)default_dynlib_names[i];
+		with[i].func = without[i].func = 0x20000000 + first * 4;
+		with[i].hash = default_dynlib_hashes[i];
+		elf_gen_import(g, default_dynlib_names[i], R_ARM_GLOB_DAT);
+	}
+	// A literal too long to fold sits in the table with hash 0
+	with[n].symbol = without[n].symbol = LIT_65;
+	with[n].func = without[n].func = 0x30000000;
+	with[n].hash = SO_GNU_HASH(LIT_65);
+	elf_gen_import(g, LIT_65, R_ARM_GLOB_DAT);
+
+	size_t size;
+	void *image = elf_gen_image(g, &size);
+	elf_gen_free(g);
+
+	so_module mod;
+	int loaded = image && host_so_mem_load(&mod, image, size) == 0;
+	CHECK(loaded);
+	if (loaded) {
+		uintptr_t *got = (uintptr_t *)(mod.text_base + ELF_GEN_GOT);
+		so_relocate(&mod);
+		so_resolve(&mod, with, (n + 1) * sizeof(so_default_dynlib), 1);
+		for (int i = 0; i <= n; i++)
+			CHECK(got[i] == with[i].func);
+		CHECK(mod.reloc_stats.unbound[SO_STAT_GLOB_DAT] == 0);
+
+		memset(got, 0, (n + 1) * sizeof(uintptr_t));
+		so_resolve(&mod, without, (n + 1) * sizeof(so_default_dynlib), 1);
+		for (int i = 0; i <= n; i++)
+			CHECK(got[i] == without[i].func);
+	}
+
+	return host_report("dynlib_hash_test");
+}
@@ -0,0 +1,594 @@
+/* elf_gen.c -- builds small ARM32 shared objects for the host tests
+ *
+ * Lays modules out the way the NDK linker does, as far as so_util cares: one
+ * read+exec PT_LOAD holding the headers, .text and the dynamic tables, then one
+ * read+write PT_LOAD with .got, .data and .dynamic. Section headers are always
+ * there since the loader finds everything through them. Exports are sorted by
+ * .gnu.hash bucket and imports come first, like a real .dynsym.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "elf.h"
+#include "elf_gen.h"
+
+#define GEN_ALIGN(x, align) (((x) + ((align) - 1)) & ~((align) - 1))
+#define GEN_PAGE 0x1000
+
+typedef struct {
+	uint8_t *data;
+	size_t size, cap;
+} gen_buf;
+
+typedef struct {
+	char *name;
+	uint32_t value, size;
+	uint8_t info;
+	int data; // lives in .data rather than .text
+	uint32_t hash, gnu_hash;
+} gen_sym;
+
+typedef struct {
+	uint32_t offset;
+	int type;
+	int sym; // index into imports, -1 for none
+} gen_rel;
+
+typedef struct {
+	uint32_t vaddr;
+	char kind;
+} gen_mapping;
+
+struct elf_gen {
+	int flags;
+	char *soname;
+	gen_buf text, data;
+	gen_sym *imports, *exports;
+	int num_imports, num_exports;
+	gen_rel *rels;
+	int num_rels;
+	uint32_t num_got;
+	gen_mapping *mapping;
+	int num_mapping;
+	char **needed;
+	int num_needed;
+};
+
+static void *gen_grow(void *ptr, int n, size_t elem) {
+	// Doubles at every power of two, so appending one at a time stays linear
+	if (n & (n - 1))
+		return ptr;
+	void *p = realloc(ptr, (n ? 2 * n : 1) * elem);
+	if (!p) {
+		fprintf(stderr, "elf_gen: out of memory\n");
+		exit(1);
+	}
+	return p;
+}
+
+static size_t buf_put(gen_buf *b, const void *data, size_t size) {
+	size_t at = b->size;
+	if (b->size + size > b->cap) {
+		b->cap = GEN_ALIGN(b->size + size, 0x1000) * 2;
+		b->data = realloc(b->data, b->cap);
+		if (!b->data) {
+			fprintf(stderr, "elf_gen: out of memory\n");
+			exit(1);
+		}
+	}
+	if (data)
+		memcpy(b->data + at, data, size);
+	else
+		memset(b->data + at, 0, size);
+	b->size += size;
+	return at;
+}
+
+static void buf_align(gen_buf *b, size_t align) {
+	buf_put(b, NULL, GEN_ALIGN(b->size, align) - b->size);
+}
+
+static size_t buf_str(gen_buf *b, const char *s) {
+	return buf_put(b, s, strlen(s) + 1);
+}
+
+static uint32_t gen_hash(const char *name) {
+	uint32_t h = 0, g;
+	for (const uint8_t *p = (const uint8_t *)name; *p; p++) {
+		h = (h << 4) + *p;
+		g = h & 0xf0000000;
+		if (g)
+			h ^= g >> 24;
+		h &= ~g;
+	}
+	return h;
+}
+
+static uint32_t gen_gnu_hash(const char *name) {
+	uint32_t h = 5381;
+	for (const uint8_t *p = (const uint8_t *)name; *p; p++)
+		h = h * 33 + *p;
+	return h;
+}
+
+elf_gen *elf_gen_new(const char *soname, int flags) {
+	elf_gen *g = calloc(1, sizeof(elf_gen));
+	if (!g)
+		return NULL;
+	g->flags = flags;
+	g->soname = strdup(soname);
+	return g;
+}
+
+void elf_gen_free(elf_gen *g) {
+	if (!g)
+		return;
+	for (int i = 0; i < g->num_imports; i++)
+		free(g->imports[i].name);
+	for (int i = 0; i < g->num_exports; i++)
+		free(g->exports[i].name);
+	for (int i = 0; i < g->num_needed; i++)
+		free(g->needed[i]);
+	free(g->imports);
+	free(g->exports);
+	free(g->rels);
+	free(g->mapping);
+	free(g->needed);
+	free(g->text.data);
+	free(g->data.data);
+	free(g->soname);
+	free(g);
+}
+
+uint32_t elf_gen_code(elf_gen *g, const void *code, size_t size, char kind) {
+	buf_align(&g->text, kind == 't' ? 2 : 4);
+	uint32_t vaddr = ELF_GEN_TEXT + g->text.size;
+
+	// Back to back runs of the same kind share one mapping symbol
+	if (!g->num_mapping || g->mapping[g->num_mapping - 1].kind != kind) {
+		g->mapping = gen_grow(g->mapping, g->num_mapping, sizeof(gen_mapping));
+		g->mapping[g->num_mapping].vaddr = vaddr;
+		g->mapping[g->num_mapping].kind = kind;
+		g->num_mapping++;
+	}
+
+	buf_put(&g->text, code, size);
+	return vaddr;
+}
+
+uint32_t elf_gen_data(elf_gen *g, const void *data, size_t size) {
+	buf_align(&g->data, 4);
+	return ELF_GEN_DATA + buf_put(&g->data, data, size);
+}
+
+static void gen_export(elf_gen *g, const char *name, uint32_t vaddr, uint32_t size, int bind, int type) {
+	g->exports = gen_grow(g->exports, g->num_exports, sizeof(gen_sym));
+	gen_sym *s = &g->exports[g->num_exports++];
+	memset(s, 0, sizeof(gen_sym));
+	s->name = strdup(name);
+	s->value = vaddr;
+	s->size = size;
+	s->info = ELF32_ST_INFO(bind, type);
+	s->data = type == STT_OBJECT;
+	s->hash = gen_hash(name);
+	s->gnu_hash = gen_gnu_hash(name);
+}
+
+void elf_gen_func(elf_gen *g, const char *name, uint32_t vaddr, uint32_t size, int bind) {
+	gen_export(g, name, vaddr, size, bind, STT_FUNC);
+}
+
+void elf_gen_object(elf_gen *g, const char *name, uint32_t vaddr, uint32_t size, int bind) {
+	gen_export(g, name, vaddr, size, bind, STT_OBJECT);
+}
+
+static void gen_rel_add(elf_gen *g, uint32_t offset, int type, int sym) {
+	g->rels = gen_grow(g->rels, g->num_rels, sizeof(gen_rel));
+	g->rels[g->num_rels].offset = offset;
+	g->rels[g->num_rels].type = type;
+	g->rels[g->num_rels].sym = sym;
+	g->num_rels++;
+}
+
+uint32_t elf_gen_import(elf_gen *g, const char *name, int type) {
+	int sym;
+	for (sym = 0; sym < g->num_imports; sym++) {
+		if (!strcmp(g->imports[sym].name, name))
+			break;
+	}
+	if (sym == g->num_imports) {
+		g->imports = gen_grow(g->imports, g->num_imports, sizeof(gen_sym));
+		gen_sym *s = &g->imports[g->num_imports++];
+		memset(s, 0, sizeof(gen_sym));
+		s->name = strdup(name);
+		s->info = ELF32_ST_INFO(STB_GLOBAL, type == R_ARM_JUMP_SLOT ? STT_FUNC : STT_NOTYPE);
+		s->hash = gen_hash(name);
+		s->gnu_hash = gen_gnu_hash(name);
+	}
+
+	uint32_t slot = ELF_GEN_GOT + 4 * g->num_got++;
+	gen_rel_add(g, slot, type, sym);
+	return slot;
+}
+
+void elf_gen_relative(elf_gen *g, uint32_t vaddr) {
+	gen_rel_add(g, vaddr, R_ARM_RELATIVE, -1);
+}
+
+void elf_gen_needed(elf_gen *g, const char *soname) {
+	g->needed = gen_grow(g->needed, g->num_needed, sizeof(char *));
+	g->needed[g->num_needed++] = strdup(soname);
+}
+
+static uint32_t gen_nbucket;
+
+static int gen_bucket_cmp(const void *a, const void *b) {
+	uint32_t ba = ((const gen_sym *)a)->gnu_hash % gen_nbucket, bb = ((const gen_sym *)b)->gnu_hash % gen_nbucket;
+	return ba < bb ? -1 : ba > bb;
+}
+
+enum {
+	SEC_NULL,
+	SEC_TEXT,
+	SEC_DYNSYM,
+	SEC_DYNSTR,
+	SEC_HASH,
+	SEC_GNU_HASH,
+	SEC_REL_DYN,
+	SEC_REL_PLT,
+	SEC_GOT,
+	SEC_DATA,
+	SEC_DYNAMIC,
+	SEC_SYMTAB,
+	SEC_STRTAB,
+	SEC_SHSTRTAB,
+	SEC_NUM
+};
+
+static const char *sec_names[SEC_NUM] = {
+	"", ".text", ".dynsym", ".dynstr", ".hash", ".gnu.hash", ".rel.dyn", ".rel.plt",
+	".got", ".data", ".dynamic", ".symtab", ".strtab", ".shstrtab"
+};
+
+static void gen_sym_put(gen_buf *b, uint32_t name, const gen_sym *s, int shndx) {
+	Elf32_Sym sym = { 0 };
+	sym.st_name = name;
+	sym.st_value = s ? s->value : 0;
+	sym.st_size = s ? s->size : 0;
+	sym.st_info = s ? s->info : 0;
+	sym.st_shndx = shndx;
+	buf_put(b, &sym, sizeof(sym));
+}
+
+/*
+ * elf_gen_image: the RX segment is mapped from offset 0 so its file offsets and
+ * vaddrs match. The RW segment starts at ELF_GEN_GOT whatever the size of the RX
+ * one, which is why the addresses handed out while building stay valid.
+*/
+void *elf_gen_image(elf_gen *g, size_t *size) {
+	gen_buf img = { 0 }, dynstr = { 0 }, strtab = { 0 }, shstr = { 0 };
+	Elf32_Shdr shdr[SEC_NUM];
+	int present[SEC_NUM] = { 0 };
+	int index[SEC_NUM] = { 0 };
+	int num_sections = 0;
+	void *out = NULL;
+
+	memset(shdr, 0, sizeof(shdr));
+	for (int i = 0; i < SEC_NUM; i++)
+		present[i] = 1;
+	present[SEC_HASH] = !!(g->flags & ELF_GEN_HASH);
+	present[SEC_GNU_HASH] = !!(g->flags & ELF_GEN_GNU_HASH);
+	present[SEC_SYMTAB] = present[SEC_STRTAB] = !!(g->flags & ELF_GEN_SYMTAB);
+	for (int i = 0; i < SEC_NUM; i++) {
+		if (present[i])
+			index[i] = num_sections++;
+	}
+
+	int num_dynsym = 1 + g->num_imports + g->num_exports;
+	uint32_t symoffset = 1 + g->num_imports;
+
+	// .gnu.hash wants each bucket's symbols contiguous
+	gen_nbucket = g->num_exports / 4 + 1;
+	qsort(g->exports, g->num_exports, sizeof(gen_sym), gen_bucket_cmp);
+
+	// Headers, then .text at its fixed vaddr
+	int num_phdr = 3;
+	buf_put(&img, NULL, sizeof(Elf32_Ehdr) + num_phdr * sizeof(Elf32_Phdr));
+	buf_put(&img, NULL, ELF_GEN_TEXT - img.size);
+	buf_put(&img, g->text.data, g->text.size);
+	shdr[SEC_TEXT].sh_type = SHT_PROGBITS;
+	shdr[SEC_TEXT].sh_flags = SHF_ALLOC | SHF_EXECINSTR;
+	shdr[SEC_TEXT].sh_addr = ELF_GEN_TEXT;
+	shdr[SEC_TEXT].sh_size = g->text.size;
+	shdr[SEC_TEXT].sh_addralign = 4;
+
+	// .dynstr, built first since .dynsym and .dynamic point into it
+	uint32_t *import_names = malloc((g->num_imports + 1) * sizeof(uint32_t));
+	uint32_t *export_names = malloc((g->num_exports + 1) * sizeof(uint32_t));
+	uint32_t *needed_names = malloc((g->num_needed + 1) * sizeof(uint32_t));
+	buf_put(&dynstr, NULL, 1);
+	for (int i = 0; i < g->num_imports; i++)
+		import_names[i] = buf_str(&dynstr, g->imports[i].name);
+	for (int i = 0; i < g->num_exports; i++)
+		export_names[i] = buf_str(&dynstr, g->exports[i].name);
+	for (int i = 0; i < g->num_needed; i++)
+		needed_names[i] = buf_str(&dynstr, g->needed[i]);
+	uint32_t soname_name = buf_str(&dynstr, g->soname);
+
+	buf_align(&img, 4);
+	shdr[SEC_DYNSYM].sh_addr = img.size;
+	gen_sym_put(&img, 0, NULL, SHN_UNDEF);
+	for (int i = 0; i < g->num_imports; i++)
+		gen_sym_put(&img, import_names[i], &g->imports[i], SHN_UNDEF);
+	for (int i = 0; i < g->num_exports; i++)
+		gen_sym_put(&img, export_names[i], &g->exports[i], index[g->exports[i].data ? SEC_DATA : SEC_TEXT]);
+	shdr[SEC_DYNSYM].sh_type = SHT_DYNSYM;
+	shdr[SEC_DYNSYM].sh_flags = SHF_ALLOC;
+	shdr[SEC_DYNSYM].sh_size = img.size - shdr[SEC_DYNSYM].sh_addr;
+	shdr[SEC_DYNSYM].sh_link = index[SEC_DYNSTR];
+	shdr[SEC_DYNSYM].sh_info = 1;
+	shdr[SEC_DYNSYM].sh_addralign = 4;
+	shdr[SEC_DYNSYM].sh_entsize = sizeof(Elf32_Sym);
+
+	shdr[SEC_DYNSTR].sh_addr = buf_put(&img, dynstr.data, dynstr.size);
+	shdr[SEC_DYNSTR].sh_type = SHT_STRTAB;
+	shdr[SEC_DYNSTR].sh_flags = SHF_ALLOC;
+	shdr[SEC_DYNSTR].sh_size = dynstr.size;
+	shdr[SEC_DYNSTR].sh_addralign = 1;
+
+	if (present[SEC_HASH]) {
+		uint32_t nbucket = num_dynsym / 2 + 1;
+		uint32_t *hash = calloc(2 + nbucket + num_dynsym, sizeof(uint32_t));
+		uint32_t *bucket = &hash[2], *chain = &hash[2 + nbucket];
+		hash[0] = nbucket;
+		hash[1] = num_dynsym;
+		for (int i = 1; i < num_dynsym; i++) {
+			uint32_t h = i < symoffset ? g->imports[i - 1].hash : g->exports[i - symoffset].hash;
+			chain[i] = bucket[h % nbucket];
+			bucket[h % nbucket] = i;
+		}
+		buf_align(&img, 4);
+		shdr[SEC_HASH].sh_addr = buf_put(&img, hash, (2 + nbucket + num_dynsym) * sizeof(uint32_t));
+		shdr[SEC_HASH].sh_type = SHT_HASH;
+		shdr[SEC_HASH].sh_flags = SHF_ALLOC;
+		shdr[SEC_HASH].sh_size = (2 + nbucket + num_dynsym) * sizeof(uint32_t);
+		shdr[SEC_HASH].sh_link = index[SEC_DYNSYM];
+		shdr[SEC_HASH].sh_addralign = 4;
+		shdr[SEC_HASH].sh_entsize = 4;
+		free(hash);
+	}
+
+	if (present[SEC_GNU_HASH]) {
+		uint32_t bloom_size = 1, bloom_shift = 6;
+		while (bloom_size * 32 < (uint32_t)g->num_exports * 2)
+			bloom_size <<= 1;
+		uint32_t words = 4 + bloom_size + gen_nbucket + g->num_exports;
+		uint32_t *gnu = calloc(words, sizeof(uint32_t));
+		uint32_t *bloom = &gnu[4], *bucket = &gnu[4 + bloom_size], *chain = &gnu[4 + bloom_size + gen_nbucket];
+		gnu[0] = gen_nbucket;
+		gnu[1] = symoffset;
+		gnu[2] = bloom_size;
+		gnu[3] = bloom_shift;
+		for (int i = 0; i < g->num_exports; i++) {
+			uint32_t h = g->exports[i].gnu_hash;
+			bloom[(h / 32) % bloom_size] |= (1u << (h % 32)) | (1u << ((h >> bloom_shift) % 32));
+			if (!bucket[h % gen_nbucket])
+				bucket[h % gen_nbucket] = symoffset + i;
+			int last = i + 1 == g->num_exports || g->exports[i + 1].gnu_hash % gen_nbucket != h % gen_nbucket;
+			chain[i] = (h & ~1) | last;
+		}
+		buf_align(&img, 4);
+		shdr[SEC_GNU_HASH].sh_addr = buf_put(&img, gnu, words * sizeof(uint32_t));
+		shdr[SEC_GNU_HASH].sh_type = SHT_GNU_HASH;
+		shdr[SEC_GNU_HASH].sh_flags = SHF_ALLOC;
+		shdr[SEC_GNU_HASH].sh_size = words * sizeof(uint32_t);
+		shdr[SEC_GNU_HASH].sh_link = index[SEC_DYNSYM];
+		shdr[SEC_GNU_HASH].sh_addralign = 4;
+		free(gnu);
+	}
+
+	// .rel.dyn gets everything but the JUMP_SLOTs, which go in .rel.plt
+	for (int plt = 0; plt < 2; plt++) {
+		int sec = plt ? SEC_REL_PLT : SEC_REL_DYN;
+		buf_align(&img, 4);
+		shdr[sec].sh_addr = img.size;
+		for (int i = 0; i < g->num_rels; i++) {
+			if ((g->rels[i].type == R_ARM_JUMP_SLOT) != plt)
+				continue;
+			Elf32_Rel rel;
+			rel.r_offset = g->rels[i].offset;
+			rel.r_info = ELF32_R_INFO(g->rels[i].sym < 0 ? 0 : 1 + g->rels[i].sym, g->rels[i].type);
+			buf_put(&img, &rel, sizeof(rel));
+		}
+		shdr[sec].sh_type = SHT_REL;
+		shdr[sec].sh_flags = SHF_ALLOC;
+		shdr[sec].sh_size = img.size - shdr[sec].sh_addr;
+		shdr[sec].sh_link = index[SEC_DYNSYM];
+		shdr[sec].sh_info = plt ? index[SEC_GOT] : 0;
+		shdr[sec].sh_addralign = 4;
+		shdr[sec].sh_entsize = sizeof(Elf32_Rel);
+	}
+
+	size_t rx_size = img.size;
+	uint32_t dynamic_addr = GEN_ALIGN(ELF_GEN_DATA + g->data.size, 8);
+	if (rx_size + GEN_PAGE > ELF_GEN_GOT || 4 * g->num_got > ELF_GEN_GOT_MAX) {
+		fprintf(stderr, "elf_gen: %s doesn't fit, %u bytes of code and tables, %u GOT slots\n",
+			g->soname, (unsigned)rx_size, g->num_got);
+		goto out;
+	}
+
+	// RW segment, file offset congruent with its vaddr
+	buf_put(&img, NULL, GEN_ALIGN(img.size, GEN_PAGE) - img.size);
+	size_t rw_offset = img.size;
+	buf_put(&img, NULL, ELF_GEN_DATA - ELF_GEN_GOT); // .got, filled in by the relocations
+	buf_put(&img, g->data.data, g->data.size);
+	buf_put(&img, NULL, dynamic_addr - ELF_GEN_DATA - g->data.size);
+
+	shdr[SEC_GOT].sh_type = SHT_PROGBITS;
+	shdr[SEC_GOT].sh_flags = SHF_ALLOC | SHF_WRITE;
+	shdr[SEC_GOT].sh_addr = ELF_GEN_GOT;
+	shdr[SEC_GOT].sh_size = 4 * g->num_got;
+	shdr[SEC_GOT].sh_addralign = 4;
+
+	shdr[SEC_DATA].sh_type = SHT_PROGBITS;
+	shdr[SEC_DATA].sh_flags = SHF_ALLOC | SHF_WRITE;
+	shdr[SEC_DATA].sh_addr = ELF_GEN_DATA;
+	shdr[SEC_DATA].sh_size = g->data.size;
+	shdr[SEC_DATA].sh_addralign = 4;
+
+	Elf32_Dyn *dyn = malloc((g->num_needed + 16) * sizeof(Elf32_Dyn));
+	int num_dyn = 0;
+#define DYN(tag, val) do { dyn[num_dyn].d_tag = (tag); dyn[num_dyn].d_un.d_val = (val); num_dyn++; } while (0)
+	for (int i = 0; i < g->num_needed; i++)
+		DYN(DT_NEEDED, needed_names[i]);
+	DYN(DT_SONAME, soname_name);
+	if (present[SEC_HASH])
+		DYN(DT_HASH, shdr[SEC_HASH].sh_addr);
+	if (present[SEC_GNU_HASH])
+		DYN(DT_GNU_HASH, shdr[SEC_GNU_HASH].sh_addr);
+	DYN(DT_STRTAB, shdr[SEC_DYNSTR].sh_addr);
+	DYN(DT_SYMTAB, shdr[SEC_DYNSYM].sh_addr);
+	DYN(DT_STRSZ, shdr[SEC_DYNSTR].sh_size);
+	DYN(DT_SYMENT, sizeof(Elf32_Sym));
+	DYN(DT_REL, shdr[SEC_REL_DYN].sh_addr);
+	DYN(DT_RELSZ, shdr[SEC_REL_DYN].sh_size);
+	DYN(DT_RELENT, sizeof(Elf32_Rel));
+	DYN(DT_JMPREL, shdr[SEC_REL_PLT].sh_addr);
+	DYN(DT_PLTRELSZ, shdr[SEC_REL_PLT].sh_size);
+	DYN(DT_PLTREL, DT_REL);
+	DYN(DT_PLTGOT, ELF_GEN_GOT);
+	DYN(DT_NULL, 0);
+#undef DYN
+	buf_put(&img, dyn, num_dyn * sizeof(Elf32_Dyn));
+	free(dyn);
+	shdr[SEC_DYNAMIC].sh_type = SHT_DYNAMIC;
+	shdr[SEC_DYNAMIC].sh_flags = SHF_ALLOC | SHF_WRITE;
+	shdr[SEC_DYNAMIC].sh_addr = dynamic_addr;
+	shdr[SEC_DYNAMIC].sh_size = num_dyn * sizeof(Elf32_Dyn);
+	shdr[SEC_DYNAMIC].sh_link = index[SEC_DYNSTR];
+	shdr[SEC_DYNAMIC].sh_addralign = 4;
+	shdr[SEC_DYNAMIC].sh_entsize = sizeof(Elf32_Dyn);
+	size_t rw_size = img.size - rw_offset;
+
+	// Offsets of everything allocated follow from the two segments
+	for (int i = 1; i < SEC_NUM; i++) {
+		if (shdr[i].sh_flags & SHF_WRITE)
+			shdr[i].sh_offset = rw_offset + shdr[i].sh_addr - ELF_GEN_GOT;
+		else if (shdr[i].sh_flags & SHF_ALLOC)
+			shdr[i].sh_offset = shdr[i].sh_addr;
+	}
+
+	if (present[SEC_SYMTAB]) {
+		// Locals first: mapping symbols, then the exports again as globals
+		buf_align(&img, 4);
+		shdr[SEC_SYMTAB].sh_offset = img.size;
+		buf_put(&strtab, NULL, 1);
+		gen_sym_put(&img, 0, NULL, SHN_UNDEF);
+		for (int i = 0; i < g->num_mapping; i++) {
+			char name[3] = { '$', g->mapping[i].kind, '\0' };
+			gen_sym m = { 0 };
+			m.value = g->mapping[i].vaddr;
+			m.info = ELF32_ST_INFO(STB_LOCAL, STT_NOTYPE);
+			gen_sym_put(&img, buf_str(&strtab, name), &m, index[SEC_TEXT]);
+		}
+		for (int i = 0; i < g->num_exports; i++)
+			gen_sym_put(&img, buf_str(&strtab, g->exports[i].name), &g->exports[i], index[g->exports[i].data ? SEC_DATA : SEC_TEXT]);
+		shdr[SEC_SYMTAB].sh_type = SHT_SYMTAB;
+		shdr[SEC_SYMTAB].sh_size = img.size - shdr[SEC_SYMTAB].sh_offset;
+		shdr[SEC_SYMTAB].sh_link = index[SEC_STRTAB];
+		shdr[SEC_SYMTAB].sh_info = 1 + g->num_mapping;
+		shdr[SEC_SYMTAB].sh_addralign = 4;
+		shdr[SEC_SYMTAB].sh_entsize = sizeof(Elf32_Sym);
+
+		shdr[SEC_STRTAB].sh_offset = buf_put(&img, strtab.data, strtab.size);
+		shdr[SEC_STRTAB].sh_type = SHT_STRTAB;
+		shdr[SEC_STRTAB].sh_size = strtab.size;
+		shdr[SEC_STRTAB].sh_addralign = 1;
+	}
+
+	buf_put(&shstr, NULL, 1);
+	for (int i = 1; i < SEC_NUM; i++) {
+		if (present[i])
+			shdr[i].sh_name = buf_str(&shstr, sec_names[i]);
+	}
+	shdr[SEC_SHSTRTAB].sh_offset = buf_put(&img, shstr.data, shstr.size);
+	shdr[SEC_SHSTRTAB].sh_type = SHT_STRTAB;
+	shdr[SEC_SHSTRTAB].sh_size = shstr.size;
+	shdr[SEC_SHSTRTAB].sh_addralign = 1;
+
+	buf_align(&img, 4);
+	size_t shoff = img.size;
+	for (int i = 0; i < SEC_NUM; i++) {
+		if (present[i])
+			buf_put(&img, &shdr[i], sizeof(Elf32_Shdr));
+	}
+
+	Elf32_Ehdr *ehdr = (Elf32_Ehdr *)img.data;
+	memcpy(ehdr->e_ident, ELFMAG, SELFMAG);
+	ehdr->e_ident[EI_CLASS] = ELFCLASS32;
+	ehdr->e_ident[EI_DATA] = ELFDATA2LSB;
+	ehdr->e_ident[EI_VERSION] = EV_CURRENT;
+	ehdr->e_type = ET_DYN;
+	ehdr->e_machine = EM_ARM;
+	ehdr->e_version = EV_CURRENT;
+	ehdr->e_phoff = sizeof(Elf32_Ehdr);
+	ehdr->e_shoff = shoff;
+	ehdr->e_flags = EF_ARM_EABI_VER5;
+	ehdr->e_ehsize = sizeof(Elf32_Ehdr);
+	ehdr->e_phentsize = sizeof(Elf32_Phdr);
+	ehdr->e_phnum = num_phdr;
+	ehdr->e_shentsize = sizeof(Elf32_Shdr);
+	ehdr->e_shnum = num_sections;
+	ehdr->e_shstrndx = index[SEC_SHSTRTAB];
+
+	Elf32_Phdr *phdr = (Elf32_Phdr *)(img.data + sizeof(Elf32_Ehdr));
+	phdr[0].p_type = PT_LOAD;
+	phdr[0].p_filesz = phdr[0].p_memsz = rx_size;
+	phdr[0].p_flags = PF_R | PF_X;
+	phdr[0].p_align = GEN_PAGE;
+	phdr[1].p_type = PT_LOAD;
+	phdr[1].p_offset = rw_offset;
+	phdr[1].p_vaddr = phdr[1].p_paddr = ELF_GEN_GOT;
+	phdr[1].p_filesz = phdr[1].p_memsz = rw_size;
+	phdr[1].p_flags = PF_R | PF_W;
+	phdr[1].p_align = GEN_PAGE;
+	phdr[2].p_type = PT_DYNAMIC;
+	phdr[2].p_offset = shdr[SEC_DYNAMIC].sh_offset;
+	phdr[2].p_vaddr = phdr[2].p_paddr = dynamic_addr;
+	phdr[2].p_filesz = phdr[2].p_memsz = shdr[SEC_DYNAMIC].sh_size;
+	phdr[2].p_flags = PF_R | PF_W;
+	phdr[2].p_align = 4;
+
+	*size = img.size;
+	out = img.data;
+	img.data = NULL;
+
+out:
+	free(import_names);
+	free(export_names);
+	free(needed_names);
+	free(img.data);
+	free(dynstr.data);
+	free(strtab.data);
+	free(shstr.data);
+	return out;
+}
+
+int elf_gen_write(elf_gen *g, const char *path) {
+	size_t size;
+	void *image = elf_gen_image(g, &size);
+	if (!image)
+		return -1;
+
+	FILE *f = fopen(path, "wb");
+	int res = f && fwrite(image, size, 1, f) == 1 ? 0 : -1;
+	if (f && fclose(f) != 0)
+		res = -1;
+	free(image);
+	return res;
+}
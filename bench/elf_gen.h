@@ -0,0 +1,49 @@
+/* elf_gen.h -- builds small ARM32 shared objects for the host tests
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#ifndef __ELF_GEN_H__
+#define __ELF_GEN_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ELF_GEN_TEXT 0x1000 // vaddr of .text, the dynamic tables follow it
+#define ELF_GEN_GOT 0x400000 // vaddr of the RW segment, .got first
+#define ELF_GEN_GOT_MAX 0x10000
+#define ELF_GEN_DATA (ELF_GEN_GOT + ELF_GEN_GOT_MAX) // .data, .dynamic after it
+
+enum {
+	ELF_GEN_HASH = 1, // SysV .hash
+	ELF_GEN_GNU_HASH = 2, // .gnu.hash
+	ELF_GEN_SYMTAB = 4, // unstripped: .symtab with mapping symbols and every export
+};
+
+typedef struct elf_gen elf_gen;
+
+elf_gen *elf_gen_new(const char *soname, int flags);
+void elf_gen_free(elf_gen *g);
+
+// Appends to .text under a $a, $t or $d mapping symbol, returns where it went
+uint32_t elf_gen_code(elf_gen *g, const void *code, size_t size, char kind);
+// Appends to .data, returns where it went
+uint32_t elf_gen_data(elf_gen *g, const void *data, size_t size);
+
+// Exports, vaddr | 1 for Thumb functions. bind is STB_GLOBAL or STB_WEAK
+void elf_gen_func(elf_gen *g, const char *name, uint32_t vaddr, uint32_t size, int bind);
+void elf_gen_object(elf_gen *g, const char *name, uint32_t vaddr, uint32_t size, int bind);
+
+// Undefined symbol with a GOT slot relocated by type (R_ARM_ABS32, R_ARM_GLOB_DAT
+// or R_ARM_JUMP_SLOT), returns the slot
+uint32_t elf_gen_import(elf_gen *g, const char *name, int type);
+// R_ARM_RELATIVE on a .data word already holding a vaddr
+void elf_gen_relative(elf_gen *g, uint32_t vaddr);
+void elf_gen_needed(elf_gen *g, const char *soname);
+
+// The finished module, malloc'd. NULL if it doesn't fit the layout above
+void *elf_gen_image(elf_gen *g, size_t *size);
+int elf_gen_write(elf_gen *g, const char *path);
+
+#endif
@@ -0,0 +1,175 @@
+/* hook_batch_bench.c -- patch_game's hooking with and without a hook transaction
+ *
+ * Before transactions every hook did its own text write and flush, and
+ * patch_game flushed the whole of .text on top. so_hook_begin/so_hook_commit
+ * queue the writes instead, apply them with one write per page and flush only
+ * the dirty cache lines. Both ways hook the same functions of two copies of a
+ * synthetic module through a backend that counts what reaches it, and have to
+ * leave the same bytes behind. so_hook_revert then has to restore the batched
+ * copy to what it was before hooking.
+ *
+ * usage: hook_batch_bench [-v] [-n rounds] [-f functions]
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "elf_gen.h"
+#include "so_backend.h"
+
+static const uint32_t arm_func[] = {
+	0xe92d4010, // push {r4, lr}
+	0xe1a04000, // mov r4, r0
+	0xe2840001, // add r0, r4, #1
+	0xe8bd8010, // pop {r4, pc}
+};
+
+static const uint16_t thumb_func[] = {
+	0xb510, // push {r4, lr}
+	0x4604, // mov r4, r0
+	0x1c60, // adds r0, r4, #1
+	0xbf00, // nop
+	0xbd10, // pop {r4, pc}
+	0xbf00, // nop
+};
+
+typedef struct {
+	int writes, flushes;
+	size_t write_bytes, flush_bytes;
+	uint64_t us;
+} patch_stats;
+
+static patch_stats stats;
+
+// Hooking also reads instructions through code_memcpy, only writes into a module count
+static void counting_code_memcpy(void *dst, const void *src, size_t size) {
+	if (so_addr_range((uintptr_t)dst)) {
+		stats.writes++;
+		stats.write_bytes += size;
+	}
+	so_posix_backend.code_memcpy(dst, src, size);
+}
+
+static void counting_flush(void *addr, size_t size) {
+	stats.flushes++;
+	stats.flush_bytes += size;
+	so_posix_backend.flush(addr, size);
+}
+
+static so_backend counting_backend;
+
+static int host_stub(int x) {
+	return x + 1;
+}
+
+static void hook_all(so_module *mod, const uint32_t *vaddrs, int n, int batched) {
+	uint64_t start = host_time();
+	if (batched)
+		so_hook_begin();
+	for (int i = 0; i < n; i++)
+		hook_addr(mod->text_base + vaddrs[i], (uintptr_t)&host_stub);
+	if (batched)
+		so_hook_commit();
+	else
+		so_flush_caches(mod);
+	stats.us += host_time() - start;
+}
+
+static void print_stats(const char *name, const patch_stats *s, int rounds) {
+	printf("%-10s %6.1f us, %5d writes (%7zu bytes), %5d flushes (%8zu bytes) per module\n", name, (double)s->us / rounds,
+		s->writes / rounds, s->write_bytes / rounds, s->flushes / rounds, s->flush_bytes / rounds);
+}
+
+int main(int argc, char *argv[]) {
+	int rounds = 3, num_funcs = 256;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-v"))
+			verbose = 1;
+		else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			rounds = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-f") && i + 1 < argc)
+			num_funcs = atoi(argv[++i]);
+		else {
+			fprintf(stderr, "usage: %s [-v] [-n rounds] [-f functions]\n", argv[0]);
+			return 1;
+		}
+	}
+	// Every round maps two more modules and the posix backend only tracks 64 blocks
+	if (rounds <= 0 || rounds > 8 || num_funcs <= 0)
+		return 1;
+
+	elf_gen *g = elf_gen_new("libhookbatch.so", ELF_GEN_GNU_HASH | ELF_GEN_SYMTAB);
+	uint32_t *vaddrs = calloc(num_funcs, sizeof(uint32_t));
+	for (int i = 0; i < num_funcs; i++) {
+		// Spread the functions over many pages, with code nobody hooks in between
+		uint32_t filler[64];
+		for (int j = 0; j < 64; j++)
+			filler[j] = 0xe1a00000; // nop
+		elf_gen_code(g, filler, sizeof(filler), 'a');
+		vaddrs[i] = i & 1 ? elf_gen_code(g, thumb_func, sizeof(thumb_func), 't') | 1 : elf_gen_code(g, arm_func, sizeof(arm_func), 'a');
+	}
+	size_t size;
+	void *image = elf_gen_image(g, &size);
+	elf_gen_free(g);
+	if (!image)
+		return 1;
+
+	counting_backend = so_posix_backend;
+	counting_backend.code_memcpy = counting_code_memcpy;
+	counting_backend.flush = counting_flush;
+
+	size_t code_size = (vaddrs[num_funcs - 1] & ~1) + sizeof(arm_func) - ELF_GEN_TEXT;
+	uint8_t *pristine = malloc(code_size);
+	patch_stats single = {0}, batched = {0};
+
+	for (int r = 0; r < rounds; r++) {
+		so_module single_mod, batched_mod;
+		if (host_so_mem_load(&single_mod, image, size) < 0 || host_so_mem_load(&batched_mod, image, size) < 0) {
+			fprintf(stderr, "hook_batch_bench: failed to load the module\n");
+			return 1;
+		}
+		uint8_t *single_code = (uint8_t *)single_mod.text_base + ELF_GEN_TEXT;
+		uint8_t *batched_code = (uint8_t *)batched_mod.text_base + ELF_GEN_TEXT;
+		memcpy(pristine, batched_code, code_size);
+
+		so_set_backend(&counting_backend);
+		// Alternate the order so neither side always runs on a warm cache
+		for (int k = 0; k < 2; k++) {
+			int batch = (k + r) & 1;
+			memset(&stats, 0, sizeof(stats));
+			hook_all(batch ? &batched_mod : &single_mod, vaddrs, num_funcs, batch);
+			patch_stats *s = batch ? &batched : &single;
+			s->writes += stats.writes;
+			s->write_bytes += stats.write_bytes;
+			s->flushes += stats.flushes;
+			s->flush_bytes += stats.flush_bytes;
+			s->us += stats.us;
+		}
+		so_set_backend(&so_posix_backend);
+
+		CHECK(memcmp(single_code, batched_code, code_size) == 0);
+		CHECK(memcmp(pristine, batched_code, code_size) != 0);
+
+		// Reverting has to put back every byte the commit replaced
+		so_hook_revert();
+		CHECK(memcmp(pristine, batched_code, code_size) == 0);
+		CHECK(memcmp(single_code, batched_code, code_size) != 0);
+	}
+
+	// Two writes a hook (trampoline and patch) become one per touched page
+	CHECK(single.writes == 2 * num_funcs * rounds);
+	CHECK(batched.writes < single.writes / 2);
+	CHECK(batched.flush_bytes < single.flush_bytes);
+
+	printf("%d hooks, %zu bytes of code\n", num_funcs, code_size);
+	print_stats("single", &single, rounds);
+	print_stats("batched", &batched, rounds);
+
+	return host_report("hook_batch_bench");
+}
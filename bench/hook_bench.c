@@ -0,0 +1,171 @@
+/* hook_bench.c -- per-call cost of reaching a hooked function's original code
+ *
+ * Before trampolines, calling the original function behind a hook meant
+ * writing its first two instructions back, flushing, calling it and patching
+ * it again, on every call. Now the hook keeps a relocated copy of those
+ * instructions followed by a jump back, and the call goes straight through it.
+ *
+ * Both paths are timed over hooked ARM and Thumb functions of a synthetic
+ * module. The unpatch/repatch writes go through the same backend calls as on
+ * the Vita. The module's code can only run on an ARM host, so elsewhere the
+ * trampoline call is timed as a plain indirect call, which is what it costs
+ * on top of the relocated instructions.
+ *
+ * usage: hook_bench [-v] [-n calls] [-f functions]
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "elf_gen.h"
+#include "so_backend.h"
+#include "insn_reloc.h"
+
+// int f(int x) { return x + 1; }, with a prologue that relocates verbatim
+static const uint32_t arm_func[] = {
+	0xe92d4010, // push {r4, lr}
+	0xe1a04000, // mov r4, r0
+	0xe2840001, // add r0, r4, #1
+	0xe8bd8010, // pop {r4, pc}
+};
+
+static const uint16_t thumb_func[] = {
+	0xb510, // push {r4, lr}
+	0x4604, // mov r4, r0
+	0x1c60, // adds r0, r4, #1
+	0xbf00, // nop
+	0xbd10, // pop {r4, pc}
+	0xbf00, // nop
+};
+
+static int host_stub(int x) {
+	return x + 1;
+}
+
+// The trampoline has to end in a literal jump back to the first untouched instruction
+static int jumps_back(uintptr_t trampoline, uintptr_t resume) {
+	const uint32_t *words = (const uint32_t *)(trampoline & ~3);
+	for (int i = 0; i < INSN_RELOC_MAX / 4; i++) {
+		if (words[i] == resume)
+			return 1;
+	}
+	return 0;
+}
+
+// What SO_CONTINUE did for every call when there was no trampoline
+static int call_unpatched(const so_backend *b, so_hook *h, int x) {
+	b->code_memcpy((void *)h->addr, h->orig_instr, sizeof(h->orig_instr));
+	b->flush((void *)h->addr, sizeof(h->orig_instr));
+#ifdef __arm__
+	int r = ((int (*)(int))(h->thumb_addr ? h->thumb_addr : h->addr))(x);
+#else
+	int r = ((int (*volatile)(int))host_stub)(x);
+#endif
+	b->code_memcpy((void *)h->addr, h->patch_instr, sizeof(h->patch_instr));
+	b->flush((void *)h->addr, sizeof(h->patch_instr));
+	return r;
+}
+
+static int call_trampoline(so_hook *h, int x) {
+#ifdef __arm__
+	return ((int (*)(int))h->trampoline)(x);
+#else
+	return ((int (*volatile)(int))host_stub)(x);
+#endif
+}
+
+int main(int argc, char *argv[]) {
+	const so_backend *b = &so_posix_backend;
+	int calls = 20000, num_funcs = 64;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-v"))
+			verbose = 1;
+		else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			calls = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-f") && i + 1 < argc)
+			num_funcs = atoi(argv[++i]);
+		else {
+			fprintf(stderr, "usage: %s [-v] [-n calls] [-f functions]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (calls <= 0 || num_funcs <= 0)
+		return 1;
+
+	elf_gen *g = elf_gen_new("libhook.so", ELF_GEN_GNU_HASH | ELF_GEN_SYMTAB);
+	uint32_t *vaddrs = calloc(num_funcs, sizeof(uint32_t));
+	char name[32];
+	for (int i = 0; i < num_funcs; i++) {
+		int thumb = i & 1;
+		vaddrs[i] = thumb ? elf_gen_code(g, thumb_func, sizeof(thumb_func), 't') | 1 : elf_gen_code(g, arm_func, sizeof(arm_func), 'a');
+		snprintf(name, sizeof(name), "func_%d", i);
+		elf_gen_func(g, name, vaddrs[i], thumb ? sizeof(thumb_func) : sizeof(arm_func), STB_GLOBAL);
+	}
+	size_t size;
+	void *image = elf_gen_image(g, &size);
+	elf_gen_free(g);
+
+	so_module mod;
+	if (!image || host_so_mem_load(&mod, image, size) < 0) {
+		fprintf(stderr, "hook_bench: failed to load the module\n");
+		return 1;
+	}
+
+	so_hook *hooks = calloc(num_funcs, sizeof(so_hook));
+	for (int i = 0; i < num_funcs; i++) {
+		uintptr_t addr = mod.text_base + vaddrs[i];
+		uint32_t orig[2];
+		memcpy(orig, (void *)(addr & ~1), sizeof(orig));
+
+		hooks[i] = hook_addr(addr, (uintptr_t)&host_stub);
+		so_hook *h = &hooks[i];
+		CHECK(h->trampoline != 0);
+		CHECK(memcmp((void *)h->addr, h->patch_instr, sizeof(h->patch_instr)) == 0);
+		CHECK(memcmp(h->orig_instr, orig, sizeof(orig)) == 0);
+		if (!h->trampoline)
+			continue;
+
+		// The prologues are position independent, so they're copied as they are
+		CHECK(memcmp((void *)(h->trampoline & ~1), orig, sizeof(orig)) == 0);
+		CHECK((h->trampoline & 1) == (addr & 1));
+		CHECK(jumps_back(h->trampoline, (addr + sizeof(orig)) | (addr & 1)));
+		CHECK(so_addr_range(h->trampoline & ~1) != NULL);
+	}
+	if (host_failures)
+		return host_report("hook_bench");
+
+	int sum = 0;
+	uint64_t start = host_time();
+	for (int i = 0; i < calls; i++)
+		sum += call_unpatched(b, &hooks[i % num_funcs], i);
+	uint64_t unpatched_us = host_time() - start;
+	CHECK(sum == (int)((int64_t)calls * (calls + 1) / 2));
+
+	// Every unpatch had to leave the hook in place again
+	for (int i = 0; i < num_funcs; i++)
+		CHECK(memcmp((void *)hooks[i].addr, hooks[i].patch_instr, sizeof(hooks[i].patch_instr)) == 0);
+
+	sum = 0;
+	start = host_time();
+	for (int i = 0; i < calls; i++)
+		sum += call_trampoline(&hooks[i % num_funcs], i);
+	uint64_t trampoline_us = host_time() - start;
+	CHECK(sum == (int)((int64_t)calls * (calls + 1) / 2));
+
+	printf("%d calls over %d hooks: unpatch/call/repatch %.1f ns per call, trampoline %.1f ns per call%s\n",
+		calls, num_funcs, unpatched_us * 1000.0 / calls, trampoline_us * 1000.0 / calls,
+#ifdef __arm__
+		""
+#else
+		" (indirect call, the module's code only runs on ARM)"
+#endif
+		);
+
+	return host_report("hook_bench");
+}
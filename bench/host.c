@@ -0,0 +1,135 @@
+/* host.c -- the main.c side of the loader for host builds
+ *
+ * The loader sources call back into debugPrintf, ret0 and fatal_error, which
+ * live in main.c on the Vita. This has host versions of those, and picks load
+ * addresses for modules the way the Vita's fixed memory layout would.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <sys/mman.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "host.h"
+
+#define LOAD_MARGIN (1024 * 1024) // room under the module for the patch arena, and above for islands
+
+int verbose = 0;
+int host_failures = 0;
+
+int debugPrintf(char *text, ...) {
+	if (!verbose)
+		return 0;
+
+	va_list list;
+	va_start(list, text);
+	int ret = vfprintf(stderr, text, list);
+	va_end(list);
+	return ret;
+}
+
+int ret0() {
+	return 0;
+}
+
+void fatal_error(const char *fmt, ...) {
+	va_list list;
+	va_start(list, fmt);
+	vfprintf(stderr, fmt, list);
+	va_end(list);
+	exit(1);
+}
+
+uint64_t host_time(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Address span the module's PT_LOAD segments cover once mapped
+size_t host_so_extent(const Elf32_Ehdr *ehdr, const Elf32_Phdr *phdr) {
+	size_t extent = 0;
+	for (int i = 0; i < ehdr->e_phnum; i++) {
+		if (phdr[i].p_type == PT_LOAD && phdr[i].p_vaddr + phdr[i].p_memsz + phdr[i].p_align > extent)
+			extent = phdr[i].p_vaddr + phdr[i].p_memsz + phdr[i].p_align;
+	}
+	return extent;
+}
+
+// The loader places modules at fixed addresses, find a hole big enough for this one
+uintptr_t host_pick_load_addr(size_t extent) {
+	if (!extent)
+		return 0;
+
+	size_t size = ALIGN_MEM(extent, 0x10000) + 2 * LOAD_MARGIN;
+	void *hole = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (hole == MAP_FAILED)
+		return 0;
+	munmap(hole, size);
+	return ALIGN_MEM((uintptr_t)hole + LOAD_MARGIN, 0x10000);
+}
+
+int host_so_file_load(so_module *mod, const char *path) {
+	FILE *f = fopen(path, "rb");
+	if (!f)
+		return -1;
+
+	Elf32_Ehdr ehdr;
+	Elf32_Phdr *phdr = NULL;
+	size_t extent = 0;
+	if (fread(&ehdr, sizeof(ehdr), 1, f) == 1 && memcmp(&ehdr, ELFMAG, SELFMAG) == 0) {
+		phdr = malloc(ehdr.e_phnum * sizeof(Elf32_Phdr));
+		if (phdr && fseek(f, ehdr.e_phoff, SEEK_SET) == 0 && fread(phdr, sizeof(Elf32_Phdr), ehdr.e_phnum, f) == ehdr.e_phnum)
+			extent = host_so_extent(&ehdr, phdr);
+	}
+	free(phdr);
+	fclose(f);
+
+	uintptr_t load_addr = host_pick_load_addr(extent);
+	if (!load_addr)
+		return -1;
+	return so_file_load(mod, path, load_addr);
+}
+
+int host_so_mem_load(so_module *mod, void *image, size_t size) {
+	const Elf32_Ehdr *ehdr = image;
+	if (size < sizeof(Elf32_Ehdr) || ehdr->e_phoff + ehdr->e_phnum * sizeof(Elf32_Phdr) > size)
+		return -1;
+
+	uintptr_t load_addr = host_pick_load_addr(host_so_extent(ehdr, (const Elf32_Phdr *)((uint8_t *)image + ehdr->e_phoff)));
+	if (!load_addr)
+		return -1;
+	return so_mem_load(mod, image, size, load_addr);
+}
+
+// Every import of the module bound to func, standing in for the loader's default_dynlib
+so_default_dynlib *host_import_table(so_module *mod, uintptr_t func, int *num_entries) {
+	so_default_dynlib *table = calloc(mod->num_dynsym, sizeof(so_default_dynlib));
+	int n = 0;
+
+	for (int i = 1; table && i < mod->num_dynsym; i++) {
+		Elf32_Sym *sym = &mod->dynsym[i];
+		if (sym->st_shndx != SHN_UNDEF || !sym->st_name)
+			continue;
+		table[n].symbol = mod->dynstr + sym->st_name;
+		table[n].func = func;
+		table[n].hash = so_gnu_hash((const uint8_t *)table[n].symbol);
+		n++;
+	}
+
+	*num_entries = n;
+	return table;
+}
+
+int host_report(const char *name) {
+	if (host_failures) {
+		fprintf(stderr, "%s: %d check%s failed\n", name, host_failures, host_failures == 1 ? "" : "s");
+		return 1;
+	}
+	printf("%s: ok\n", name);
+	return 0;
+}
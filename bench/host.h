@@ -0,0 +1,42 @@
+/* host.h -- what the loader sources expect from main.c, plus helpers for the host tests
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#ifndef __HOST_H__
+#define __HOST_H__
+
+#include <vitasdk.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "so_util.h"
+
+extern int verbose; // debugPrintf only prints with this set
+extern int host_failures;
+
+// Counts a failed check and carries on, so one run reports every broken case
+#define CHECK(cond) do { \
+	if (!(cond)) { \
+		fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+		host_failures++; \
+	} \
+} while (0)
+
+int debugPrintf(char *text, ...);
+int ret0();
+void fatal_error(const char *fmt, ...);
+
+uint64_t host_time(void); // microseconds
+size_t host_so_extent(const Elf32_Ehdr *ehdr, const Elf32_Phdr *phdr);
+uintptr_t host_pick_load_addr(size_t extent);
+int host_so_file_load(so_module *mod, const char *path);
+int host_so_mem_load(so_module *mod, void *image, size_t size);
+so_default_dynlib *host_import_table(so_module *mod, uintptr_t func, int *num_entries);
+
+// Exit status for a test: prints the tally and fails if any CHECK did
+int host_report(const char *name);
+
+#endif
@@ -0,0 +1,10 @@
+/* touch.h -- main.h declares the touch panel info, nothing on the host reads it */
+
+#ifndef __BENCH_PSP2_TOUCH_H__
+#define __BENCH_PSP2_TOUCH_H__
+
+typedef struct SceTouchPanelInfo {
+	int unused;
+} SceTouchPanelInfo;
+
+#endif
@@ -0,0 +1,33 @@
+/* vitaGL.h -- vitaGL's heap entry points, served by libc for host builds
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#ifndef __BENCH_VITAGL_H__
+#define __BENCH_VITAGL_H__
+
+#include <malloc.h>
+#include <stdlib.h>
+
+static inline void *vglMalloc(size_t size) {
+	return malloc(size);
+}
+
+static inline void *vglCalloc(size_t num, size_t size) {
+	return calloc(num, size);
+}
+
+static inline void *vglMemalign(size_t alignment, size_t size) {
+	return memalign(alignment, size);
+}
+
+static inline void *vglRealloc(void *ptr, size_t size) {
+	return realloc(ptr, size);
+}
+
+static inline void vglFree(void *ptr) {
+	free(ptr);
+}
+
+#endif
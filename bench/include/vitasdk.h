@@ -0,0 +1,114 @@
+/* vitasdk.h -- the few SDK calls the loader core makes, mapped onto POSIX for host builds
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#ifndef __BENCH_VITASDK_H__
+#define __BENCH_VITASDK_H__
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef int SceUID;
+typedef uint32_t SceUInt32;
+typedef uint64_t SceUInt64;
+typedef int64_t SceOff;
+typedef unsigned int SceSize;
+
+typedef pthread_mutex_t SceKernelLwMutexWork;
+
+typedef struct {
+	SceSize size;
+} SceKernelThreadInfo;
+
+#define SCE_O_RDONLY O_RDONLY
+#define SCE_O_WRONLY O_WRONLY
+#define SCE_O_RDWR O_RDWR
+#define SCE_O_CREAT O_CREAT
+#define SCE_O_TRUNC O_TRUNC
+
+#define SCE_SEEK_SET SEEK_SET
+#define SCE_SEEK_CUR SEEK_CUR
+#define SCE_SEEK_END SEEK_END
+
+static inline SceUID sceIoOpen(const char *path, int flags, int mode) {
+	return open(path, flags, mode);
+}
+
+static inline int sceIoClose(SceUID fd) {
+	return close(fd);
+}
+
+static inline int sceIoRead(SceUID fd, void *buf, size_t size) {
+	return read(fd, buf, size);
+}
+
+static inline int sceIoWrite(SceUID fd, const void *buf, size_t size) {
+	return write(fd, buf, size);
+}
+
+static inline int sceIoPread(SceUID fd, void *buf, size_t size, SceOff offset) {
+	return pread(fd, buf, size, offset);
+}
+
+static inline int sceIoPwrite(SceUID fd, const void *buf, size_t size, SceOff offset) {
+	return pwrite(fd, buf, size, offset);
+}
+
+static inline SceOff sceIoLseek(SceUID fd, SceOff offset, int whence) {
+	return lseek(fd, offset, whence);
+}
+
+static inline int sceIoRemove(const char *path) {
+	return unlink(path);
+}
+
+// Taken once at a time with no timeout, so a plain pthread mutex does
+static inline int sceKernelCreateLwMutex(SceKernelLwMutexWork *work, const char *name, unsigned attr, int count, void *opt) {
+	return pthread_mutex_init(work, NULL);
+}
+
+static inline int sceKernelDeleteLwMutex(SceKernelLwMutexWork *work) {
+	return pthread_mutex_destroy(work);
+}
+
+static inline int sceKernelLockLwMutex(SceKernelLwMutexWork *work, int count, unsigned *timeout) {
+	return pthread_mutex_lock(work);
+}
+
+static inline int sceKernelUnlockLwMutex(SceKernelLwMutexWork *work, int count) {
+	return pthread_mutex_unlock(work);
+}
+
+static inline SceUID sceKernelGetThreadId(void) {
+	return gettid();
+}
+
+static inline SceUInt32 sceKernelGetProcessTimeLow(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (SceUInt32)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static inline int sceKernelDelayThread(SceUInt32 delay) {
+	return usleep(delay);
+}
+
+// Only whether the thread still exists, which is all slab asks
+static inline int sceKernelGetThreadInfo(SceUID thid, SceKernelThreadInfo *info) {
+	char path[32];
+	snprintf(path, sizeof(path), "/proc/self/task/%d", thid);
+	return access(path, F_OK) == 0 ? 0 : -1;
+}
+
+static inline void *sceClibMemcpy(void *dst, const void *src, size_t size) {
+	return memcpy(dst, src, size);
+}
+
+#endif
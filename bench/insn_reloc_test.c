@@ -0,0 +1,311 @@
+/* insn_reloc_test.c -- encodings insn_reloc emits for relocated prologues
+ *
+ * Every case is an instruction sequence at a known PC and the exact trampoline
+ * it has to become, literal pool included. Inputs and expected outputs were
+ * assembled with llvm-mc (-triple=armv7 / thumbv7), the assembly is next to
+ * each encoding.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "host.h"
+#include "insn_reloc.h"
+
+#define PC 0x80000
+#define LIT(x) ((x) & 0xffff), ((x) >> 16) // pool word as two Thumb halfwords
+
+typedef struct {
+	const char *name;
+	uintptr_t pc;
+	size_t min_size;
+	uint32_t in[4];
+	int size; // -1: has to be refused
+	size_t consumed;
+	uint32_t out[8];
+} arm_case;
+
+typedef struct {
+	const char *name;
+	uintptr_t pc;
+	size_t min_size;
+	uint16_t in[4];
+	int size;
+	size_t consumed;
+	uint16_t out[16];
+} thumb_case;
+
+static const arm_case arm_cases[] = {
+	{ "position independent", PC, 8,
+		{ 0xe92d4010, 0xe1a04000 }, // push {r4, lr}; mov r4, r0
+		16, 8, {
+		0xe92d4010, // push {r4, lr}
+		0xe1a04000, // mov r4, r0
+		0xe51ff004, // ldr pc, [pc, #-4]
+		PC + 8,
+	} },
+	{ "b", PC, 4,
+		{ 0xea000010 }, // b #64
+		16, 4, {
+		0xe59ff000, // ldr pc, [pc]
+		0xe59ff000, // ldr pc, [pc]
+		PC + 8 + 64,
+		PC + 4,
+	} },
+	{ "bne", PC, 4,
+		{ 0x1a000010 }, // bne #64
+		16, 4, {
+		0x159ff000, // ldrne pc, [pc]
+		0xe59ff000, // ldr pc, [pc]
+		PC + 8 + 64,
+		PC + 4,
+	} },
+	{ "bl", PC, 4,
+		{ 0xeb000010 }, // bl #64
+		20, 4, {
+		0xe59fc004, // ldr r12, [pc, #4]
+		0xe12fff3c, // blx r12
+		0xe59ff000, // ldr pc, [pc]
+		PC + 8 + 64,
+		PC + 4,
+	} },
+	{ "blx to thumb", PC, 4,
+		{ 0xfa000010 }, // blx #64
+		20, 4, {
+		0xe59fc004, // ldr r12, [pc, #4]
+		0xe12fff3c, // blx r12
+		0xe59ff000, // ldr pc, [pc]
+		(PC + 8 + 64) | 1,
+		PC + 4,
+	} },
+	{ "push then bl", PC, 8,
+		{ 0xe92d4010, 0xeb000010 }, // push {r4, lr}; bl #64
+		24, 8, {
+		0xe92d4010, // push {r4, lr}
+		0xe59fc004, // ldr r12, [pc, #4]
+		0xe12fff3c, // blx r12
+		0xe59ff000, // ldr pc, [pc]
+		PC + 4 + 8 + 64,
+		PC + 8,
+	} },
+	{ "ldr literal", PC, 4,
+		{ 0xe59f0010 }, // ldr r0, [pc, #16]
+		20, 4, {
+		0xe59f0004, // ldr r0, [pc, #4]
+		0xe5900000, // ldr r0, [r0]
+		0xe59ff000, // ldr pc, [pc]
+		PC + 8 + 16,
+		PC + 4,
+	} },
+	{ "ldr pc literal", PC, 4,
+		{ 0xe51ff004 }, // ldr pc, [pc, #-4]
+		20, 4, {
+		0xe59fc004, // ldr r12, [pc, #4]
+		0xe59cf000, // ldr pc, [r12]
+		0xe59ff000, // ldr pc, [pc]
+		PC + 8 - 4,
+		PC + 4,
+	} },
+	{ "adr", PC, 4,
+		{ 0xe28f0008 }, // adr r0, #8
+		20, 4, {
+		0xe59fc004, // ldr r12, [pc, #4]
+		0xe28c0008, // add r0, r12, #8
+		0xe59ff000, // ldr pc, [pc]
+		PC + 8,
+		PC + 4,
+	} },
+	{ "add pc register", PC, 4,
+		{ 0xe081000f }, // add r0, r1, pc
+		20, 4, {
+		0xe59fc004, // ldr r12, [pc, #4]
+		0xe081000c, // add r0, r1, r12
+		0xe59ff000, // ldr pc, [pc]
+		PC + 8,
+		PC + 4,
+	} },
+	{ "vldr literal", PC, 4,
+		{ 0xed9f0b02 }, // vldr d0, [pc, #8]
+		20, 4, {
+		0xe59fc004, // ldr r12, [pc, #4]
+		0xed9c0b00, // vldr d0, [r12]
+		0xe59ff000, // ldr pc, [pc]
+		PC + 8 + 8,
+		PC + 4,
+	} },
+	{ "ldm pc", PC, 4, { 0xe89f0003 }, -1 }, // ldm pc, {r0, r1}
+	{ "ldrd literal", PC, 4, { 0xe1cf00d8 }, -1 }, // ldrd r0, r1, [pc, #8]
+	{ "bx pc", PC, 4, { 0xe12fff1f }, -1 }, // bx pc
+};
+
+static const thumb_case thumb_cases[] = {
+	{ "position independent", PC, 4,
+		{ 0xb510, 0x4604 }, // push {r4, lr}; mov r4, r0
+		12, 4, {
+		0xb510, // push {r4, lr}
+		0x4604, // mov r4, r0
+		0xf8df, 0xf000, // ldr.w pc, [pc]
+		LIT(PC + 4 + 1),
+	} },
+	{ "32-bit instruction past min_size", PC, 4,
+		{ 0xb510, 0xf000, 0xf820 }, // push {r4, lr}; bl #64
+		20, 6, {
+		0xb510, // push {r4, lr}
+		0xf8df, 0xc008, // ldr.w r12, [pc, #8]
+		0x47e0, // blx r12
+		0xf8df, 0xf004, // ldr.w pc, [pc, #4]
+		LIT(PC + 2 + 4 + 64 + 1),
+		LIT(PC + 6 + 1),
+	} },
+	{ "bl", PC, 4,
+		{ 0xf000, 0xf820 }, // bl #64
+		20, 4, {
+		0xf8df, 0xc008, // ldr.w r12, [pc, #8]
+		0x47e0, // blx r12
+		0xf8df, 0xf008, // ldr.w pc, [pc, #8]
+		0xbf00, // nop
+		LIT(PC + 4 + 64 + 1),
+		LIT(PC + 4 + 1),
+	} },
+	{ "blx to arm", PC, 4,
+		{ 0xf000, 0xe820 }, // blx #64
+		20, 4, {
+		0xf8df, 0xc008, // ldr.w r12, [pc, #8]
+		0x47e0, // blx r12
+		0xf8df, 0xf008, // ldr.w pc, [pc, #8]
+		0xbf00, // nop
+		LIT(PC + 4 + 64),
+		LIT(PC + 4 + 1),
+	} },
+	{ "b.w", PC, 4,
+		{ 0xf000, 0xb820 }, // b.w #64
+		16, 4, {
+		0xf8df, 0xf004, // ldr.w pc, [pc, #4]
+		0xf8df, 0xf004, // ldr.w pc, [pc, #4]
+		LIT(PC + 4 + 64 + 1),
+		LIT(PC + 4 + 1),
+	} },
+	{ "beq", PC, 2,
+		{ 0xd008 }, // beq #16
+		20, 2, {
+		0xd101, // bne #2
+		0xf8df, 0xf008, // ldr.w pc, [pc, #8]
+		0xf8df, 0xf008, // ldr.w pc, [pc, #8]
+		0xbf00, // nop
+		LIT(PC + 4 + 16 + 1),
+		LIT(PC + 2 + 1),
+	} },
+	{ "cbz", PC, 2,
+		{ 0xb140 }, // cbz r0, #16
+		20, 2, {
+		0xb908, // cbnz r0, #2
+		0xf8df, 0xf008, // ldr.w pc, [pc, #8]
+		0xf8df, 0xf008, // ldr.w pc, [pc, #8]
+		0xbf00, // nop
+		LIT(PC + 4 + 16 + 1),
+		LIT(PC + 2 + 1),
+	} },
+	{ "ldr literal, unaligned pc", PC + 2, 2,
+		{ 0x4802 }, // ldr r0, [pc, #8]
+		20, 2, {
+		0xf8df, 0x0008, // ldr.w r0, [pc, #8]
+		0x6800, // ldr r0, [r0]
+		0xf8df, 0xf008, // ldr.w pc, [pc, #8]
+		0xbf00, // nop
+		LIT(PC + 4 + 8), // Align(PC + 2 + 4, 4) + 8
+		LIT(PC + 4 + 1),
+	} },
+	{ "ldr.w literal", PC, 4,
+		{ 0xf8df, 0x2008 }, // ldr.w r2, [pc, #8]
+		20, 4, {
+		0xf8df, 0x2008, // ldr.w r2, [pc, #8]
+		0xf8d2, 0x2000, // ldr.w r2, [r2]
+		0xf8df, 0xf004, // ldr.w pc, [pc, #4]
+		LIT(PC + 4 + 8),
+		LIT(PC + 4 + 1),
+	} },
+	{ "adr", PC, 2,
+		{ 0xa102 }, // adr r1, #8
+		16, 2, {
+		0xf8df, 0x1004, // ldr.w r1, [pc, #4]
+		0xf8df, 0xf004, // ldr.w pc, [pc, #4]
+		LIT(PC + 4 + 8),
+		LIT(PC + 2 + 1),
+	} },
+	{ "mov from pc", PC, 2,
+		{ 0x4678 }, // mov r0, pc
+		16, 2, {
+		0xf8df, 0x0004, // ldr.w r0, [pc, #4]
+		0xf8df, 0xf004, // ldr.w pc, [pc, #4]
+		LIT(PC + 4),
+		LIT(PC + 2 + 1),
+	} },
+	{ "add pc", PC, 2,
+		{ 0x4478 }, // add r0, pc
+		20, 2, {
+		0xf8df, 0xc008, // ldr.w r12, [pc, #8]
+		0x4460, // add r0, r12
+		0xf8df, 0xf008, // ldr.w pc, [pc, #8]
+		0xbf00, // nop
+		LIT(PC + 4),
+		LIT(PC + 2 + 1),
+	} },
+	{ "it", PC, 2, { 0xbf08, 0x4478 }, -1 }, // it eq
+	{ "bx pc", PC, 2, { 0x4778 }, -1 }, // bx pc
+};
+
+static void check_arm(const arm_case *t) {
+	uint32_t out[INSN_RELOC_MAX / 4];
+	size_t consumed = 0;
+
+	memset(out, 0xcc, sizeof(out));
+	int size = insn_reloc_arm(t->in, t->pc, t->min_size, out, sizeof(out), &consumed);
+	if (size != t->size || (size >= 0 && (consumed != t->consumed || memcmp(out, t->out, size) != 0))) {
+		fprintf(stderr, "arm %s: %d bytes (expected %d), consumed %zu (expected %zu):", t->name, size, t->size, consumed, t->consumed);
+		for (int i = 0; i < size / 4; i++)
+			fprintf(stderr, " %08x", out[i]);
+		fprintf(stderr, "\n");
+		host_failures++;
+	}
+
+	// A buffer one word short has to be refused rather than overrun
+	if (t->size > 0) {
+		memset(out, 0xcc, sizeof(out));
+		CHECK(insn_reloc_arm(t->in, t->pc, t->min_size, out, t->size - 4, &consumed) == -1);
+		CHECK(out[t->size / 4 - 1] == 0xcccccccc);
+	}
+}
+
+static void check_thumb(const thumb_case *t) {
+	uint32_t out[INSN_RELOC_MAX / 4];
+	size_t consumed = 0;
+
+	memset(out, 0xcc, sizeof(out));
+	int size = insn_reloc_thumb(t->in, t->pc | 1, t->min_size, out, sizeof(out), &consumed);
+	if (size != t->size || (size >= 0 && (consumed != t->consumed || memcmp(out, t->out, size) != 0))) {
+		const uint16_t *hw = (const uint16_t *)out;
+		fprintf(stderr, "thumb %s: %d bytes (expected %d), consumed %zu (expected %zu):", t->name, size, t->size, consumed, t->consumed);
+		for (int i = 0; i < size / 2; i++)
+			fprintf(stderr, " %04x", hw[i]);
+		fprintf(stderr, "\n");
+		host_failures++;
+	}
+
+	if (t->size > 0) {
+		memset(out, 0xcc, sizeof(out));
+		CHECK(insn_reloc_thumb(t->in, t->pc | 1, t->min_size, out, t->size - 4, &consumed) == -1);
+		CHECK(out[t->size / 4 - 1] == 0xcccccccc);
+	}
+}
+
+int main(int argc, char *argv[]) {
+	for (int i = 0; i < sizeof(arm_cases) / sizeof(*arm_cases); i++)
+		check_arm(&arm_cases[i]);
+	for (int i = 0; i < sizeof(thumb_cases) / sizeof(*thumb_cases); i++)
+		check_thumb(&thumb_cases[i]);
+
+	return host_report("insn_reloc_test");
+}
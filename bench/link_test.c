@@ -0,0 +1,139 @@
+/* link_test.c -- imports resolved across several modules through the global index
+ *
+ * libmain NEEDs libB and libA, libB NEEDs libA, and they're loaded in the
+ * wrong order on purpose. libC and libD need each other, which the topological
+ * order has to break without hanging. Every import has to end up where ld.so
+ * would put it: the first definition in dependents-first scope order, strong
+ * over weak, and default_dynlib over all of them.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "elf_gen.h"
+
+#define DYNLIB_STRLEN 0x12340000
+
+typedef struct {
+	const char *name;
+	int bind;
+} export_def;
+
+typedef struct {
+	const char *name;
+	int type;
+} import_def;
+
+typedef struct {
+	const char *soname;
+	const char *needed[2];
+	export_def exports[5];
+	import_def imports[10];
+	uint32_t slots[10];
+	so_module *mod;
+} module_def;
+
+enum { LIB_A, LIB_B, LIB_MAIN, LIB_C, LIB_D, NUM_MODULES };
+
+static module_def modules[NUM_MODULES] = {
+	[LIB_A] = { "libA.so", { NULL },
+		{ { "shared_func", STB_GLOBAL }, { "weak_func", STB_WEAK }, { "a_only", STB_GLOBAL }, { "dup", STB_GLOBAL }, { "strlen", STB_GLOBAL } },
+		{ { NULL } } },
+	[LIB_B] = { "libB.so", { "libA.so" },
+		{ { "weak_func", STB_GLOBAL }, { "dup", STB_GLOBAL }, { "b_func", STB_GLOBAL } },
+		{ { "a_only", R_ARM_JUMP_SLOT }, { "shared_func", R_ARM_GLOB_DAT } } },
+	[LIB_MAIN] = { "libmain.so", { "libB.so", "libA.so" },
+		{ { NULL } },
+		{
+			{ "shared_func", R_ARM_JUMP_SLOT },
+			{ "shared_func", R_ARM_ABS32 },
+			{ "weak_func", R_ARM_JUMP_SLOT },
+			{ "dup", R_ARM_JUMP_SLOT },
+			{ "a_only", R_ARM_GLOB_DAT },
+			{ "b_func", R_ARM_JUMP_SLOT },
+			{ "strlen", R_ARM_JUMP_SLOT },
+			{ "missing", R_ARM_GLOB_DAT },
+		} },
+	[LIB_C] = { "libC.so", { "libD.so" },
+		{ { "c_func", STB_GLOBAL } },
+		{ { "d_func", R_ARM_JUMP_SLOT } } },
+	[LIB_D] = { "libD.so", { "libC.so" },
+		{ { "d_func", STB_GLOBAL } },
+		{ { "c_func", R_ARM_JUMP_SLOT } } },
+};
+
+// Loaded modules stay on so_util's list, so every one gets its own so_module
+static void load(module_def *m) {
+	elf_gen *g = elf_gen_new(m->soname, ELF_GEN_HASH | ELF_GEN_GNU_HASH);
+	for (int i = 0; i < 2 && m->needed[i]; i++)
+		elf_gen_needed(g, m->needed[i]);
+	for (int i = 0; i < 5 && m->exports[i].name; i++) {
+		uint32_t insn = 0xe12fff1e; // bx lr
+		elf_gen_func(g, m->exports[i].name, elf_gen_code(g, &insn, sizeof(insn), 'a'), sizeof(insn), m->exports[i].bind);
+	}
+	for (int i = 0; i < 10 && m->imports[i].name; i++)
+		m->slots[i] = elf_gen_import(g, m->imports[i].name, m->imports[i].type);
+
+	size_t size;
+	void *image = elf_gen_image(g, &size);
+	elf_gen_free(g);
+
+	m->mod = calloc(1, sizeof(so_module));
+	if (!image || !m->mod || host_so_mem_load(m->mod, image, size) < 0) {
+		fprintf(stderr, "link_test: failed to load %s\n", m->soname);
+		exit(1);
+	}
+}
+
+static void check_import(int lib, int import, int from_lib) {
+	module_def *m = &modules[lib];
+	uintptr_t got = *(uintptr_t *)(m->mod->text_base + m->slots[import]);
+	uintptr_t expected = from_lib < 0 ? 0 : so_symbol(modules[from_lib].mod, m->imports[import].name);
+
+	if (got != expected) {
+		fprintf(stderr, "%s: %s bound to 0x%08x, expected 0x%08x from %s\n", m->soname, m->imports[import].name,
+			(unsigned)got, (unsigned)expected, from_lib < 0 ? "nowhere" : modules[from_lib].soname);
+		host_failures++;
+	}
+}
+
+int main(int argc, char *argv[]) {
+	// Dependents before their dependencies, the opposite of what relocation needs
+	static const int load_order[NUM_MODULES] = { LIB_MAIN, LIB_C, LIB_B, LIB_D, LIB_A };
+	for (int i = 0; i < NUM_MODULES; i++)
+		load(&modules[load_order[i]]);
+
+	so_default_dynlib dynlib[] = {
+		{ "strlen", DYNLIB_STRLEN },
+	};
+	CHECK(so_relocate_resolve_all(dynlib, sizeof(dynlib), 0) == 0);
+
+	for (int i = 0; i < NUM_MODULES; i++)
+		CHECK(modules[i].mod->num_needed == (modules[i].needed[0] != NULL) + (modules[i].needed[1] != NULL));
+	CHECK(modules[LIB_MAIN].mod->needed[0] == modules[LIB_B].mod);
+	CHECK(modules[LIB_MAIN].mod->needed[1] == modules[LIB_A].mod);
+
+	check_import(LIB_MAIN, 0, LIB_A); // shared_func
+	check_import(LIB_MAIN, 1, LIB_A); // shared_func, ABS32 with a 0 addend
+	check_import(LIB_MAIN, 2, LIB_B); // weak_func: libB's strong definition beats libA's weak one
+	check_import(LIB_MAIN, 3, LIB_B); // dup: libB comes first in scope
+	check_import(LIB_MAIN, 4, LIB_A); // a_only
+	check_import(LIB_MAIN, 5, LIB_B); // b_func
+	check_import(LIB_MAIN, 7, -1); // missing
+	CHECK(*(uintptr_t *)(modules[LIB_MAIN].mod->text_base + modules[LIB_MAIN].slots[6]) == DYNLIB_STRLEN);
+	CHECK(modules[LIB_MAIN].mod->reloc_stats.unbound[SO_STAT_GLOB_DAT] == 1);
+	CHECK(modules[LIB_MAIN].mod->reloc_stats.unbound[SO_STAT_JUMP_SLOT] == 0);
+
+	check_import(LIB_B, 0, LIB_A); // a_only
+	check_import(LIB_B, 1, LIB_A); // shared_func
+
+	check_import(LIB_C, 0, LIB_D); // d_func
+	check_import(LIB_D, 0, LIB_C); // c_func
+
+	return host_report("link_test");
+}
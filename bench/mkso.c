@@ -0,0 +1,78 @@
+/* mkso.c -- writes a synthetic ARM32 module for so_bench to load
+ *
+ * Every export is a one instruction ARM function, every import gets a JUMP_SLOT
+ * (every fourth a GLOB_DAT instead) and .data holds a pointer table of RELATIVE
+ * relocations, so each of so_util's load stages has work proportional to the
+ * sizes asked for.
+ *
+ * usage: mkso [-e exports] [-i imports] [-h sysv|gnu|both] [-s] out.so
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "elf.h"
+#include "elf_gen.h"
+
+#define ARM_BX_LR 0xe12fff1e
+
+int main(int argc, char *argv[]) {
+	int num_exports = 1000, num_imports = 200;
+	int flags = ELF_GEN_HASH | ELF_GEN_GNU_HASH;
+	int i;
+
+	for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+		if (!strcmp(argv[i], "-e") && i + 1 < argc) {
+			num_exports = atoi(argv[++i]);
+		} else if (!strcmp(argv[i], "-i") && i + 1 < argc) {
+			num_imports = atoi(argv[++i]);
+		} else if (!strcmp(argv[i], "-h") && i + 1 < argc) {
+			i++;
+			flags &= ~(ELF_GEN_HASH | ELF_GEN_GNU_HASH);
+			if (!strcmp(argv[i], "sysv") || !strcmp(argv[i], "both"))
+				flags |= ELF_GEN_HASH;
+			if (!strcmp(argv[i], "gnu") || !strcmp(argv[i], "both"))
+				flags |= ELF_GEN_GNU_HASH;
+		} else if (!strcmp(argv[i], "-s")) {
+			flags |= ELF_GEN_SYMTAB;
+		} else {
+			break;
+		}
+	}
+
+	if (i + 1 != argc || num_exports < 0 || num_imports < 0 || !(flags & (ELF_GEN_HASH | ELF_GEN_GNU_HASH))) {
+		fprintf(stderr, "usage: %s [-e exports] [-i imports] [-h sysv|gnu|both] [-s] out.so\n", argv[0]);
+		return 1;
+	}
+
+	const char *path = argv[i];
+	const char *soname = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+	elf_gen *g = elf_gen_new(soname, flags);
+	char name[64];
+
+	for (int n = 0; n < num_exports; n++) {
+		uint32_t insn = ARM_BX_LR;
+		uint32_t vaddr = elf_gen_code(g, &insn, sizeof(insn), 'a');
+		snprintf(name, sizeof(name), "Java_com_bench_Export_%d", n);
+		elf_gen_func(g, name, vaddr, sizeof(insn), STB_GLOBAL);
+
+		// Function pointer tables are what most RELATIVE relocations in a real module are for
+		uint32_t ptr = vaddr;
+		elf_gen_relative(g, elf_gen_data(g, &ptr, sizeof(ptr)));
+	}
+
+	for (int n = 0; n < num_imports; n++) {
+		snprintf(name, sizeof(name), "import_%d", n);
+		elf_gen_import(g, name, n % 4 == 3 ? R_ARM_GLOB_DAT : R_ARM_JUMP_SLOT);
+	}
+
+	int res = elf_gen_write(g, path);
+	if (res < 0)
+		fprintf(stderr, "%s: couldn't write\n", path);
+	elf_gen_free(g);
+	return res < 0;
+}
@@ -0,0 +1,355 @@
+/* mmap_emu_test.c -- mmap_emu next to the host's real mmap
+ *
+ * File mappings have to read back what the kernel's mmap of the same range
+ * shows, zeroed past the end of the file; anonymous ones come zeroed however
+ * their memory was used before. Then what only the emulation has rules for:
+ * writes to MAP_SHARED reaching the file on unmap and nowhere past its end,
+ * partial unmaps refused without losing the mapping, read-only copies shared
+ * and cached but never once the file changed, trimming, running out of slots,
+ * and threads mapping the same range at once.
+ *
+ * usage: mmap_emu_test [-v]
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "mmap_emu.h"
+
+#define PAGE MMAP_PAGE_SIZE
+#define FILE_SIZE (20 * PAGE + 100) // past one readahead, ending mid page
+#define NUM_THREADS 4
+#define THREAD_ITERS 200
+
+static const char *path = "mmap_emu_test.bin";
+
+static uint8_t pattern(uint8_t seed, size_t i) {
+	return (i * 7 + (i >> 8) + seed) & 0xff;
+}
+
+static void write_file(uint8_t seed, size_t size) {
+	uint8_t *buf = malloc(size);
+	for (size_t i = 0; i < size; i++)
+		buf[i] = pattern(seed, i);
+	int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if (fd < 0 || write(fd, buf, size) != (ssize_t)size) {
+		fprintf(stderr, "mmap_emu_test: can't write %s\n", path);
+		exit(1);
+	}
+	close(fd);
+	free(buf);
+}
+
+// What open_hook and close_hook do around the real calls
+static int open_file(int flags) {
+	if (flags & (O_WRONLY | O_RDWR))
+		mmap_emu_invalidate(path);
+	int fd = open(path, flags);
+	if (fd >= 0)
+		mmap_emu_open(fd, path);
+	return fd;
+}
+
+static void close_file(int fd) {
+	mmap_emu_close(fd);
+	close(fd);
+}
+
+static int matches(const uint8_t *p, uint8_t seed, size_t offset, size_t length) {
+	for (size_t i = 0; i < length; i++) {
+		if (p[i] != pattern(seed, offset + i))
+			return 0;
+	}
+	return 1;
+}
+
+static int zeroed(const uint8_t *p, size_t length) {
+	for (size_t i = 0; i < length; i++) {
+		if (p[i])
+			return 0;
+	}
+	return 1;
+}
+
+// Only pages the file reaches into can be read from the real mapping, the rest would fault
+static void check_like_mmap(int fd, size_t length, int64_t offset, int prot) {
+	struct stat st;
+	fstat(fd, &st);
+	uint8_t *real = mmap(NULL, length, prot, MAP_PRIVATE, fd, offset);
+	uint8_t *emu = mmap_emu(NULL, length, prot, MMAP_PRIVATE, fd, offset);
+
+	if (real == MAP_FAILED) {
+		CHECK(emu == MMAP_FAILED);
+		if (emu != MMAP_FAILED)
+			munmap_emu(emu, length);
+		return;
+	}
+	CHECK(emu != MMAP_FAILED);
+	if (emu != MMAP_FAILED) {
+		size_t readable = offset < st.st_size ? ALIGN_MEM(st.st_size - offset, PAGE) : 0;
+		if (readable > ALIGN_MEM(length, PAGE))
+			readable = ALIGN_MEM(length, PAGE);
+		if (memcmp(real, emu, readable)) {
+			fprintf(stderr, "mmap_emu_test: 0x%x bytes at 0x%llx differ from mmap\n", (unsigned)length, (long long)offset);
+			host_failures++;
+		}
+		CHECK(zeroed(emu + readable, ALIGN_MEM(length, PAGE) - readable));
+		CHECK(munmap_emu(emu, length) == 0);
+	}
+	munmap(real, length);
+}
+
+static void check_reads(void) {
+	static const struct {
+		size_t length;
+		int64_t offset;
+	} ranges[] = {
+		{ FILE_SIZE, 0 },
+		{ 1, 0 },
+		{ 100, 0 },
+		{ 2 * PAGE, PAGE },
+		{ 4 * PAGE, 18 * PAGE }, // runs past the end
+		{ PAGE, 24 * PAGE }, // all past the end
+		{ 0, 0 },
+		{ 100, 1 },
+		{ 100, PAGE - 1 },
+	};
+
+	int fd = open_file(O_RDONLY);
+	for (int i = 0; i < sizeof(ranges) / sizeof(*ranges); i++) {
+		check_like_mmap(fd, ranges[i].length, ranges[i].offset, PROT_READ);
+		check_like_mmap(fd, ranges[i].length, ranges[i].offset, PROT_READ | PROT_WRITE);
+	}
+
+	CHECK(mmap_emu(NULL, PAGE, PROT_READ, MMAP_PRIVATE | MMAP_FIXED, fd, 0) == MMAP_FAILED);
+	CHECK(mmap_emu(NULL, PAGE, PROT_READ, MMAP_PRIVATE, 1000, 0) == MMAP_FAILED);
+	close_file(fd);
+	CHECK(mmap_emu(NULL, PAGE, PROT_READ, MMAP_PRIVATE, fd, 0) == MMAP_FAILED); // closed, path forgotten
+}
+
+static void check_anonymous(void) {
+	for (int i = 0; i < 4; i++) {
+		uint8_t *p = mmap_emu(NULL, 10000, PROT_READ | PROT_WRITE, MMAP_PRIVATE | MMAP_ANONYMOUS, -1, 0);
+		CHECK(p != MMAP_FAILED);
+		if (p == MMAP_FAILED)
+			return;
+		CHECK(zeroed(p, ALIGN_MEM(10000, PAGE)));
+		memset(p, 0xff, 10000); // dirty memory for the next round to get back
+		CHECK(munmap_emu(p, 10000) == 0);
+	}
+}
+
+static void check_writes(void) {
+	write_file(1, FILE_SIZE);
+	int fd = open_file(O_RDWR);
+
+	// Private: the file never sees it
+	uint8_t *p = mmap_emu(NULL, FILE_SIZE, PROT_READ | PROT_WRITE, MMAP_PRIVATE, fd, 0);
+	CHECK(p != MMAP_FAILED && matches(p, 1, 0, FILE_SIZE));
+	memset(p, 0xaa, FILE_SIZE);
+	CHECK(munmap_emu(p, FILE_SIZE) == 0);
+
+	// Shared: a real mapping's writes land right away, the emulated one's on unmap
+	uint8_t *real = mmap(NULL, PAGE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	CHECK(real != MAP_FAILED);
+	memset(real, 0x11, 16);
+	munmap(real, PAGE);
+
+	p = mmap_emu(NULL, 2 * PAGE, PROT_READ | PROT_WRITE, MMAP_SHARED, fd, 19 * PAGE);
+	CHECK(p != MMAP_FAILED && p[0] == pattern(1, 19 * PAGE));
+	memset(p + 10, 0x22, 16);
+	memset(p + PAGE + 100, 0x33, 16); // past the end of the file
+	CHECK(munmap_emu(p, 2 * PAGE) == 0);
+	close_file(fd);
+
+	struct stat st;
+	CHECK(stat(path, &st) == 0 && st.st_size == FILE_SIZE);
+	uint8_t *file = malloc(FILE_SIZE);
+	fd = open(path, O_RDONLY);
+	CHECK(read(fd, file, FILE_SIZE) == FILE_SIZE);
+	close(fd);
+	for (size_t i = 0; i < FILE_SIZE; i++) {
+		uint8_t want = pattern(1, i);
+		if (i < 16)
+			want = 0x11;
+		else if (i >= 19 * PAGE + 10 && i < 19 * PAGE + 26)
+			want = 0x22;
+		if (file[i] != want) {
+			fprintf(stderr, "mmap_emu_test: file byte 0x%x is 0x%02x, expected 0x%02x\n", (unsigned)i, file[i], want);
+			host_failures++;
+			break;
+		}
+	}
+	free(file);
+}
+
+static void check_unmap(void) {
+	uint8_t *p = mmap_emu(NULL, 3 * PAGE, PROT_READ | PROT_WRITE, MMAP_PRIVATE | MMAP_ANONYMOUS, -1, 0);
+	CHECK(p != MMAP_FAILED);
+	memset(p, 0x5a, 3 * PAGE);
+
+	errno = 0;
+	CHECK(munmap_emu(p, PAGE) == -1 && errno == EINVAL);
+	CHECK(munmap_emu(p + PAGE, 2 * PAGE) == -1 && errno == EINVAL);
+	CHECK(p[0] == 0x5a && p[3 * PAGE - 1] == 0x5a); // still there
+	CHECK(munmap_emu(p, 3 * PAGE - 10) == 0); // rounds up to the whole mapping
+	errno = 0;
+	CHECK(munmap_emu(p, 3 * PAGE) == -1 && errno == EINVAL);
+}
+
+static void check_sharing(void) {
+	write_file(2, FILE_SIZE);
+	int fd = open_file(O_RDONLY);
+	int fd2 = open_file(O_RDONLY);
+
+	uint8_t *a = mmap_emu(NULL, 2 * PAGE, PROT_READ, MMAP_PRIVATE, fd, 0);
+	uint8_t *b = mmap_emu(NULL, 2 * PAGE, PROT_READ, MMAP_SHARED, fd2, 0);
+	uint8_t *c = mmap_emu(NULL, 2 * PAGE, PROT_READ, MMAP_PRIVATE, fd, PAGE);
+	uint8_t *w = mmap_emu(NULL, 2 * PAGE, PROT_READ | PROT_WRITE, MMAP_PRIVATE, fd, 0);
+	CHECK(a != MMAP_FAILED && a == b && matches(a, 2, 0, 2 * PAGE));
+	CHECK(c != MMAP_FAILED && c != a && matches(c, 2, PAGE, 2 * PAGE));
+	CHECK(w != MMAP_FAILED && w != a);
+	memset(w, 0, 2 * PAGE);
+	CHECK(matches(a, 2, 0, 2 * PAGE));
+	CHECK(munmap_emu(w, 2 * PAGE) == 0);
+	CHECK(munmap_emu(c, 2 * PAGE) == 0);
+	CHECK(munmap_emu(a, 2 * PAGE) == 0);
+	CHECK(munmap_emu(b, 2 * PAGE) == 0);
+	CHECK(munmap_emu(b, 2 * PAGE) == -1); // only cached now, not mapped
+
+	// Cached after the last unmap
+	CHECK(mmap_emu(NULL, 2 * PAGE, PROT_READ, MMAP_PRIVATE, fd, 0) == a);
+	CHECK(munmap_emu(a, 2 * PAGE) == 0);
+
+	// Resized: the cached copy is out of date
+	write_file(3, FILE_SIZE + PAGE);
+	uint8_t *p = mmap_emu(NULL, 2 * PAGE, PROT_READ, MMAP_PRIVATE, fd, 0);
+	CHECK(p != MMAP_FAILED && matches(p, 3, 0, 2 * PAGE));
+	check_like_mmap(fd, FILE_SIZE + PAGE, 0, PROT_READ);
+
+	// Same size, maybe within the same second: only opening it for writing tells
+	close_file(open_file(O_RDWR));
+	write_file(4, FILE_SIZE + PAGE);
+	uint8_t *q = mmap_emu(NULL, 2 * PAGE, PROT_READ, MMAP_PRIVATE, fd, 0);
+	CHECK(q != MMAP_FAILED && q != p && matches(q, 4, 0, 2 * PAGE));
+	CHECK(matches(p, 3, 0, 2 * PAGE)); // whoever still holds the old copy keeps it
+	CHECK(munmap_emu(p, 2 * PAGE) == 0);
+	CHECK(munmap_emu(q, 2 * PAGE) == 0);
+
+	// A MAP_SHARED writeback stales what was read before
+	uint8_t *s = mmap_emu(NULL, 2 * PAGE, PROT_READ | PROT_WRITE, MMAP_SHARED, fd, 0);
+	CHECK(s != MMAP_FAILED);
+	memset(s, 0x44, 2 * PAGE);
+	CHECK(munmap_emu(s, 2 * PAGE) == 0);
+	p = mmap_emu(NULL, 2 * PAGE, PROT_READ, MMAP_PRIVATE, fd, 0);
+	CHECK(p != MMAP_FAILED && p[0] == 0x44 && p[2 * PAGE - 1] == 0x44);
+
+	// Trimming drops cached copies, ones in use stay shared
+	mmap_emu_trim();
+	CHECK(p[PAGE] == 0x44);
+	CHECK(mmap_emu(NULL, 2 * PAGE, PROT_READ, MMAP_PRIVATE, fd2, 0) == p);
+	CHECK(munmap_emu(p, 2 * PAGE) == 0);
+	CHECK(munmap_emu(p, 2 * PAGE) == 0);
+	mmap_emu_trim();
+
+	close_file(fd);
+	close_file(fd2);
+}
+
+// A cached copy gives up its slot when every other one is in use
+static void check_slots(void) {
+	void *anon[64];
+	write_file(5, FILE_SIZE);
+	int fd = open_file(O_RDONLY);
+
+	uint8_t *cached = mmap_emu(NULL, PAGE, PROT_READ, MMAP_PRIVATE, fd, 0);
+	CHECK(cached != MMAP_FAILED && munmap_emu(cached, PAGE) == 0);
+	int n = 0;
+	while (n < 64 && (anon[n] = mmap_emu(NULL, PAGE, PROT_READ | PROT_WRITE, MMAP_PRIVATE | MMAP_ANONYMOUS, -1, 0)) != MMAP_FAILED)
+		n++;
+	CHECK(n == 64);
+	CHECK(mmap_emu(NULL, PAGE, PROT_READ, MMAP_PRIVATE, fd, 0) == MMAP_FAILED);
+	for (int i = 0; i < n; i++)
+		CHECK(munmap_emu(anon[i], PAGE) == 0);
+
+	uint8_t *p = mmap_emu(NULL, PAGE, PROT_READ, MMAP_PRIVATE, fd, 0);
+	CHECK(p != MMAP_FAILED && matches(p, 5, 0, PAGE));
+	CHECK(munmap_emu(p, PAGE) == 0);
+	close_file(fd);
+	mmap_emu_trim();
+}
+
+typedef struct {
+	int id, fd, errors;
+} worker;
+
+static void *worker_main(void *arg) {
+	worker *w = arg;
+	for (int i = 0; i < THREAD_ITERS; i++) {
+		int64_t offset = (i + w->id) % 4 * PAGE;
+		uint8_t *p = mmap_emu(NULL, 8 * PAGE, PROT_READ, MMAP_PRIVATE, w->fd, offset);
+		uint8_t *a = mmap_emu(NULL, PAGE, PROT_READ | PROT_WRITE, MMAP_PRIVATE | MMAP_ANONYMOUS, -1, 0);
+		if (p == MMAP_FAILED || a == MMAP_FAILED || !matches(p, 6, offset, 8 * PAGE) || !zeroed(a, PAGE))
+			w->errors++;
+		if (a != MMAP_FAILED) {
+			memset(a, w->id + 1, PAGE);
+			if (munmap_emu(a, PAGE))
+				w->errors++;
+		}
+		if (p != MMAP_FAILED && munmap_emu(p, 8 * PAGE))
+			w->errors++;
+	}
+	return NULL;
+}
+
+static void check_threads(void) {
+	pthread_t threads[NUM_THREADS];
+	worker workers[NUM_THREADS];
+
+	write_file(6, FILE_SIZE);
+	int fd = open_file(O_RDONLY);
+	for (int i = 0; i < NUM_THREADS; i++) {
+		workers[i] = (worker){ .id = i, .fd = fd };
+		pthread_create(&threads[i], NULL, worker_main, &workers[i]);
+	}
+	for (int i = 0; i < NUM_THREADS; i++) {
+		pthread_join(threads[i], NULL);
+		CHECK(workers[i].errors == 0);
+	}
+	close_file(fd);
+	mmap_emu_trim();
+}
+
+int main(int argc, char *argv[]) {
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-v"))
+			verbose = 1;
+		else {
+			fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	uint64_t start = host_time();
+	write_file(0, FILE_SIZE);
+	check_reads();
+	check_anonymous();
+	check_writes();
+	check_unmap();
+	check_sharing();
+	check_slots();
+	check_threads();
+	unlink(path);
+	printf("mmap_emu checked against mmap in %llu us\n", (unsigned long long)(host_time() - start));
+
+	return host_report("mmap_emu_test");
+}
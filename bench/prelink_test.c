@@ -0,0 +1,181 @@
+/* prelink_test.c -- a replayed prelink cache against a normal relocation
+ *
+ * The cache is only valid for the load address it was made at, so a child
+ * process loads the module there, relocates and resolves it the normal way,
+ * saves the cache and dumps its data segments. The parent then loads the same
+ * module at the same address, replays the cache and has to end up with the
+ * exact same bytes. Caches with the wrong key or cut short have to be refused
+ * without touching the segments.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <sys/wait.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "host.h"
+#include "elf_gen.h"
+
+#define NUM_EXPORTS 64
+#define NUM_IMPORTS 96
+
+static void *image;
+static size_t image_size;
+static so_default_dynlib *table;
+static int num_entries;
+
+static void build_module(void) {
+	elf_gen *g = elf_gen_new("libprelink.so", ELF_GEN_HASH | ELF_GEN_GNU_HASH);
+	char name[32];
+
+	for (int i = 0; i < NUM_EXPORTS; i++) {
+		uint32_t insn = 0xe12fff1e; // bx lr
+		uint32_t vaddr = elf_gen_code(g, &insn, sizeof(insn), 'a');
+		snprintf(name, sizeof(name), "export_%d", i);
+		elf_gen_func(g, name, vaddr, sizeof(insn), STB_GLOBAL);
+		elf_gen_relative(g, elf_gen_data(g, &vaddr, sizeof(vaddr)));
+	}
+
+	// Unrelocated data after the tables, which the cache doesn't cover
+	char tail[256];
+	for (int i = 0; i < sizeof(tail); i++)
+		tail[i] = i;
+	elf_gen_data(g, tail, sizeof(tail));
+
+	static const int types[] = { R_ARM_JUMP_SLOT, R_ARM_GLOB_DAT, R_ARM_ABS32 };
+	for (int i = 0; i < NUM_IMPORTS; i++) {
+		snprintf(name, sizeof(name), "import_%d", i % (NUM_IMPORTS - 8)); // some imported twice
+		elf_gen_import(g, name, types[i % 3]);
+	}
+
+	image = elf_gen_image(g, &image_size);
+	elf_gen_free(g);
+
+	table = calloc(NUM_IMPORTS, sizeof(so_default_dynlib));
+	for (int i = 0; i < NUM_IMPORTS - 8; i++) {
+		snprintf(name, sizeof(name), "import_%d", i);
+		table[num_entries].symbol = strdup(name);
+		table[num_entries].func = 0x10000000 + i * 0x10;
+		num_entries++;
+	}
+}
+
+static size_t data_bytes(so_module *mod) {
+	size_t size = 0;
+	for (int i = 0; i < mod->n_data; i++)
+		size += mod->data_size[i];
+	return size;
+}
+
+static void data_copy(so_module *mod, uint8_t *dst) {
+	for (int i = 0; i < mod->n_data; i++) {
+		memcpy(dst, (void *)mod->data_base[i], mod->data_size[i]);
+		dst += mod->data_size[i];
+	}
+}
+
+// The normal path, run in a child so the parent can map the module at the same address
+static int relocate_child(uintptr_t load_addr, const char *cache, const char *dump) {
+	so_module mod;
+	uint8_t key[SO_KEY_SIZE];
+
+	if (so_mem_load(&mod, image, image_size, load_addr) < 0)
+		return 1;
+	so_relocate(&mod);
+	so_resolve(&mod, table, num_entries * sizeof(so_default_dynlib), 1);
+	so_prelink_key(&mod, table, num_entries * sizeof(so_default_dynlib), key);
+	if (so_prelink_save(&mod, cache, key) < 0)
+		return 1;
+
+	size_t size = data_bytes(&mod);
+	uint8_t *data = malloc(size);
+	data_copy(&mod, data);
+	FILE *f = fopen(dump, "wb");
+	if (!f || fwrite(data, size, 1, f) != 1)
+		return 1;
+	fclose(f);
+	return 0;
+}
+
+static void truncate_copy(const char *src, const char *dst, long size) {
+	FILE *in = fopen(src, "rb"), *out = fopen(dst, "wb");
+	uint8_t *buf = malloc(size);
+	if (in && out && fread(buf, size, 1, in) == 1)
+		fwrite(buf, size, 1, out);
+	if (in)
+		fclose(in);
+	if (out)
+		fclose(out);
+	free(buf);
+}
+
+int main(int argc, char *argv[]) {
+	char cache[64], dump[64], cut[64];
+	snprintf(cache, sizeof(cache), "prelink_test_%d.bin", getpid());
+	snprintf(dump, sizeof(dump), "prelink_test_%d.dump", getpid());
+	snprintf(cut, sizeof(cut), "prelink_test_%d.cut", getpid());
+
+	build_module();
+	const Elf32_Ehdr *ehdr = image;
+	uintptr_t load_addr = host_pick_load_addr(host_so_extent(ehdr, (const Elf32_Phdr *)((uint8_t *)image + ehdr->e_phoff)));
+
+	fflush(stdout);
+	pid_t pid = fork();
+	if (pid == 0)
+		_exit(relocate_child(load_addr, cache, dump));
+	int status = 0;
+	if (pid < 0 || waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+		fprintf(stderr, "prelink_test: the relocating child failed\n");
+		return 1;
+	}
+
+	so_module mod;
+	uint8_t key[SO_KEY_SIZE], wrong_key[SO_KEY_SIZE];
+	CHECK(so_mem_load(&mod, image, image_size, load_addr) == 0);
+	so_prelink_key(&mod, table, num_entries * sizeof(so_default_dynlib), key);
+
+	size_t size = data_bytes(&mod);
+	uint8_t *pristine = malloc(size), *replayed = malloc(size), *expected = malloc(size);
+	data_copy(&mod, pristine);
+
+	FILE *f = fopen(dump, "rb");
+	CHECK(f && fread(expected, size, 1, f) == 1);
+	if (f)
+		fclose(f);
+
+	// Another native address for one import makes it a different cache
+	table[3].func += 4;
+	so_prelink_key(&mod, table, num_entries * sizeof(so_default_dynlib), wrong_key);
+	table[3].func -= 4;
+	CHECK(memcmp(key, wrong_key, SO_KEY_SIZE) != 0);
+	CHECK(so_prelink_load(&mod, cache, wrong_key) == -1);
+	data_copy(&mod, replayed);
+	CHECK(memcmp(replayed, pristine, size) == 0);
+
+	// A cache cut short fails on the read, before any segment is written
+	truncate_copy(cache, cut, sizeof(uint32_t) * 8 + SO_KEY_SIZE + 16);
+	CHECK(so_prelink_load(&mod, cut, key) == -2);
+	data_copy(&mod, replayed);
+	CHECK(memcmp(replayed, pristine, size) == 0);
+
+	CHECK(so_prelink_load(&mod, cache, key) == 0);
+	data_copy(&mod, replayed);
+	CHECK(memcmp(replayed, expected, size) == 0);
+	CHECK(memcmp(replayed, pristine, size) != 0);
+
+	for (size_t i = 0; i < size; i++) {
+		if (replayed[i] != expected[i]) {
+			fprintf(stderr, "prelink_test: first difference at data byte 0x%zx\n", i);
+			break;
+		}
+	}
+
+	unlink(cache);
+	unlink(dump);
+	unlink(cut);
+	return host_report("prelink_test");
+}
@@ -0,0 +1,159 @@
+/* pthread_pool_bench.c -- pooled pthread objects against calloc under contention
+ *
+ * Every thread churns through sync objects the way the game does: create and
+ * init a mutex and a cond, lock and unlock the mutex, and destroy the oldest
+ * pair once it holds more than a small window of them. Each object carries
+ * the id of the thread that got it, so an object handed out twice shows up
+ * as a wrong owner. The same run goes through obj_pool and through the
+ * calloc/free the shims used before, at 1 to -t threads.
+ *
+ * usage: pthread_pool_bench [-v] [-n ops per thread] [-t max threads]
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "obj_pool.h"
+
+#define WINDOW 16
+#define MAX_THREADS 64
+
+// main.c's pthread_obj, plus the owner tag
+typedef struct {
+	union {
+		pthread_mutex_t mutex;
+		pthread_mutexattr_t mutexattr;
+		pthread_cond_t cond;
+		pthread_condattr_t condattr;
+		pthread_attr_t attr;
+	};
+	uint32_t owner;
+} bench_obj;
+
+static obj_pool pool = OBJ_POOL(sizeof(bench_obj));
+static int go; // released once every thread is up, so they all contend from the start
+
+typedef struct {
+	int id, use_pool, ops;
+	int wrong_owner, failed;
+} worker;
+
+static bench_obj *obj_new(worker *w, uint32_t owner) {
+	bench_obj *o = w->use_pool ? obj_pool_alloc(&pool) : calloc(1, sizeof(bench_obj));
+	if (o)
+		o->owner = owner;
+	return o;
+}
+
+static void obj_delete(worker *w, bench_obj *o, uint32_t owner) {
+	if (o->owner != owner)
+		w->wrong_owner++;
+	if (w->use_pool)
+		obj_pool_free(&pool, o);
+	else
+		free(o);
+}
+
+static void *worker_main(void *arg) {
+	worker *w = arg;
+	bench_obj *mutexes[WINDOW], *conds[WINDOW];
+	uint32_t owners[WINDOW];
+
+	while (!__atomic_load_n(&go, __ATOMIC_ACQUIRE))
+		sched_yield();
+	for (int i = 0; i < w->ops; i++) {
+		int slot = i % WINDOW;
+		if (i >= WINDOW) {
+			pthread_mutex_destroy(&mutexes[slot]->mutex);
+			pthread_cond_destroy(&conds[slot]->cond);
+			obj_delete(w, mutexes[slot], owners[slot]);
+			obj_delete(w, conds[slot], owners[slot] | 0x80000000);
+		}
+
+		owners[slot] = (w->id << 24) | (i & 0xffffff);
+		mutexes[slot] = obj_new(w, owners[slot]);
+		conds[slot] = obj_new(w, owners[slot] | 0x80000000);
+		if (!mutexes[slot] || !conds[slot]) {
+			w->failed = 1;
+			return NULL;
+		}
+		pthread_mutex_init(&mutexes[slot]->mutex, NULL);
+		pthread_cond_init(&conds[slot]->cond, NULL);
+		pthread_mutex_lock(&mutexes[slot]->mutex);
+		pthread_mutex_unlock(&mutexes[slot]->mutex);
+	}
+
+	for (int i = 0; i < WINDOW && i < w->ops; i++) {
+		pthread_mutex_destroy(&mutexes[i]->mutex);
+		pthread_cond_destroy(&conds[i]->cond);
+		obj_delete(w, mutexes[i], owners[i]);
+		obj_delete(w, conds[i], owners[i] | 0x80000000);
+	}
+	return NULL;
+}
+
+// Nanoseconds per create/destroy pair, over all threads
+static double run(int num_threads, int use_pool, int ops) {
+	pthread_t threads[MAX_THREADS];
+	worker workers[MAX_THREADS];
+	__atomic_store_n(&go, 0, __ATOMIC_RELAXED);
+	for (int i = 0; i < num_threads; i++) {
+		workers[i] = (worker){ .id = i + 1, .use_pool = use_pool, .ops = ops };
+		if (pthread_create(&threads[i], NULL, worker_main, &workers[i]) != 0) {
+			fprintf(stderr, "pthread_pool_bench: pthread_create failed\n");
+			exit(1);
+		}
+	}
+
+	uint64_t t0 = host_time();
+	__atomic_store_n(&go, 1, __ATOMIC_RELEASE);
+	for (int i = 0; i < num_threads; i++)
+		pthread_join(threads[i], NULL);
+	uint64_t us = host_time() - t0;
+
+	for (int i = 0; i < num_threads; i++) {
+		CHECK(!workers[i].failed);
+		CHECK(workers[i].wrong_owner == 0);
+	}
+	return us * 1000.0 / ((double)ops * num_threads);
+}
+
+int main(int argc, char *argv[]) {
+	int ops = 100000, max_threads = 8;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-v"))
+			verbose = 1;
+		else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			ops = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+			max_threads = atoi(argv[++i]);
+		else {
+			fprintf(stderr, "usage: %s [-v] [-n ops per thread] [-t max threads]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (ops <= 0 || max_threads <= 0 || max_threads > MAX_THREADS)
+		return 1;
+
+	for (int t = 1; t <= max_threads; t *= 2) {
+		double calloc_ns = run(t, 0, ops);
+		double pool_ns = run(t, 1, ops);
+		printf("%2d threads: calloc %.1f ns, obj_pool %.1f ns per mutex+cond\n", t, calloc_ns, pool_ns);
+	}
+
+	// Freed objects get reused: the pool never grew past what was live at once
+	int peak = 2 * WINDOW * max_threads;
+	printf("obj_pool: %d slabs of %d objects for at most %d live\n", pool.num_slabs, OBJ_POOL_SLAB, peak);
+	CHECK(pool.num_slabs * OBJ_POOL_SLAB >= 2 * WINDOW);
+	CHECK(pool.num_slabs <= peak / OBJ_POOL_SLAB + max_threads);
+
+	return host_report("pthread_pool_bench");
+}
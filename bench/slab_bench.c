@@ -0,0 +1,258 @@
+/* slab_bench.c -- replaying a small-object allocation trace through slab and malloc
+ *
+ * Every thread gets its own synthetic trace shaped like the engine's traffic:
+ * mostly strings and script objects under 256 bytes, some up to the slab limit
+ * and a few large blocks, allocated into and freed out of a window of live
+ * slots. The same traces run through the wrappers' slab-then-heap path and
+ * through plain malloc/free, at 1 to -t threads. Each block carries its owner
+ * in its first and last word, so two live blocks sharing memory show up.
+ *
+ * Threads leave the way the game's do: some call slab_thread_exit, some just
+ * return, and some hand their live blocks to the main thread to free. Once
+ * everything is back, slab_trim has to give every span up.
+ *
+ * usage: slab_bench [-v] [-n ops per thread] [-t max threads]
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "slab.h"
+
+#define LIVE 1024
+#define MAX_THREADS 64
+
+typedef struct {
+	uint16_t slot;
+	uint32_t size; // 0 frees the slot
+} trace_op;
+
+typedef struct {
+	int id, use_slab, num_ops;
+	trace_op *ops;
+	uint32_t *live[LIVE];
+	uint32_t sizes[LIVE];
+	void *probe; // the first slab block it got, gone once slab_trim is done
+	int errors;
+} worker;
+
+static int go; // released once every thread is up
+
+static uint32_t pick_size(unsigned *seed) {
+	int r = rand_r(seed) % 100;
+	if (r < 60)
+		return rand_r(seed) % 57 + 8;
+	if (r < 85)
+		return rand_r(seed) % 192 + 65;
+	if (r < 97)
+		return rand_r(seed) % (SLAB_MAX - 256) + 257;
+	return rand_r(seed) % 15360 + SLAB_MAX + 1;
+}
+
+static trace_op *make_trace(int id, int num_ops) {
+	trace_op *ops = malloc(num_ops * sizeof(trace_op));
+	uint8_t used[LIVE] = { 0 };
+	unsigned seed = id * 7919;
+
+	for (int i = 0; i < num_ops; i++) {
+		int slot = rand_r(&seed) % LIVE;
+		ops[i].slot = slot;
+		ops[i].size = used[slot] ? 0 : pick_size(&seed);
+		used[slot] = !used[slot];
+	}
+	return ops;
+}
+
+// The same routing as __wrap_malloc and __wrap_free
+static void *bench_alloc(worker *w, uint32_t size) {
+	void *p = w->use_slab ? slab_alloc(size) : NULL;
+	if (!p)
+		return malloc(size);
+	if (slab_usable_size(p) < size || ((uintptr_t)p & (SLAB_ALIGN - 1)))
+		w->errors++;
+	if (!w->probe)
+		w->probe = p;
+	return p;
+}
+
+static void bench_free(worker *w, void *p) {
+	int from_slab = slab_usable_size(p) != 0;
+	if (!w->use_slab) {
+		free(p);
+		return;
+	}
+	if (slab_free(p) != from_slab)
+		w->errors++;
+	if (!from_slab)
+		free(p);
+}
+
+static void tag(uint32_t *p, uint32_t size, uint32_t owner) {
+	p[0] = owner;
+	p[size / 4 - 1] = owner;
+}
+
+static int tagged(uint32_t *p, uint32_t size, uint32_t owner) {
+	return p[0] == owner && p[size / 4 - 1] == owner;
+}
+
+static void *worker_main(void *arg) {
+	worker *w = arg;
+
+	while (!__atomic_load_n(&go, __ATOMIC_ACQUIRE))
+		sched_yield();
+	for (int i = 0; i < w->num_ops; i++) {
+		int slot = w->ops[i].slot;
+		uint32_t owner = (w->id << 16) | slot;
+		if (w->ops[i].size) {
+			uint32_t *p = bench_alloc(w, w->ops[i].size);
+			if (!p) {
+				w->errors++;
+				return NULL;
+			}
+			tag(p, w->ops[i].size, owner);
+			w->live[slot] = p;
+			w->sizes[slot] = w->ops[i].size;
+		} else {
+			if (!tagged(w->live[slot], w->sizes[slot], owner))
+				w->errors++;
+			bench_free(w, w->live[slot]);
+			w->live[slot] = NULL;
+		}
+	}
+
+	// Every third thread leaves its blocks to the main thread
+	if (w->id % 3 == 2)
+		return NULL;
+	for (int slot = 0; slot < LIVE; slot++) {
+		if (w->live[slot]) {
+			if (!tagged(w->live[slot], w->sizes[slot], (w->id << 16) | slot))
+				w->errors++;
+			bench_free(w, w->live[slot]);
+			w->live[slot] = NULL;
+		}
+	}
+	if (w->use_slab && w->id % 3 == 0)
+		slab_thread_exit();
+	return NULL;
+}
+
+// Nanoseconds per trace op, over all threads
+static double run(worker *workers, int num_threads, int use_slab, void **probes, int *num_probes) {
+	pthread_t threads[MAX_THREADS];
+
+	__atomic_store_n(&go, 0, __ATOMIC_RELAXED);
+	for (int i = 0; i < num_threads; i++) {
+		worker *w = &workers[i];
+		w->use_slab = use_slab;
+		w->probe = NULL;
+		w->errors = 0;
+		if (pthread_create(&threads[i], NULL, worker_main, w) != 0) {
+			fprintf(stderr, "slab_bench: pthread_create failed\n");
+			exit(1);
+		}
+	}
+
+	uint64_t t0 = host_time();
+	__atomic_store_n(&go, 1, __ATOMIC_RELEASE);
+	for (int i = 0; i < num_threads; i++)
+		pthread_join(threads[i], NULL);
+	uint64_t us = host_time() - t0;
+
+	// Blocks freed by a thread that didn't allocate them
+	for (int i = 0; i < num_threads; i++) {
+		worker *w = &workers[i];
+		for (int slot = 0; slot < LIVE; slot++) {
+			if (w->live[slot]) {
+				if (!tagged(w->live[slot], w->sizes[slot], (w->id << 16) | slot))
+					w->errors++;
+				bench_free(w, w->live[slot]);
+				w->live[slot] = NULL;
+			}
+		}
+		CHECK(w->errors == 0);
+		if (w->probe)
+			probes[(*num_probes)++] = w->probe;
+	}
+	return us * 1000.0 / ((double)workers[0].num_ops * num_threads);
+}
+
+static void check_sizes(void) {
+	for (size_t size = 0; size <= SLAB_MAX; size++) {
+		void *p = slab_alloc(size);
+		size_t usable = slab_usable_size(p);
+		CHECK(p && usable >= size && ((uintptr_t)p & (SLAB_ALIGN - 1)) == 0);
+		CHECK(slab_free(p) == 1);
+	}
+	CHECK(slab_alloc(SLAB_MAX + 1) == NULL);
+
+	void *heap = malloc(64);
+	CHECK(slab_usable_size(heap) == 0);
+	CHECK(slab_free(heap) == 0);
+	free(heap);
+}
+
+int main(int argc, char *argv[]) {
+	int num_ops = 200000, max_threads = 8;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-v"))
+			verbose = 1;
+		else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			num_ops = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+			max_threads = atoi(argv[++i]);
+		else {
+			fprintf(stderr, "usage: %s [-v] [-n ops per thread] [-t max threads]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (num_ops <= 0 || max_threads <= 0 || max_threads > MAX_THREADS)
+		return 1;
+
+	CHECK(slab_alloc(16) == NULL); // not before slab_init
+	slab_init();
+	check_sizes();
+
+	worker *workers = calloc(max_threads, sizeof(worker));
+	for (int i = 0; i < max_threads; i++) {
+		workers[i].id = i;
+		workers[i].num_ops = num_ops;
+		workers[i].ops = make_trace(i, num_ops);
+	}
+
+	void **probes = calloc(2 * max_threads, sizeof(void *));
+	int num_probes = 0;
+	for (int t = 1; t <= max_threads; t *= 2) {
+		double malloc_ns = run(workers, t, 0, probes, &num_probes);
+		double slab_ns = run(workers, t, 1, probes, &num_probes);
+		printf("%2d threads: malloc %.1f ns, slab %.1f ns per op\n", t, malloc_ns, slab_ns);
+	}
+	if (verbose)
+		slab_stats();
+
+	// Everything is free and the workers are gone, reaped or not: no span stays
+	slab_thread_exit();
+	slab_trim();
+	CHECK(num_probes > 0);
+	for (int i = 0; i < num_probes; i++)
+		CHECK(slab_usable_size(probes[i]) == 0);
+
+	void *p = slab_alloc(100);
+	CHECK(p && slab_usable_size(p) >= 100);
+	CHECK(slab_free(p) == 1);
+
+	for (int i = 0; i < max_threads; i++)
+		free(workers[i].ops);
+	free(workers);
+	free(probes);
+
+	return host_report("slab_bench");
+}
@@ -0,0 +1,101 @@
+/* so_bench.c -- times so_util's load stages on ARM32 .so files, on the host
+ *
+ * Each module is parsed and mapped, relocated, resolved and has every export
+ * looked up, through the same so_util code the loader runs on the Vita. Nothing
+ * in the modules is executed. Imports get bound against a table built from the
+ * module's own undefined symbols, standing in for the loader's default_dynlib.
+ *
+ * usage: so_bench [-v] [-n lookup_rounds] lib.so...
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <vitasdk.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "so_util.h"
+#include "so_backend.h"
+#include "host.h"
+
+static int so_bench(const char *path, int rounds) {
+	const so_backend *b = &so_posix_backend;
+	so_module *mod = calloc(1, sizeof(so_module));
+	if (!mod)
+		return -1;
+
+	uint64_t start = b->time();
+	if (host_so_file_load(mod, path) < 0) {
+		fprintf(stderr, "%s: failed to load\n", path);
+		return -1;
+	}
+	uint64_t parse_us = b->time() - start;
+
+	start = b->time();
+	so_relocate(mod);
+	uint64_t relocate_us = b->time() - start;
+
+	int num_imports;
+	so_default_dynlib *imports = host_import_table(mod, (uintptr_t)&ret0, &num_imports);
+	if (!imports)
+		return -1;
+	start = b->time();
+	so_resolve(mod, imports, num_imports * sizeof(so_default_dynlib), 1);
+	uint64_t resolve_us = b->time() - start;
+
+	// Every export, looked up by name the way so_symbol callers in the loader do
+	int num_exports = 0, found = 0;
+	start = b->time();
+	for (int r = 0; r < rounds; r++) {
+		for (int i = 1; i < mod->num_dynsym; i++) {
+			Elf32_Sym *sym = &mod->dynsym[i];
+			if (sym->st_shndx == SHN_UNDEF || !sym->st_name)
+				continue;
+			if (r == 0)
+				num_exports++;
+			if (so_symbol(mod, mod->dynstr + sym->st_name))
+				found++;
+		}
+	}
+	uint64_t lookup_us = b->time() - start;
+
+	printf("%s: parse %llu us, relocate %llu us, resolve %llu us (%d imports), lookup %llu us (%d exports x %d, %.1f ns each, %d found)\n",
+		path, (unsigned long long)parse_us, (unsigned long long)relocate_us, (unsigned long long)resolve_us, num_imports,
+		(unsigned long long)lookup_us, num_exports, rounds,
+		num_exports ? lookup_us * 1000.0 / ((double)num_exports * rounds) : 0.0, found);
+
+	// Modules stay mapped, so_util keeps them on its list and the table has to outlive them
+	if (found != num_exports * rounds) {
+		fprintf(stderr, "%s: %d of %d lookups failed\n", path, num_exports * rounds - found, num_exports * rounds);
+		return -1;
+	}
+	return 0;
+}
+
+int main(int argc, char *argv[]) {
+	int rounds = 100;
+	int i, failed = 0;
+
+	for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+		if (!strcmp(argv[i], "-v"))
+			verbose = 1;
+		else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			rounds = atoi(argv[++i]);
+		else
+			break;
+	}
+
+	if (i == argc || rounds <= 0) {
+		fprintf(stderr, "usage: %s [-v] [-n lookup_rounds] lib.so...\n", argv[0]);
+		return 1;
+	}
+
+	for (; i < argc; i++) {
+		if (so_bench(argv[i], rounds) < 0)
+			failed = 1;
+	}
+
+	return failed;
+}
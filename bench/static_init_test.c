@@ -0,0 +1,234 @@
+/* static_init_test.c -- racing first uses of Bionic static mutexes and conds
+ *
+ * Every round resets a set of mutexes to Bionic's static initializer tags
+ * and conds to NULL, then lets all threads at them at once, each starting at
+ * a different one. Whoever wins a slot, every thread has to end up with the
+ * same object, locking it has to exclude the others, the recursive ones have
+ * to stay recursive, and racing losers have to give their objects back.
+ * obj_pool itself is then hammered with random batches of tagged objects.
+ *
+ * usage: static_init_test [-v] [-n rounds] [-t threads]
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "pthread_static.h"
+
+#define SLOTS 24
+#define MAX_THREADS 32
+#define POOL_ITERS 20000
+#define POOL_BATCH 8
+
+static pthread_mutex_t *mutexes[SLOTS];
+static pthread_cond_t *conds[SLOTS];
+static int counters[SLOTS]; // only ever touched under the slot's mutex
+
+static int num_threads, round_start, round_done;
+
+typedef struct {
+	int id;
+	pthread_mutex_t *seen_mutex[SLOTS];
+	pthread_cond_t *seen_cond[SLOTS];
+	int errors;
+} worker;
+
+static worker workers[MAX_THREADS];
+
+static uintptr_t slot_type(int slot) {
+	static const uintptr_t types[] = { MUTEX_TYPE_NORMAL, MUTEX_TYPE_RECURSIVE, MUTEX_TYPE_ERRORCHECK };
+	return types[slot % 3];
+}
+
+static void use_slots(worker *w) {
+	for (int k = 0; k < SLOTS; k++) {
+		int i = (k + w->id * 5) % SLOTS;
+		pthread_mutex_t *m = init_static_mutex(&mutexes[i]);
+		w->seen_mutex[i] = m;
+		if (!m || (uintptr_t)m <= MUTEX_TYPE_ERRORCHECK) {
+			w->errors++;
+			continue;
+		}
+
+		pthread_mutex_lock(m);
+		int held = counters[i];
+		sched_yield(); // let others run into the held lock
+		counters[i] = held + 1;
+		// Only the recursive ones may be taken again by their owner
+		int relock = pthread_mutex_trylock(m);
+		if ((relock == 0) != (slot_type(i) == MUTEX_TYPE_RECURSIVE))
+			w->errors++;
+		if (relock == 0)
+			pthread_mutex_unlock(m);
+		pthread_mutex_unlock(m);
+
+		pthread_cond_t *c = init_static_cond(&conds[i]);
+		w->seen_cond[i] = c;
+		if (!c)
+			w->errors++;
+		else
+			pthread_cond_signal(c);
+	}
+}
+
+static void *static_worker(void *arg) {
+	worker *w = arg;
+	for (int r = 1;; r++) {
+		int start;
+		while ((start = __atomic_load_n(&round_start, __ATOMIC_ACQUIRE)) >= 0 && start < r)
+			sched_yield();
+		if (start < 0)
+			return NULL;
+		use_slots(w);
+		__atomic_add_fetch(&round_done, 1, __ATOMIC_ACQ_REL);
+	}
+}
+
+static int check_round(int round) {
+	int errors = 0;
+	for (int i = 0; i < SLOTS; i++) {
+		for (int t = 0; t < num_threads; t++) {
+			if (workers[t].seen_mutex[i] != mutexes[i] || workers[t].seen_cond[i] != conds[i])
+				errors++;
+		}
+		if (counters[i] != num_threads)
+			errors++;
+	}
+	for (int t = 0; t < num_threads; t++) {
+		errors += workers[t].errors;
+		workers[t].errors = 0;
+	}
+	if (errors)
+		fprintf(stderr, "static_init_test: round %d, %d errors\n", round, errors);
+	return errors;
+}
+
+static void reset_slots(void) {
+	for (int i = 0; i < SLOTS; i++) {
+		if ((uintptr_t)mutexes[i] > MUTEX_TYPE_ERRORCHECK) {
+			pthread_mutex_destroy(mutexes[i]);
+			obj_pool_free(&pthread_pool, mutexes[i]);
+		}
+		if (conds[i]) {
+			pthread_cond_destroy(conds[i]);
+			obj_pool_free(&pthread_pool, conds[i]);
+		}
+		mutexes[i] = (pthread_mutex_t *)slot_type(i);
+		conds[i] = NULL;
+		counters[i] = 0;
+	}
+}
+
+// Random batches, every word of an object tagged with its owner until it's freed
+static void *pool_worker(void *arg) {
+	worker *w = arg;
+	uint32_t *batch[POOL_BATCH];
+	unsigned seed = w->id;
+
+	for (int i = 0; i < POOL_ITERS; i++) {
+		int n = rand_r(&seed) % POOL_BATCH + 1;
+		uint32_t tag = (w->id << 24) | (i & 0xffffff);
+		for (int j = 0; j < n; j++) {
+			batch[j] = obj_pool_alloc(&pthread_pool);
+			if (!batch[j]) {
+				w->errors++;
+				return NULL;
+			}
+			for (int k = 0; k < sizeof(pthread_obj) / 4; k++) {
+				if (batch[j][k])
+					w->errors++; // not zeroed, or someone else's
+				batch[j][k] = tag + j;
+			}
+		}
+		if (i % 64 == 0)
+			sched_yield();
+		for (int j = n - 1; j >= 0; j--) {
+			for (int k = 0; k < sizeof(pthread_obj) / 4; k++) {
+				if (batch[j][k] != tag + j)
+					w->errors++;
+			}
+			obj_pool_free(&pthread_pool, batch[j]);
+		}
+	}
+	return NULL;
+}
+
+int main(int argc, char *argv[]) {
+	int rounds = 300;
+	pthread_t threads[MAX_THREADS];
+
+	num_threads = 8;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-v"))
+			verbose = 1;
+		else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			rounds = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+			num_threads = atoi(argv[++i]);
+		else {
+			fprintf(stderr, "usage: %s [-v] [-n rounds] [-t threads]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (rounds <= 0 || num_threads <= 0 || num_threads > MAX_THREADS)
+		return 1;
+
+	reset_slots();
+	for (int t = 0; t < num_threads; t++) {
+		workers[t].id = t;
+		if (pthread_create(&threads[t], NULL, static_worker, &workers[t]) != 0) {
+			fprintf(stderr, "static_init_test: pthread_create failed\n");
+			return 1;
+		}
+	}
+
+	uint64_t start = host_time();
+	int failed_rounds = 0;
+	for (int r = 1; r <= rounds; r++) {
+		__atomic_store_n(&round_done, 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&round_start, r, __ATOMIC_RELEASE);
+		while (__atomic_load_n(&round_done, __ATOMIC_ACQUIRE) < num_threads)
+			sched_yield();
+		failed_rounds += check_round(r) != 0;
+
+		// Initialized: no more allocations, the same object every time
+		int slabs = pthread_pool.num_slabs;
+		for (int i = 0; i < SLOTS; i++)
+			CHECK(init_static_mutex(&mutexes[i]) == mutexes[i] && init_static_cond(&conds[i]) == conds[i]);
+		CHECK(pthread_pool.num_slabs == slabs);
+		reset_slots();
+	}
+	__atomic_store_n(&round_start, -1, __ATOMIC_RELEASE);
+	for (int t = 0; t < num_threads; t++)
+		pthread_join(threads[t], NULL);
+	CHECK(failed_rounds == 0);
+	uint64_t static_us = host_time() - start;
+
+	// Losers' objects went back: nothing grows with the number of rounds
+	int static_slabs = pthread_pool.num_slabs;
+	CHECK(static_slabs * OBJ_POOL_SLAB <= 2 * SLOTS + 2 * num_threads + OBJ_POOL_SLAB * num_threads);
+
+	start = host_time();
+	for (int t = 0; t < num_threads; t++) {
+		workers[t].errors = 0;
+		pthread_create(&threads[t], NULL, pool_worker, &workers[t]);
+	}
+	for (int t = 0; t < num_threads; t++) {
+		pthread_join(threads[t], NULL);
+		CHECK(workers[t].errors == 0);
+	}
+	uint64_t pool_us = host_time() - start;
+	CHECK(pthread_pool.num_slabs * OBJ_POOL_SLAB <= static_slabs * OBJ_POOL_SLAB + POOL_BATCH * num_threads + OBJ_POOL_SLAB * num_threads);
+
+	printf("%d threads: %d rounds over %d slots in %llu us, %d pool batches each in %llu us, %d slabs\n", num_threads, rounds,
+		SLOTS, (unsigned long long)static_us, POOL_ITERS, (unsigned long long)pool_us, pthread_pool.num_slabs);
+
+	return host_report("static_init_test");
+}
@@ -0,0 +1,177 @@
+/* symtab_test.c -- the profiler's reverse symbol index
+ *
+ * symtab_lookup against hand-made dynsyms covering aliases, Thumb bits, gaps
+ * after sized functions and unsized ones running up to the next symbol, then
+ * against a linear scan over a large random table, and finally through
+ * so_addr_symbol over two loaded modules.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "elf_gen.h"
+#include "symtab.h"
+
+#define BASE 0x81000000
+
+static const char strtab[] = "\0a\0a_alias\0thumb\0unsized\0object\0import\0last";
+enum { S_A = 1, S_A_ALIAS = 3, S_THUMB = 11, S_UNSIZED = 17, S_OBJECT = 25, S_IMPORT = 32, S_LAST = 39 };
+
+static const Elf32_Sym syms[] = {
+	{ 0 },
+	{ S_LAST, 0x400, 8, ELF32_ST_INFO(STB_GLOBAL, STT_FUNC), 0, 1 },
+	{ S_A_ALIAS, 0x100, 0, ELF32_ST_INFO(STB_WEAK, STT_FUNC), 0, 1 },
+	{ S_A, 0x100, 0x20, ELF32_ST_INFO(STB_GLOBAL, STT_FUNC), 0, 1 },
+	{ S_THUMB, 0x201, 0x10, ELF32_ST_INFO(STB_GLOBAL, STT_FUNC), 0, 1 },
+	{ S_UNSIZED, 0x300, 0, ELF32_ST_INFO(STB_GLOBAL, STT_FUNC), 0, 1 },
+	{ S_OBJECT, 0x150, 0x10, ELF32_ST_INFO(STB_GLOBAL, STT_OBJECT), 0, 2 },
+	{ S_IMPORT, 0, 0, ELF32_ST_INFO(STB_GLOBAL, STT_FUNC), 0, SHN_UNDEF },
+};
+
+static const struct {
+	uint32_t offset;
+	const char *name; // NULL: no function there
+} lookups[] = {
+	{ 0x0ff, NULL },
+	{ 0x100, "a" }, // the sized alias wins
+	{ 0x11f, "a" },
+	{ 0x120, NULL },
+	{ 0x150, NULL }, // objects aren't functions
+	{ 0x200, "thumb" },
+	{ 0x201, "thumb" },
+	{ 0x20f, "thumb" },
+	{ 0x210, NULL },
+	{ 0x300, "unsized" },
+	{ 0x3ff, "unsized" },
+	{ 0x400, "last" },
+	{ 0x407, "last" },
+	{ 0x408, NULL },
+};
+
+// Reference: the highest function at or below addr, NULL past a sized one's end
+static const char *linear_lookup(const Elf32_Sym *s, int n, const char *names, uintptr_t addr, uint32_t *start) {
+	const Elf32_Sym *best = NULL;
+	for (int i = 0; i < n; i++) {
+		if (ELF32_ST_TYPE(s[i].st_info) != STT_FUNC || s[i].st_shndx == SHN_UNDEF || (s[i].st_value & ~1) > addr - BASE)
+			continue;
+		if (!best || (s[i].st_value & ~1) > (best->st_value & ~1))
+			best = &s[i];
+	}
+	if (!best || (best->st_size && addr - BASE >= (best->st_value & ~1) + best->st_size))
+		return NULL;
+	*start = best->st_value & ~1;
+	return names + best->st_name;
+}
+
+static void check_random(void) {
+	int n = 5000;
+	Elf32_Sym *s = calloc(n, sizeof(Elf32_Sym));
+	char *names = malloc(n * 8);
+	uint32_t addr = 0x1000;
+
+	srand(1234);
+	for (int i = 0; i < n; i++) {
+		snprintf(names + i * 8, 8, "f%d", i);
+		s[i].st_name = i * 8;
+		s[i].st_value = addr | (rand() & 1);
+		s[i].st_size = rand() % 4 ? (rand() % 16 + 1) * 4 : 0;
+		s[i].st_info = ELF32_ST_INFO(STB_GLOBAL, STT_FUNC);
+		s[i].st_shndx = 1;
+		addr += s[i].st_size + (rand() % 4) * 4 + 4;
+	}
+	// Shuffled, dynsym isn't in address order
+	for (int i = n - 1; i > 0; i--) {
+		int j = rand() % (i + 1);
+		Elf32_Sym t = s[i];
+		s[i] = s[j];
+		s[j] = t;
+	}
+
+	symtab t;
+	CHECK(symtab_build(&t, s, n, names, BASE) == 0);
+	CHECK(t.num_entries == n);
+	int mismatches = 0;
+	for (uint32_t a = BASE; a < BASE + addr + 16; a += 2) {
+		uint32_t start = 0;
+		const char *expected = linear_lookup(s, n, names, a, &start);
+		const symtab_entry *e = symtab_lookup(&t, a);
+		if ((e == NULL) != (expected == NULL) || (e && (strcmp(e->name, expected) || e->addr != BASE + start)))
+			mismatches++;
+	}
+	CHECK(mismatches == 0);
+	symtab_free(&t);
+	CHECK(t.entries == NULL && t.num_entries == 0);
+
+	free(s);
+	free(names);
+}
+
+static so_module *load_module(const char *soname, const char *prefix, uint32_t *vaddrs, int n) {
+	elf_gen *g = elf_gen_new(soname, ELF_GEN_GNU_HASH);
+	char name[32];
+	for (int i = 0; i < n; i++) {
+		uint32_t code[4] = { 0xe1a00000, 0xe1a00000, 0xe1a00000, 0xe12fff1e }; // nop x3; bx lr
+		vaddrs[i] = elf_gen_code(g, code, sizeof(code), 'a');
+		snprintf(name, sizeof(name), "%s_%d", prefix, i);
+		elf_gen_func(g, name, vaddrs[i], sizeof(code), STB_GLOBAL);
+	}
+	uint32_t value = 0;
+	elf_gen_data(g, &value, sizeof(value));
+
+	size_t size;
+	void *image = elf_gen_image(g, &size);
+	elf_gen_free(g);
+
+	so_module *mod = calloc(1, sizeof(so_module));
+	if (!image || !mod || host_so_mem_load(mod, image, size) < 0) {
+		fprintf(stderr, "symtab_test: failed to load %s\n", soname);
+		exit(1);
+	}
+	return mod;
+}
+
+int main(int argc, char *argv[]) {
+	symtab t;
+	CHECK(symtab_build(&t, syms, sizeof(syms) / sizeof(*syms), strtab, BASE) == 0);
+	CHECK(t.num_entries == 4);
+	for (int i = 1; i < t.num_entries; i++)
+		CHECK(t.entries[i - 1].addr < t.entries[i].addr);
+
+	for (int i = 0; i < sizeof(lookups) / sizeof(*lookups); i++) {
+		const symtab_entry *e = symtab_lookup(&t, BASE + lookups[i].offset);
+		const char *name = e ? e->name : NULL;
+		if ((name == NULL) != (lookups[i].name == NULL) || (name && strcmp(name, lookups[i].name))) {
+			fprintf(stderr, "symtab_test: 0x%x found %s, expected %s\n", lookups[i].offset, name ? name : "nothing",
+				lookups[i].name ? lookups[i].name : "nothing");
+			host_failures++;
+		}
+	}
+	symtab_free(&t);
+
+	CHECK(symtab_build(&t, syms, 1, strtab, BASE) == 0);
+	CHECK(t.num_entries == 0);
+	CHECK(symtab_lookup(&t, BASE + 0x100) == NULL);
+	symtab_free(&t);
+
+	check_random();
+
+	// The same lookups from a sampled PC, across modules
+	uint32_t vaddrs_a[8], vaddrs_b[8];
+	so_module *a = load_module("libsyma.so", "alpha", vaddrs_a, 8);
+	so_module *b = load_module("libsymb.so", "beta", vaddrs_b, 8);
+	so_module *owner;
+	const symtab_entry *e = so_addr_symbol(a->text_base + vaddrs_a[3] + 8, &owner);
+	CHECK(e && !strcmp(e->name, "alpha_3") && owner == a);
+	e = so_addr_symbol(b->text_base + vaddrs_b[7] + 12, &owner);
+	CHECK(e && !strcmp(e->name, "beta_7") && owner == b);
+	CHECK(so_addr_symbol(b->text_base + vaddrs_b[7] + 16, &owner) == NULL && owner == b);
+	CHECK(so_addr_symbol(a->data_base[0], &owner) == NULL && owner == a);
+	CHECK(so_addr_symbol((uintptr_t)&check_random, &owner) == NULL && owner == NULL);
+
+	return host_report("symtab_test");
+}
@@ -0,0 +1,165 @@
+/* unaligned_scan_test.c -- so_fix_unaligned over a sample module and its cache
+ *
+ * The module mixes what the scanner has to find with what only looks like it
+ * when decoded wrong: a literal pool word and a $d stretch that read as LDM,
+ * Thumb code that reads as LDRD when taken for ARM, and a Thumb LDRD that is
+ * risky but left alone. Exactly the two real ARM sites have to be patched,
+ * both with the .symtab mapping symbols and stripped down to the exported
+ * function bounds. The cache has to be replayed as it was saved, and ignored
+ * for a different .so.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "host.h"
+#include "elf_gen.h"
+#include "so_backend.h"
+
+#define LDM_R0 0xe8900006 // ldm r0, {r1, r2}
+#define NOP_SLOT 16
+
+static const uint32_t arm_func[] = {
+	0xe92d4010, // push {r4, lr}
+	LDM_R0,
+	0xe1c020d8, // ldrd r2, r3, [r0, #8]
+	0xe59f1004, // ldr r1, [pc, #4]
+	0xe1a00000, // nop
+	0xe8bd8010, // pop {r4, pc}
+	LDM_R0, // pool word loaded above
+};
+
+static const uint32_t data_words[] = { LDM_R0, 0xe1c020d8 };
+
+static const uint16_t thumb_func[] = {
+	0x20d8, 0xe1c0, // movs r0, #216; b, or ldrd r2, r3, [r0, #8] as ARM
+	0xe9d0, 0x2302, // ldrd r2, r3, [r0, #8]
+	0x4770, // bx lr
+	0xbf00, // nop
+};
+
+// What each fixed site's island has to do before jumping back
+static const struct {
+	uint32_t offset;
+	uint32_t island[2];
+} fixes[] = {
+	{ 4, { 0xe5901000, 0xe5902004 } }, // ldr r1, [r0]; ldr r2, [r0, #4]
+	{ 8, { 0xe5902008, 0xe590300c } }, // ldr r2, [r0, #8]; ldr r3, [r0, #12]
+};
+
+static uint32_t arm_vaddr, code_end;
+
+static void *build_module(int flags, size_t *size) {
+	elf_gen *g = elf_gen_new("libunaligned.so", flags);
+	arm_vaddr = elf_gen_code(g, arm_func, sizeof(arm_func), 'a');
+	elf_gen_func(g, "arm_func", arm_vaddr, sizeof(arm_func), STB_GLOBAL);
+	elf_gen_code(g, data_words, sizeof(data_words), 'd');
+	uint32_t thumb_vaddr = elf_gen_code(g, thumb_func, sizeof(thumb_func), 't');
+	elf_gen_func(g, "thumb_func", thumb_vaddr | 1, sizeof(thumb_func), STB_GLOBAL);
+	code_end = thumb_vaddr + sizeof(thumb_func);
+
+	void *image = elf_gen_image(g, size);
+	elf_gen_free(g);
+	return image;
+}
+
+// Loaded modules stay on so_util's list, so every load gets its own
+static so_module *load(void *image, size_t size) {
+	so_module *mod = calloc(1, sizeof(so_module));
+	if (!image || !mod || host_so_mem_load(mod, image, size) < 0) {
+		fprintf(stderr, "unaligned_scan_test: failed to load the module\n");
+		exit(1);
+	}
+	return mod;
+}
+
+// Only the fixed sites may differ from the original code, each now a branch to its island
+static void check_fixed(so_module *mod, const void *image, const char *what) {
+	const uint8_t *orig = (const uint8_t *)image + ELF_GEN_TEXT;
+	const uint8_t *code = (const uint8_t *)mod->text_base + ELF_GEN_TEXT;
+	int fixed = 0;
+
+	for (uint32_t off = 0; off < code_end - ELF_GEN_TEXT; off += 4) {
+		uint32_t word, orig_word;
+		memcpy(&word, code + off, 4);
+		memcpy(&orig_word, orig + off, 4);
+
+		int expected = -1;
+		for (int i = 0; i < sizeof(fixes) / sizeof(*fixes); i++) {
+			if (off == arm_vaddr - ELF_GEN_TEXT + fixes[i].offset)
+				expected = i;
+		}
+		if (expected < 0) {
+			if (word != orig_word)
+				fprintf(stderr, "%s: text+0x%x changed to 0x%08x\n", what, off + ELF_GEN_TEXT, word);
+			CHECK(word == orig_word);
+			continue;
+		}
+
+		CHECK((word & 0xff000000) == 0xea000000);
+		if ((word & 0xff000000) != 0xea000000)
+			continue;
+		uintptr_t site = (uintptr_t)code + off;
+		const uint32_t *island = (const uint32_t *)(site + 8 + ((int32_t)(word << 8) >> 6));
+		CHECK(so_addr_range((uintptr_t)island) != NULL);
+		CHECK(island[0] == fixes[expected].island[0]);
+		CHECK(island[1] == fixes[expected].island[1]);
+		CHECK(island[2] == 0xe51ff004); // ldr pc, [pc, #-4]
+		CHECK(island[3] == site + 4);
+		fixed++;
+	}
+	CHECK(fixed == sizeof(fixes) / sizeof(*fixes));
+}
+
+int main(int argc, char *argv[]) {
+	char cache[64], other_cache[64];
+	snprintf(cache, sizeof(cache), "unaligned_scan_test_%d.bin", getpid());
+	snprintf(other_cache, sizeof(other_cache), "unaligned_scan_test_%d.other", getpid());
+
+	size_t size, stripped_size;
+	void *image = build_module(ELF_GEN_GNU_HASH | ELF_GEN_SYMTAB, &size);
+	void *stripped = build_module(ELF_GEN_GNU_HASH, &stripped_size);
+	so_module *mod;
+
+	// Mapping symbols tell the modes apart and mark the $d stretch
+	mod = load(image, size);
+	CHECK(mod->mapping != NULL);
+	CHECK(so_fix_unaligned(mod, cache) == 2);
+	check_fixed(mod, image, "symtab");
+	CHECK(access(cache, F_OK) == 0);
+
+	// A new LDM that wasn't there when the cache was made stays alone on a replay
+	uint32_t ldm = LDM_R0;
+	mod = load(image, size);
+	uintptr_t slot = mod->text_base + arm_vaddr + NOP_SLOT;
+	so_posix_backend.code_memcpy((void *)slot, &ldm, sizeof(ldm));
+	CHECK(so_fix_unaligned(mod, cache) == 2);
+	CHECK(*(uint32_t *)slot == LDM_R0);
+
+	// A scan does find it
+	mod = load(image, size);
+	slot = mod->text_base + arm_vaddr + NOP_SLOT;
+	so_posix_backend.code_memcpy((void *)slot, &ldm, sizeof(ldm));
+	CHECK(so_fix_unaligned(mod, other_cache) == 3);
+	CHECK((*(uint32_t *)slot & 0xff000000) == 0xea000000);
+
+	// Stripped: only the exported functions are scanned, each in its symbol's mode.
+	// The cache belongs to another .so, so this has to rescan and replace it.
+	mod = load(stripped, stripped_size);
+	CHECK(mod->mapping == NULL);
+	CHECK(so_fix_unaligned(mod, cache) == 2);
+	check_fixed(mod, stripped, "stripped");
+
+	mod = load(stripped, stripped_size);
+	CHECK(so_fix_unaligned(mod, cache) == 2);
+	check_fixed(mod, stripped, "stripped, cached");
+
+	unlink(cache);
+	unlink(other_cache);
+	return host_report("unaligned_scan_test");
+}
@@ -0,0 +1,168 @@
+/* alloc_trace.c -- records every call into the malloc wrappers
+ *
+ * Each thread writes into its own ring, a single producer/single consumer queue
+ * drained by a flusher thread, so tracing takes no locks on the allocation path.
+ * Records that don't fit because the flusher fell behind are counted and dropped.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <vitasdk.h>
+#include <vitaGL.h>
+#include <pthread.h>
+#include <string.h>
+
+#include "main.h"
+#include "alloc_trace.h"
+
+#define TRACE_THREADS 64
+#define TRACE_RING 4096 // records per thread, a power of two
+#define TRACE_FLUSH_US (100 * 1000)
+
+enum {
+  RING_FREE,
+  RING_OWNED,
+  RING_DEAD, // owner exited, reusable once drained
+};
+
+typedef struct {
+	volatile int state;
+	volatile uint32_t head; // written by the owner
+	volatile uint32_t tail; // written by the flusher
+	alloc_trace_record *records;
+} trace_ring;
+
+static trace_ring rings[TRACE_THREADS];
+static __thread trace_ring *my_ring;
+static __thread int no_ring;
+
+static struct {
+	volatile int running;
+	SceUID fd;
+	uint32_t start;
+	volatile uint32_t dropped;
+	pthread_t thread;
+} trace;
+
+static void trace_push(trace_ring *r, int op, uint32_t ptr, uint32_t size, uint32_t aux) {
+	uint32_t head = r->head;
+	if (head - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE) == TRACE_RING) {
+		__atomic_add_fetch(&trace.dropped, 1, __ATOMIC_RELAXED);
+		return;
+	}
+
+	alloc_trace_record *rec = &r->records[head & (TRACE_RING - 1)];
+	rec->time = sceKernelGetProcessTimeLow() - trace.start;
+	rec->ptr = ptr;
+	rec->size = size;
+	rec->aux = aux;
+	rec->thread = r - rings;
+	rec->op = op;
+	rec->pad = 0;
+	__atomic_store_n(&r->head, head + 1, __ATOMIC_RELEASE);
+}
+
+// Rings are allocated straight from vitaGL, the wrappers would trace themselves
+static trace_ring *trace_claim_ring(void) {
+	for (int i = 0; i < TRACE_THREADS; i++) {
+		int expected = RING_FREE;
+		if (!__atomic_compare_exchange_n(&rings[i].state, &expected, RING_OWNED, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+			continue;
+
+		trace_ring *r = &rings[i];
+		if (!r->records && !(r->records = vglMalloc(TRACE_RING * sizeof(alloc_trace_record)))) {
+			__atomic_store_n(&r->state, RING_FREE, __ATOMIC_RELEASE);
+			break;
+		}
+		// head and tail carry on from the last owner, trace_drain left them equal before freeing the ring
+		trace_push(r, ALLOC_TRACE_THREAD, sceKernelGetThreadId(), 0, 0);
+		return r;
+	}
+
+	no_ring = 1;
+	return NULL;
+}
+
+void alloc_trace(int op, void *ptr, uint32_t size, uint32_t aux) {
+	if (!trace.running || no_ring)
+		return;
+
+	trace_ring *r = my_ring;
+	if (!r && !(r = my_ring = trace_claim_ring())) {
+		__atomic_add_fetch(&trace.dropped, 1, __ATOMIC_RELAXED);
+		return;
+	}
+	trace_push(r, op, (uintptr_t)ptr, size, aux);
+}
+
+void alloc_trace_thread_exit(void) {
+	if (my_ring)
+		__atomic_store_n(&my_ring->state, RING_DEAD, __ATOMIC_RELEASE);
+	my_ring = NULL;
+}
+
+static void trace_drain(void) {
+	for (int i = 0; i < TRACE_THREADS; i++) {
+		trace_ring *r = &rings[i];
+		int state = __atomic_load_n(&r->state, __ATOMIC_ACQUIRE);
+		if (state == RING_FREE)
+			continue;
+
+		uint32_t head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+		uint32_t tail = r->tail;
+		while (tail != head) {
+			// Up to the end of the buffer, then again from the start
+			uint32_t idx = tail & (TRACE_RING - 1);
+			uint32_t n = head - tail < TRACE_RING - idx ? head - tail : TRACE_RING - idx;
+			sceIoWrite(trace.fd, &r->records[idx], n * sizeof(alloc_trace_record));
+			tail += n;
+		}
+		__atomic_store_n(&r->tail, tail, __ATOMIC_RELEASE);
+
+		if (state == RING_DEAD)
+			__atomic_store_n(&r->state, RING_FREE, __ATOMIC_RELEASE);
+	}
+}
+
+static void *trace_flusher(void *arg) {
+	while (trace.running) {
+		sceKernelDelayThread(TRACE_FLUSH_US);
+		trace_drain();
+	}
+	return NULL;
+}
+
+int alloc_trace_start(const char *path) {
+	trace.fd = sceIoOpen(path, SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+	if (trace.fd < 0)
+		return -1;
+
+	alloc_trace_header hdr;
+	hdr.magic = ALLOC_TRACE_MAGIC;
+	hdr.version = ALLOC_TRACE_VERSION;
+	hdr.record_size = sizeof(alloc_trace_record);
+	sceIoWrite(trace.fd, &hdr, sizeof(hdr));
+
+	trace.start = sceKernelGetProcessTimeLow();
+	trace.running = 1;
+	if (pthread_create(&trace.thread, NULL, trace_flusher, NULL) != 0) {
+		trace.running = 0;
+		sceIoClose(trace.fd);
+		return -1;
+	}
+
+	return 0;
+}
+
+void alloc_trace_stop(void) {
+	if (!trace.running)
+		return;
+
+	trace.running = 0;
+	pthread_join(trace.thread, NULL);
+	trace_drain();
+	sceIoClose(trace.fd);
+
+	debugPrintf("alloc_trace: %u records dropped\n", trace.dropped);
+}
@@ -0,0 +1,46 @@
+#ifndef __ALLOC_TRACE_H__
+#define __ALLOC_TRACE_H__
+
+#include <stdint.h>
+
+#define ALLOC_TRACE_MAGIC 0x43525441 // 'ATRC'
+#define ALLOC_TRACE_VERSION 1
+
+enum {
+  ALLOC_TRACE_THREAD, // ptr is the SceUID of the thread behind this thread slot
+  ALLOC_TRACE_MALLOC,
+  ALLOC_TRACE_CALLOC,
+  ALLOC_TRACE_MEMALIGN, // aux is the alignment
+  ALLOC_TRACE_REALLOC, // aux is the old pointer
+  ALLOC_TRACE_FREE,
+};
+
+// File layout: alloc_trace_header, then records in per-thread order
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t record_size;
+} alloc_trace_header;
+
+typedef struct {
+  uint32_t time; // us since the trace started
+  uint32_t ptr;
+  uint32_t size;
+  uint32_t aux;
+  uint16_t thread; // slot, see ALLOC_TRACE_THREAD
+  uint8_t op;
+  uint8_t pad;
+} alloc_trace_record;
+
+int alloc_trace_start(const char *path);
+void alloc_trace_stop(void);
+void alloc_trace(int op, void *ptr, uint32_t size, uint32_t aux);
+void alloc_trace_thread_exit(void);
+
+#ifdef TRACE_ALLOCS
+#define ALLOC_TRACE(op, ptr, size, aux) alloc_trace(op, ptr, size, aux)
+#else
+#define ALLOC_TRACE(op, ptr, size, aux)
+#endif
+
+#endif
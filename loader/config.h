@@ -2,11 +2,22 @@
 #define __CONFIG_H__
 
 //#define DEBUG
+//#define LAZY_BINDING // Bind PLT imports on first call instead of at boot
+//#define PROFILE_IMPORTS // Count calls into default_dynlib imports, dumped to imports.txt on exit
+//#define SAMPLING_PROFILER // Sample import call sites every 1ms, dumped to profile.folded on exit
+//#define TRACE_ALLOCS // Log every malloc wrapper call to allocs.bin, see alloc_trace.h for the format
+#define CRASH_REPORTS // Write crash.txt with symbolized registers and stack on CPU exceptions
+//#define FIX_UNALIGNED // Split alignment-faulting LDM/LDRD across the whole module at boot
 
 #define LOAD_ADDRESS 0x98000000
 
 #define MEMORY_NEWLIB_MB 128
 #define MEMORY_VITAGL_THRESHOLD_MB 6
+#define MEMORY_MODERATE_FREE_MB 48 // Trim loader caches when less than this is free
+#define MEMORY_HIGH_FREE_MB 32 // Return idle slab spans below this
+#define MEMORY_PURGE_FREE_MB 22 // Purge game caches when less than this is left
+#define MEMORY_REARM_FREE_MB 56 // and don't react again before this much is free
+#define MEMORY_POLL_MS 3000 // Re-check free memory this often even without a signal
 
 #define SCREEN_W 960
 #define SCREEN_H 544
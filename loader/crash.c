@@ -0,0 +1,130 @@
+/* crash.c -- writes a symbolized report when a CPU exception hits
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <vitasdk.h>
+#include <kubridge.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crash.h"
+#include "so_util.h"
+
+#define CRASH_STACK_WORDS 1024 // how far up from sp to look for return addresses
+#define CRASH_MAX_FRAMES 32
+
+// Nothing in here may allocate, the heap could be what broke
+static char report_path[256];
+static char report[8 * 1024];
+static int report_len;
+static KuKernelExceptionHandler old_handlers[3];
+
+static void crash_printf(const char *fmt, ...) {
+	va_list list;
+	va_start(list, fmt);
+	int n = vsnprintf(report + report_len, sizeof(report) - report_len, fmt, list);
+	va_end(list);
+	if (n > 0)
+		report_len = report_len + n < sizeof(report) ? report_len + n : sizeof(report) - 1;
+}
+
+static void crash_print_addr(const char *label, uintptr_t addr) {
+	so_module *mod;
+	const symtab_entry *e = so_addr_symbol(addr, &mod);
+	if (e)
+		crash_printf("%-8s 0x%08X %s: %s+0x%X\n", label, addr, mod->soname, e->name, (addr & ~1) - e->addr);
+	else if (mod)
+		crash_printf("%-8s 0x%08X %s+0x%X\n", label, addr, mod->soname, addr - mod->text_base);
+	else
+		crash_printf("%-8s 0x%08X\n", label, addr);
+}
+
+// A return address is only taken as one if the instruction before it is a call
+static int crash_is_return_addr(uintptr_t addr) {
+	const so_range *r = so_addr_range(addr);
+	if (!r || r->kind != SO_RANGE_TEXT || (addr & ~1) - 4 < r->start)
+		return 0;
+
+	if (addr & 1) {
+		const uint16_t *hw = (const uint16_t *)(addr & ~1);
+		if ((hw[-1] & 0xff87) == 0x4780) // BLX Rm
+			return 1;
+		return (hw[-2] & 0xf800) == 0xf000 && (hw[-1] & 0xc000) == 0xc000; // BL/BLX imm
+	}
+
+	if (addr & 3)
+		return 0;
+	uint32_t insn = *(const uint32_t *)(addr - 4);
+	if ((insn & 0x0ffffff0) == 0x012fff30) // BLX Rm
+		return 1;
+	if ((insn & 0xfe000000) == 0xfa000000) // BLX imm
+		return 1;
+	return (insn & 0x0f000000) == 0x0b000000 && (insn >> 28) != 0xf; // BL
+}
+
+static void crash_handler(KuKernelExceptionContext *ctx) {
+	static const char *types[] = { "data abort", "prefetch abort", "undefined instruction" };
+	uint32_t type = ctx->exceptionType < 3 ? ctx->exceptionType : 0;
+
+	SceKernelThreadInfo info;
+	memset(&info, 0, sizeof(info));
+	info.size = sizeof(info);
+	int has_info = sceKernelGetThreadInfo(sceKernelGetThreadId(), &info) >= 0;
+
+	report_len = 0;
+	crash_printf("%s in thread %s\n", types[type], has_info ? info.name : "???");
+	if (type == KU_KERNEL_EXCEPTION_TYPE_DATA_ABORT)
+		crash_printf("far 0x%08X fsr 0x%08X\n", ctx->FAR, ctx->FSR);
+	crash_printf("\n");
+	crash_print_addr("pc", ctx->pc);
+	crash_print_addr("lr", ctx->lr);
+
+	const SceUInt32 *regs = &ctx->r0;
+	for (int i = 0; i < 13; i++)
+		crash_printf("r%-2d 0x%08X%s", i, regs[i], i % 4 == 3 ? "\n" : "  ");
+	crash_printf("sp  0x%08X  cpsr 0x%08X\n\n", ctx->sp, ctx->SPSR);
+
+	// Stays inside the thread's own stack when its bounds are known
+	uintptr_t stack_end = ctx->sp + CRASH_STACK_WORDS * sizeof(uint32_t);
+	if (has_info && ctx->sp >= (uintptr_t)info.stack && ctx->sp < (uintptr_t)info.stack + info.stackSize)
+		stack_end = (uintptr_t)info.stack + info.stackSize < stack_end ? (uintptr_t)info.stack + info.stackSize : stack_end;
+
+	crash_printf("stack:\n");
+	int frames = 0;
+	for (uintptr_t p = ctx->sp & ~3; p < stack_end && frames < CRASH_MAX_FRAMES; p += 4) {
+		uintptr_t val = *(const uint32_t *)p;
+		if (crash_is_return_addr(val)) {
+			char label[16];
+			snprintf(label, sizeof(label), "sp+0x%X", p - ctx->sp);
+			crash_print_addr(label, val);
+			frames++;
+		}
+	}
+
+	SceUID fd = sceIoOpen(report_path, SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+	if (fd >= 0) {
+		sceIoWrite(fd, report, report_len);
+		sceIoClose(fd);
+	}
+
+	if (old_handlers[type])
+		old_handlers[type](ctx);
+}
+
+int crash_handler_init(const char *path) {
+	strncpy(report_path, path, sizeof(report_path) - 1);
+
+	// Symbolizing must not build anything once we're in the handler
+	if (so_addr_index_build() < 0)
+		return -1;
+
+	for (int i = KU_KERNEL_EXCEPTION_TYPE_DATA_ABORT; i <= KU_KERNEL_EXCEPTION_TYPE_UNDEFINED_INSTRUCTION; i++) {
+		if (kuKernelRegisterExceptionHandler(i, crash_handler, &old_handlers[i], NULL) < 0)
+			return -1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,6 @@
+#ifndef __CRASH_H__
+#define __CRASH_H__
+
+int crash_handler_init(const char *path);
+
+#endif
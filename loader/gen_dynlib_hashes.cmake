@@ -0,0 +1,67 @@
+# gen_dynlib_hashes.cmake -- so_gnu_hash of every name in a so_default_dynlib table
+#
+# Reads the table out of a C file and writes a header with one hash per live entry,
+# in table order, so the table itself can stay a plain list of names and functions.
+#
+# cmake -DINPUT=main.c -DTABLE=default_dynlib -DOUTPUT=default_dynlib_hashes.h -P gen_dynlib_hashes.cmake
+
+cmake_minimum_required(VERSION 3.13)
+
+file(READ "${INPUT}" source)
+
+string(FIND "${source}" "so_default_dynlib ${TABLE}[] = {" start)
+if(start LESS 0)
+  message(FATAL_ERROR "${INPUT}: no so_default_dynlib ${TABLE}[]")
+endif()
+string(SUBSTRING "${source}" ${start} -1 table)
+string(FIND "${table}" "\n};" end)
+string(SUBSTRING "${table}" 0 ${end} table)
+
+# Commented out entries don't count, block comments first since they can hold //
+while(TRUE)
+  string(FIND "${table}" "/*" open)
+  if(open LESS 0)
+    break()
+  endif()
+  string(SUBSTRING "${table}" ${open} -1 rest)
+  string(FIND "${rest}" "*/" close)
+  if(close LESS 0)
+    message(FATAL_ERROR "${INPUT}: unterminated comment in ${TABLE}[]")
+  endif()
+  string(SUBSTRING "${table}" 0 ${open} head)
+  math(EXPR close "${close} + 2")
+  string(SUBSTRING "${rest}" ${close} -1 rest)
+  set(table "${head}${rest}")
+endwhile()
+string(REGEX REPLACE "//[^\n]*" "" table "${table}")
+
+string(REGEX MATCHALL "{[ \t]*\"[^\"]*\"" entries "${table}")
+
+set(hashes "")
+set(names "")
+foreach(entry IN LISTS entries)
+  string(REGEX REPLACE "^{[ \t]*\"([^\"]*)\"$" "\\1" name "${entry}")
+
+  # djb2, the same as so_gnu_hash
+  set(h 5381)
+  string(HEX "${name}" hex)
+  string(LENGTH "${hex}" len)
+  set(i 0)
+  while(i LESS len)
+    string(SUBSTRING "${hex}" ${i} 2 byte)
+    math(EXPR h "(${h} * 33 + 0x${byte}) & 0xffffffff")
+    math(EXPR i "${i} + 2")
+  endwhile()
+  math(EXPR h "${h}" OUTPUT_FORMAT HEXADECIMAL)
+
+  string(APPEND hashes "\t${h}, // ${name}\n")
+  string(APPEND names "\t\"${name}\",\n")
+endforeach()
+
+file(WRITE "${OUTPUT}"
+  "// Generated from ${TABLE}[] by gen_dynlib_hashes.cmake, don't edit\n"
+  "#include <stdint.h>\n\n"
+  "static const uint32_t ${TABLE}_hashes[] = {\n${hashes}};\n\n"
+  "#ifdef DYNLIB_HASH_NAMES\n"
+  "static const char *const ${TABLE}_names[] = {\n${names}};\n"
+  "#endif\n")
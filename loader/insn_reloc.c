@@ -0,0 +1,437 @@
+/* insn_reloc.c -- ARMv7/Thumb-2 decoding for hook trampolines and alignment fixes
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <string.h>
+
+#include "insn_reloc.h"
+
+#define REG_IP 12 // scratch, dead at function entry per AAPCS
+#define REG_PC 15
+#define COND_AL 0xE
+#define MAX_LIT 8
+
+typedef struct {
+	uint8_t *out;
+	size_t size;
+	size_t len;
+	int thumb;
+	int err;
+	int n_lit;
+	struct {
+		size_t at; // offset of the LDR loading it
+		uint32_t val;
+	} lit[MAX_LIT];
+} reloc_ctx;
+
+static int32_t sext(uint32_t val, int bits) {
+	return (int32_t)(val << (32 - bits)) >> (32 - bits);
+}
+
+static void emit16(reloc_ctx *c, uint16_t hw) {
+	if (c->len + 2 > c->size) {
+		c->err = 1;
+		return;
+	}
+	memcpy(c->out + c->len, &hw, 2);
+	c->len += 2;
+}
+
+static void emit32(reloc_ctx *c, uint32_t w) {
+	if (c->len + 4 > c->size) {
+		c->err = 1;
+		return;
+	}
+	memcpy(c->out + c->len, &w, 4);
+	c->len += 4;
+}
+
+static void emit_t32(reloc_ctx *c, uint16_t hw1, uint16_t hw2) {
+	emit16(c, hw1);
+	emit16(c, hw2);
+}
+
+// LDR<c> Rt, =val; the offset is filled in by reloc_finish once the pool is placed
+static void emit_ldr_lit(reloc_ctx *c, uint32_t cond, int rt, uint32_t val) {
+	if (c->n_lit == MAX_LIT) {
+		c->err = 1;
+		return;
+	}
+	c->lit[c->n_lit].at = c->len;
+	c->lit[c->n_lit].val = val;
+	c->n_lit++;
+
+	if (c->thumb)
+		emit_t32(c, 0xf8df, rt << 12); // LDR.W Rt, [PC, #0]
+	else
+		emit32(c, (cond << 28) | 0x059f0000 | (rt << 12)); // LDR<c> Rt, [PC, #0]
+}
+
+static int reloc_finish(reloc_ctx *c) {
+	if (c->len & 2)
+		emit16(c, 0xbf00); // NOP, the pool has to be word aligned
+
+	for (int i = 0; i < c->n_lit; i++) {
+		size_t pos = c->len;
+		size_t at = c->lit[i].at;
+		emit32(c, c->lit[i].val);
+		if (c->err)
+			break;
+
+		if (c->thumb) {
+			uint16_t hw2;
+			memcpy(&hw2, c->out + at + 2, 2);
+			hw2 |= pos - ((at + 4) & ~3);
+			memcpy(c->out + at + 2, &hw2, 2);
+		} else {
+			// The pool can sit right after the LDR, at PC-4, which needs the U bit cleared
+			int32_t offset = pos - (at + 8);
+			uint32_t w;
+			memcpy(&w, c->out + at, 4);
+			if (offset < 0)
+				w = (w & ~(1 << 23)) | -offset;
+			else
+				w |= offset;
+			memcpy(c->out + at, &w, 4);
+		}
+	}
+
+	return c->err ? -1 : (int)c->len;
+}
+
+static int reloc_arm_insn(reloc_ctx *c, uint32_t insn, uintptr_t pc) {
+	uint32_t cond = insn >> 28;
+	uint32_t pcv = pc + 8;
+	int rd = (insn >> 12) & 0xf;
+	int rn = (insn >> 16) & 0xf;
+	int rm = insn & 0xf;
+
+	if (cond == 0xf) {
+		if ((insn & 0x0e000000) == 0x0a000000) { // BLX imm
+			uint32_t target = pcv + (sext(insn & 0xffffff, 24) << 2) + ((insn >> 23) & 2);
+			emit_ldr_lit(c, COND_AL, REG_IP, target | 1);
+			emit32(c, 0xe12fff3c); // BLX IP
+			return 0;
+		}
+		if ((insn & 0x0e000000) == 0x0c000000 && rn == REG_PC) // LDC2/STC2 off PC
+			return -1;
+		emit32(c, insn); // PLD and friends only hint
+		return 0;
+	}
+
+	// B/BL
+	if ((insn & 0x0e000000) == 0x0a000000) {
+		uint32_t target = pcv + (sext(insn & 0xffffff, 24) << 2);
+		if (insn & (1 << 24)) {
+			emit_ldr_lit(c, cond, REG_IP, target);
+			emit32(c, (cond << 28) | 0x012fff3c); // BLX<c> IP
+		} else {
+			emit_ldr_lit(c, cond, REG_PC, target);
+		}
+		return 0;
+	}
+
+	// LDR/LDRB Rt, [PC, #imm]
+	if ((insn & 0x0f3f0000) == 0x051f0000) {
+		uint32_t imm = insn & 0xfff;
+		uint32_t addr = (insn & (1 << 23)) ? pcv + imm : pcv - imm;
+		int rt = rd == REG_PC ? REG_IP : rd;
+		emit_ldr_lit(c, cond, rt, addr);
+		emit32(c, (insn & 0xf0400000) | 0x05900000 | (rt << 16) | (rd << 12)); // LDR<c>{B} Rd, [Rt]
+		return 0;
+	}
+
+	// Any other load/store addressing off PC, or LDM/STM on it
+	if ((insn & 0x0c000000) == 0x04000000) {
+		if (rn == REG_PC || ((insn & (1 << 25)) && rm == REG_PC) || (!(insn & (1 << 20)) && rd == REG_PC))
+			return -1;
+	} else if ((insn & 0x0e000000) == 0x08000000) {
+		if (rn == REG_PC || (!(insn & (1 << 20)) && (insn & (1 << REG_PC))))
+			return -1;
+	} else if ((insn & 0x0c000000) == 0) {
+		int is_reg = !(insn & (1 << 25));
+		if (is_reg && (insn & 0x90) == 0x90) {
+			// Multiplies and LDRD/LDRH/STRH... PC there is either a literal or unpredictable
+			if (rn == REG_PC || rm == REG_PC || rd == REG_PC)
+				return -1;
+		} else if ((insn & 0x01900000) == 0x01000000) {
+			// MRS/MSR/BX/CLZ/MOVW/MOVT, only BX PC reads it
+			if (is_reg && rm == REG_PC)
+				return -1;
+		} else {
+			// Data processing, ADR included: read PC through IP instead
+			int op = (insn >> 21) & 0xf;
+			int rn_pc = op != 0xd && op != 0xf && rn == REG_PC; // MOV/MVN ignore Rn
+			int rm_pc = is_reg && rm == REG_PC;
+			if (rn_pc || rm_pc) {
+				int rs = (insn >> 8) & 0xf;
+				if ((!rn_pc && rn == REG_IP) || (is_reg && !rm_pc && rm == REG_IP) || (is_reg && (insn & 0x10) && rs == REG_IP))
+					return -1;
+				if (rn_pc)
+					insn = (insn & ~0x000f0000) | (REG_IP << 16);
+				if (rm_pc)
+					insn = (insn & ~0xf) | REG_IP;
+				emit_ldr_lit(c, COND_AL, REG_IP, pcv);
+			}
+		}
+	} else if ((insn & 0x0e000000) == 0x0c000000 && rn == REG_PC) {
+		// VLDR/VSTR Dd, [PC, #imm]: load the address into IP and access through that
+		if ((insn & 0x0f200e00) != 0x0d000a00)
+			return -1; // LDC/STC/VLDM off PC
+		uint32_t imm = (insn & 0xff) << 2;
+		emit_ldr_lit(c, cond, REG_IP, (insn & (1 << 23)) ? pcv + imm : pcv - imm);
+		insn = (insn & ~0x008f00ff) | (1 << 23) | (REG_IP << 16); // VLDR<c> Dd, [IP]
+	}
+
+	emit32(c, insn);
+	return 0;
+}
+
+// Thumb branches go through LDR.W PC, which lands on the odd target and keeps us in Thumb
+static void emit_thumb_jump(reloc_ctx *c, uint32_t target, int cond) {
+	if (cond >= 0)
+		emit16(c, 0xd001 | ((cond ^ 1) << 8)); // B<!c> over the LDR.W
+	emit_ldr_lit(c, COND_AL, REG_PC, target | 1);
+}
+
+static int reloc_thumb_insn(reloc_ctx *c, const uint16_t *code, uintptr_t pc) {
+	uint16_t hw = code[0];
+	uint32_t pcv = pc + 4;
+	uint32_t pca = pcv & ~3; // Align(PC, 4) for literals and ADR
+
+	if ((hw & 0xf800) < 0xe800) {
+		if ((hw & 0xff00) == 0xbf00 && (hw & 0xf)) // IT, its block can't be split up
+			return -1;
+
+		if ((hw & 0xf800) == 0x4800) { // LDR Rt, [PC, #imm]
+			int rt = (hw >> 8) & 7;
+			emit_ldr_lit(c, COND_AL, rt, pca + ((hw & 0xff) << 2));
+			emit16(c, 0x6800 | (rt << 3) | rt); // LDR Rt, [Rt]
+		} else if ((hw & 0xf800) == 0xa000) { // ADR Rd, #imm
+			emit_ldr_lit(c, COND_AL, (hw >> 8) & 7, pca + ((hw & 0xff) << 2));
+		} else if ((hw & 0xf000) == 0xd000 && ((hw >> 8) & 0xf) < 0xe) { // B<c>
+			emit_thumb_jump(c, pcv + (sext(hw & 0xff, 8) << 1), (hw >> 8) & 0xf);
+		} else if ((hw & 0xf800) == 0xe000) { // B
+			emit_thumb_jump(c, pcv + (sext(hw & 0x7ff, 11) << 1), -1);
+		} else if ((hw & 0xf500) == 0xb100) { // CBZ/CBNZ
+			uint32_t target = pcv + (((hw >> 9) & 1) << 6) + (((hw >> 3) & 0x1f) << 1);
+			emit16(c, ((hw & 0xfd07) ^ 0x0800) | (1 << 3)); // CB(N)Z with the opposite sense over the LDR.W
+			emit_thumb_jump(c, target, -1);
+		} else if ((hw & 0xfc00) == 0x4400) { // ADD/CMP/MOV/BX on high registers
+			int rm = (hw >> 3) & 0xf;
+			int rdn = (hw & 7) | ((hw >> 4) & 8);
+			int op = (hw >> 8) & 3;
+			if (op == 3) { // BX/BLX Rm
+				if (rm == REG_PC)
+					return -1;
+				emit16(c, hw);
+			} else if (rm == REG_PC && rdn != REG_PC && rdn != REG_IP && op != 1) {
+				if (op == 2) { // MOV Rd, PC
+					emit_ldr_lit(c, COND_AL, rdn, pcv);
+				} else { // ADD Rdn, PC
+					emit_ldr_lit(c, COND_AL, REG_IP, pcv);
+					emit16(c, (hw & ~0x78) | (REG_IP << 3));
+				}
+			} else if (rm == REG_PC || (op != 2 && rdn == REG_PC)) {
+				return -1;
+			} else {
+				emit16(c, hw);
+			}
+		} else {
+			emit16(c, hw);
+		}
+		return 2;
+	}
+
+	uint16_t hw2 = code[1];
+	int rn = hw & 0xf;
+
+	if ((hw & 0xf800) == 0xf000 && (hw2 & 0x8000)) {
+		uint32_t s = (hw >> 10) & 1;
+		uint32_t j1 = (hw2 >> 13) & 1;
+		uint32_t j2 = (hw2 >> 11) & 1;
+		if ((hw2 & 0x5000) == 0) { // B<c>.W, or misc control when the condition is AL
+			int cond = (hw >> 6) & 0xf;
+			if (cond >= 0xe) {
+				emit_t32(c, hw, hw2);
+				return 4;
+			}
+			uint32_t imm = (s << 20) | (j2 << 19) | (j1 << 18) | ((hw & 0x3f) << 12) | ((hw2 & 0x7ff) << 1);
+			emit_thumb_jump(c, pcv + sext(imm, 21), cond);
+			return 4;
+		}
+
+		uint32_t i1 = !(j1 ^ s);
+		uint32_t i2 = !(j2 ^ s);
+		uint32_t imm = (s << 24) | (i1 << 23) | (i2 << 22) | ((hw & 0x3ff) << 12) | ((hw2 & 0x7ff) << 1);
+		if ((hw2 & 0x5000) == 0x1000) { // B.W
+			emit_thumb_jump(c, pcv + sext(imm, 25), -1);
+		} else if (hw2 & 0x1000) { // BL
+			emit_ldr_lit(c, COND_AL, REG_IP, (pcv + sext(imm, 25)) | 1);
+			emit16(c, 0x47e0); // BLX IP
+		} else { // BLX to ARM
+			emit_ldr_lit(c, COND_AL, REG_IP, pca + sext(imm, 25));
+			emit16(c, 0x47e0); // BLX IP
+		}
+		return 4;
+	}
+
+	if ((hw & 0xff7f) == 0xf85f) { // LDR.W Rt, [PC, #imm]
+		uint32_t imm = hw2 & 0xfff;
+		uint32_t addr = (hw & 0x80) ? pca + imm : pca - imm;
+		int rt = hw2 >> 12;
+		int base = rt == REG_PC ? REG_IP : rt;
+		emit_ldr_lit(c, COND_AL, base, addr);
+		emit_t32(c, 0xf8d0 | base, rt << 12); // LDR.W Rt, [base]
+		return 4;
+	}
+
+	if ((hw & 0xfbff) == 0xf20f || (hw & 0xfbff) == 0xf2af) { // ADR.W Rd, #imm
+		if (hw2 & 0x8000)
+			return -1;
+		uint32_t imm = (((hw >> 10) & 1) << 11) | (((hw2 >> 12) & 7) << 8) | (hw2 & 0xff);
+		emit_ldr_lit(c, COND_AL, (hw2 >> 8) & 0xf, (hw & 0x00a0) ? pca - imm : pca + imm);
+		return 4;
+	}
+
+	if ((hw & 0xee00) == 0xec00 && rn == REG_PC) { // VLDR/VSTR Dd, [PC, #imm]
+		if ((hw & 0xff20) != 0xed00 || (hw2 & 0x0e00) != 0x0a00)
+			return -1; // LDC/STC/VLDM off PC
+		uint32_t imm = (hw2 & 0xff) << 2;
+		emit_ldr_lit(c, COND_AL, REG_IP, (hw & 0x80) ? pca + imm : pca - imm);
+		emit_t32(c, (hw & ~0x008f) | 0x0080 | REG_IP, hw2 & ~0xff); // VLDR Dd, [IP]
+		return 4;
+	}
+
+	// Other literal loads, LDRD/LDM/TBB off PC
+	if (((hw & 0xfe00) == 0xf800 || (hw & 0xfe00) == 0xe800) && rn == REG_PC)
+		return -1;
+
+	emit_t32(c, hw, hw2);
+	return 4;
+}
+
+int insn_reloc_arm(const uint32_t *code, uintptr_t pc, size_t min_size, uint32_t *out, size_t out_size, size_t *consumed) {
+	reloc_ctx c = {.out = (uint8_t *)out, .size = out_size};
+	size_t n = 0;
+
+	while (n < min_size) {
+		if (reloc_arm_insn(&c, code[n / 4], pc + n) < 0)
+			return -1;
+		n += 4;
+	}
+	emit_ldr_lit(&c, COND_AL, REG_PC, pc + n);
+
+	*consumed = n;
+	return reloc_finish(&c);
+}
+
+int insn_reloc_thumb(const uint16_t *code, uintptr_t pc, size_t min_size, uint32_t *out, size_t out_size, size_t *consumed) {
+	reloc_ctx c = {.out = (uint8_t *)out, .size = out_size, .thumb = 1};
+	size_t n = 0;
+
+	pc &= ~1;
+	while (n < min_size) {
+		int len = reloc_thumb_insn(&c, code + n / 2, pc + n);
+		if (len < 0)
+			return -1;
+		n += len;
+	}
+	emit_thumb_jump(&c, pc + n, -1);
+
+	*consumed = n;
+	return reloc_finish(&c);
+}
+
+int insn_unaligned_arm(uint32_t insn, uintptr_t pc, uintptr_t *literal) {
+	uint32_t cond = insn >> 28;
+	int rn = (insn >> 16) & 0xf;
+
+	*literal = 0;
+	if (cond == 0xf)
+		return INSN_ALIGNED;
+
+	if (rn == REG_PC) {
+		// LDR/LDRB/VLDR/LDRD off PC, the word at the target is data
+		uint32_t imm = 0;
+		if ((insn & 0x0f3f0000) == 0x051f0000)
+			imm = insn & 0xfff;
+		else if ((insn & 0x0f300e00) == 0x0d100a00)
+			imm = (insn & 0xff) << 2;
+		else if ((insn & 0x0f7000f0) == 0x014000d0)
+			imm = ((insn >> 4) & 0xf0) | (insn & 0xf);
+		else
+			return INSN_ALIGNED;
+		*literal = (insn & (1 << 23)) ? pc + 8 + imm : pc + 8 - imm;
+		return INSN_ALIGNED;
+	}
+
+	// SP is kept aligned by the ABI
+	if (rn == 13)
+		return INSN_ALIGNED;
+
+	if ((insn & 0x0e000000) == 0x08000000) { // LDM/STM
+		if (cond == COND_AL && (insn & 0x0ff00000) == 0x08900000 && rn < 13)
+			return INSN_UNALIGNED_LDM;
+		return INSN_UNALIGNED_OTHER;
+	}
+
+	if ((insn & 0x0e1000d0) == 0x000000d0) { // LDRD/STRD
+		int rt = (insn >> 12) & 0xf;
+		if (cond == COND_AL && (insn & 0x0f7000f0) == 0x014000d0 && !(rt & 1) && rt != 14)
+			return INSN_UNALIGNED_LDRD;
+		return INSN_UNALIGNED_OTHER;
+	}
+
+	// VLDR/VSTR/VLDM/VSTM, but not the 64-bit core register moves
+	if ((insn & 0x0e000e00) == 0x0c000a00 && (insn & 0x0fe00000) != 0x0c400000)
+		return INSN_UNALIGNED_OTHER;
+
+	return INSN_ALIGNED;
+}
+
+int insn_unaligned_thumb(const uint16_t *code, uintptr_t pc, uintptr_t *literal) {
+	uint16_t hw = code[0];
+	uint32_t pca = (pc + 4) & ~3;
+
+	*literal = 0;
+	if (INSN_THUMB_SIZE(hw) == 2) {
+		if ((hw & 0xf800) == 0x4800) // LDR Rt, [PC, #imm]
+			*literal = pca + ((hw & 0xff) << 2);
+		else if ((hw & 0xf000) == 0xc000) // LDMIA/STMIA
+			return INSN_UNALIGNED_OTHER;
+		return INSN_ALIGNED;
+	}
+
+	uint16_t hw2 = code[1];
+	int rn = hw & 0xf;
+
+	if (rn == REG_PC) {
+		if ((hw & 0xff7f) == 0xf85f)
+			*literal = (hw & 0x80) ? pca + (hw2 & 0xfff) : pca - (hw2 & 0xfff);
+		else if ((hw & 0xff3f) == 0xed1f && (hw2 & 0x0e00) == 0x0a00)
+			*literal = (hw & 0x80) ? pca + ((hw2 & 0xff) << 2) : pca - ((hw2 & 0xff) << 2);
+		else if ((hw & 0xff7f) == 0xe95f)
+			*literal = (hw & 0x80) ? pca + ((hw2 & 0xff) << 2) : pca - ((hw2 & 0xff) << 2);
+		return INSN_ALIGNED;
+	}
+
+	if (rn == 13)
+		return INSN_ALIGNED;
+
+	// LDM/STM.W
+	if ((hw & 0xfe40) == 0xe800 && (((hw >> 7) & 3) == 1 || ((hw >> 7) & 3) == 2))
+		return INSN_UNALIGNED_OTHER;
+
+	// LDRD/STRD, P or W set tells them apart from the exclusives
+	if ((hw & 0xfe40) == 0xe840 && (hw & 0x0120))
+		return INSN_UNALIGNED_OTHER;
+
+	// VLDR/VSTR/VLDM/VSTM, but not the 64-bit core register moves
+	if ((hw & 0xfe00) == 0xec00 && (hw2 & 0x0e00) == 0x0a00 && (hw & 0xffe0) != 0xec40)
+		return INSN_UNALIGNED_OTHER;
+
+	return INSN_ALIGNED;
+}
@@ -0,0 +1,31 @@
+#ifndef __INSN_RELOC_H__
+#define __INSN_RELOC_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define INSN_RELOC_MAX 96 // Largest trampoline a relocated 8 byte prologue can need
+
+// Copies whole instructions starting at pc until at least min_size bytes are covered,
+// rewriting PC-relative ones so they keep working from out, and appends a jump back to
+// the first instruction left in place. out must run from a word aligned address.
+// Returns the bytes written to out (and the bytes taken from code in *consumed),
+// or -1 if an instruction can't be moved.
+int insn_reloc_arm(const uint32_t *code, uintptr_t pc, size_t min_size, uint32_t *out, size_t out_size, size_t *consumed);
+int insn_reloc_thumb(const uint16_t *code, uintptr_t pc, size_t min_size, uint32_t *out, size_t out_size, size_t *consumed);
+
+#define INSN_THUMB_SIZE(hw) (((hw) & 0xf800) >= 0xe800 ? 4 : 2)
+
+// Accesses that need word alignment even with the unaligned access trap off
+enum {
+  INSN_ALIGNED,
+  INSN_UNALIGNED_LDM, // LDMIA Rn, {...}, can be split into single loads
+  INSN_UNALIGNED_LDRD, // LDRD Rt, [Rn, #imm], can be split into single loads
+  INSN_UNALIGNED_OTHER, // STM/STRD/VLDR/VSTR/VLDM and Thumb forms, reported only
+};
+
+// Literal load targets are returned through *literal so pools can be told apart from code
+int insn_unaligned_arm(uint32_t insn, uintptr_t pc, uintptr_t *literal);
+int insn_unaligned_thumb(const uint16_t *code, uintptr_t pc, uintptr_t *literal);
+
+#endif
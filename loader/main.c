@@ -20,6 +20,7 @@
 #include <SDL2/SDL_net.h>
 #include <SLES/OpenSLES.h>
 
+#include <limits.h>
 #include <malloc.h>
 #include <stdio.h>
 #include <stdarg.h>
@@ -38,12 +39,24 @@
 #include <setjmp.h>
 #include <sys/time.h>
 #include <sys/stat.h>
+#include <fcntl.h>
 
 #include "main.h"
 #include "config.h"
 #include "dialog.h"
 #include "so_util.h"
 #include "sha1.h"
+#include "crash.h"
+#include "obj_pool.h"
+#include "pthread_static.h"
+#include "slab.h"
+#include "alloc_trace.h"
+#include "mem_pressure.h"
+#include "mmap_emu.h"
+#ifdef SAMPLING_PROFILER
+#include "profiler.h"
+#endif
+#include "default_dynlib_hashes.h"
 
 //#define ENABLE_DEBUG
 
@@ -64,11 +77,113 @@ static char fake_env[0x1000];
 
 int framecap = 0;
 
-void *__wrap_calloc(uint32_t nmember, uint32_t size) { return vglCalloc(nmember, size); }
-void __wrap_free(void *addr) { vglFree(addr); };
-void *__wrap_malloc(uint32_t size) { return vglMalloc(size); };
-void *__wrap_memalign(uint32_t alignment, uint32_t size) { return vglMemalign(alignment, size); };
-void *__wrap_realloc(void *ptr, uint32_t size) { return vglRealloc(ptr, size); };
+/*
+ * memory pressure: the wrappers keep count of the bytes they hand out. Crossing the
+ * mark of the next pressure level wakes mem_manager right away. Levels already
+ * signalled stay quiet until usage falls back under mem_low, so a reclaim that
+ * frees little doesn't repeat in a loop. mem_manager also wakes up every
+ * MEMORY_POLL_MS to catch pressure from allocations the wrappers never see.
+*/
+static volatile int mem_in_use = 0;
+static int mem_marks[MEM_PRESSURE_LEVELS + 1] = { INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX }; // past critical stays INT_MAX
+static int mem_low = INT_MIN;
+static volatile int mem_signalled = MEM_PRESSURE_NONE;
+static SceUID mem_sema = -1;
+
+static inline int mem_usable_size(void *ptr) {
+	size_t size = slab_usable_size(ptr);
+	return size ? size : vglMallocUsableSize(ptr);
+}
+
+static __attribute__((noinline)) void mem_signal(int in_use) {
+	int level = mem_signalled;
+	while (level < MEM_PRESSURE_CRITICAL && in_use > mem_marks[level + 1]) {
+		if (__atomic_compare_exchange_n(&mem_signalled, &level, level + 1, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+			sceKernelSignalSema(mem_sema, 1);
+			return;
+		}
+	}
+}
+
+static inline void mem_track(int delta) {
+	int in_use = __atomic_add_fetch(&mem_in_use, delta, __ATOMIC_RELAXED);
+	if (delta > 0) {
+		if (__builtin_expect(in_use > mem_marks[mem_signalled + 1], 0))
+			mem_signal(in_use);
+	} else if (__builtin_expect(in_use < mem_low, 0) && mem_signalled) {
+		mem_signalled = MEM_PRESSURE_NONE;
+	}
+}
+
+// Small allocations go through the slab cache, anything it can't serve goes to vitaGL
+static void *mem_alloc(uint32_t size) {
+	void *ptr = slab_alloc(size);
+	return ptr ? ptr : vglMalloc(size);
+}
+
+void *__wrap_malloc(uint32_t size) {
+	void *ptr = mem_alloc(size);
+	if (ptr)
+		mem_track(mem_usable_size(ptr));
+	ALLOC_TRACE(ALLOC_TRACE_MALLOC, ptr, size, 0);
+	return ptr;
+}
+
+void *__wrap_calloc(uint32_t nmember, uint32_t size) {
+	uint64_t total = (uint64_t)nmember * size;
+	void *ptr = total <= SLAB_MAX ? slab_alloc(total) : NULL;
+	if (ptr)
+		sceClibMemset(ptr, 0, total);
+	else
+		ptr = vglCalloc(nmember, size);
+	if (ptr)
+		mem_track(mem_usable_size(ptr));
+	ALLOC_TRACE(ALLOC_TRACE_CALLOC, ptr, total, 0);
+	return ptr;
+}
+
+void __wrap_free(void *addr) {
+	ALLOC_TRACE(ALLOC_TRACE_FREE, addr, 0, 0);
+	if (!addr)
+		return;
+	mem_track(-mem_usable_size(addr));
+	if (!slab_free(addr))
+		vglFree(addr);
+}
+
+void *__wrap_memalign(uint32_t alignment, uint32_t size) {
+	void *ptr = alignment <= SLAB_ALIGN ? slab_alloc(size) : NULL;
+	if (!ptr)
+		ptr = vglMemalign(alignment, size);
+	if (ptr)
+		mem_track(mem_usable_size(ptr));
+	ALLOC_TRACE(ALLOC_TRACE_MEMALIGN, ptr, size, alignment);
+	return ptr;
+}
+
+void *__wrap_realloc(void *ptr, uint32_t size) {
+	void *new_ptr = ptr;
+	size_t old_size = ptr ? slab_usable_size(ptr) : 0;
+	int old_in_use = ptr ? mem_usable_size(ptr) : 0;
+
+	if (!ptr) {
+		new_ptr = mem_alloc(size);
+	} else if (!old_size) {
+		new_ptr = vglRealloc(ptr, size);
+	} else if (size > old_size) {
+		new_ptr = mem_alloc(size);
+		if (new_ptr) {
+			sceClibMemcpy(new_ptr, ptr, old_size);
+			slab_free(ptr);
+		}
+	}
+
+	// A failed realloc leaves the old block in place
+	if (new_ptr)
+		mem_track(mem_usable_size(new_ptr) - old_in_use);
+	ALLOC_TRACE(ALLOC_TRACE_REALLOC, new_ptr, size, (uintptr_t)ptr);
+	return new_ptr;
+}
 
 int file_exists(const char *path) {
 	SceIoStat stat;
@@ -165,57 +280,12 @@ int ret1(void) {
 	return 1;
 }
 
-#define  MUTEX_TYPE_NORMAL	 0x0000
-#define  MUTEX_TYPE_RECURSIVE  0x4000
-#define  MUTEX_TYPE_ERRORCHECK 0x8000
-
 static pthread_t s_pthreadSelfRet;
 
-static void init_static_mutex(pthread_mutex_t **mutex)
-{
-	pthread_mutex_t *mtxMem = NULL;
-
-	switch ((int)*mutex) {
-	case MUTEX_TYPE_NORMAL: {
-		pthread_mutex_t initTmpNormal = PTHREAD_MUTEX_INITIALIZER;
-		mtxMem = calloc(1, sizeof(pthread_mutex_t));
-		sceClibMemcpy(mtxMem, &initTmpNormal, sizeof(pthread_mutex_t));
-		*mutex = mtxMem;
-		break;
-	}
-	case MUTEX_TYPE_RECURSIVE: {
-		pthread_mutex_t initTmpRec = PTHREAD_RECURSIVE_MUTEX_INITIALIZER;
-		mtxMem = calloc(1, sizeof(pthread_mutex_t));
-		sceClibMemcpy(mtxMem, &initTmpRec, sizeof(pthread_mutex_t));
-		*mutex = mtxMem;
-		break;
-	}
-	case MUTEX_TYPE_ERRORCHECK: {
-		pthread_mutex_t initTmpErr = PTHREAD_ERRORCHECK_MUTEX_INITIALIZER;
-		mtxMem = calloc(1, sizeof(pthread_mutex_t));
-		sceClibMemcpy(mtxMem, &initTmpErr, sizeof(pthread_mutex_t));
-		*mutex = mtxMem;
-		break;
-	}
-	default:
-		break;
-	}
-}
-
-static void init_static_cond(pthread_cond_t **cond)
-{
-	if (*cond == NULL) {
-		pthread_cond_t initTmp = PTHREAD_COND_INITIALIZER;
-		pthread_cond_t *condMem = calloc(1, sizeof(pthread_cond_t));
-		sceClibMemcpy(condMem, &initTmp, sizeof(pthread_cond_t));
-		*cond = condMem;
-	}
-}
-
 int pthread_attr_destroy_soloader(pthread_attr_t **attr)
 {
 	int ret = pthread_attr_destroy(*attr);
-	free(*attr);
+	obj_pool_free(&pthread_pool, *attr);
 	return ret;
 }
 
@@ -228,7 +298,7 @@ int pthread_attr_getstack_soloader(const pthread_attr_t **attr,
 
 __attribute__((unused)) int pthread_condattr_init_soloader(pthread_condattr_t **attr)
 {
-	*attr = calloc(1, sizeof(pthread_condattr_t));
+	*attr = obj_pool_alloc(&pthread_pool);
 
 	return pthread_condattr_init(*attr);
 }
@@ -236,14 +306,14 @@ __attribute__((unused)) int pthread_condattr_init_soloader(pthread_condattr_t **
 __attribute__((unused)) int pthread_condattr_destroy_soloader(pthread_condattr_t **attr)
 {
 	int ret = pthread_condattr_destroy(*attr);
-	free(*attr);
+	obj_pool_free(&pthread_pool, *attr);
 	return ret;
 }
 
 int pthread_cond_init_soloader(pthread_cond_t **cond,
 				   const pthread_condattr_t **attr)
 {
-	*cond = calloc(1, sizeof(pthread_cond_t));
+	*cond = obj_pool_alloc(&pthread_pool);
 
 	if (attr != NULL)
 		return pthread_cond_init(*cond, *attr);
@@ -253,24 +323,44 @@ int pthread_cond_init_soloader(pthread_cond_t **cond,
 
 int pthread_cond_destroy_soloader(pthread_cond_t **cond)
 {
+	// Never used, so still the static initializer and nothing was allocated
+	if (!*cond)
+		return 0;
 	int ret = pthread_cond_destroy(*cond);
-	free(*cond);
+	obj_pool_free(&pthread_pool, *cond);
+	*cond = NULL;
 	return ret;
 }
 
 int pthread_cond_signal_soloader(pthread_cond_t **cond)
 {
-	init_static_cond(cond);
-	return pthread_cond_signal(*cond);
+	return pthread_cond_signal(init_static_cond(cond));
 }
 
 int pthread_cond_timedwait_soloader(pthread_cond_t **cond,
 					pthread_mutex_t **mutex,
 					struct timespec *abstime)
 {
-	init_static_cond(cond);
-	init_static_mutex(mutex);
-	return pthread_cond_timedwait(*cond, *mutex, abstime);
+	return pthread_cond_timedwait(init_static_cond(cond), init_static_mutex(mutex), abstime);
+}
+
+typedef struct {
+	void *(*start)(void *);
+	void *param;
+} thread_start;
+
+// Game threads give their slab magazines back when they return
+static void *thread_entry(void *arg)
+{
+	thread_start ts = *(thread_start *)arg;
+	free(arg);
+
+	void *ret = ts.start(ts.param);
+	slab_thread_exit();
+#ifdef TRACE_ALLOCS
+	alloc_trace_thread_exit();
+#endif
+	return ret;
 }
 
 int pthread_create_soloader(pthread_t **thread,
@@ -279,22 +369,36 @@ int pthread_create_soloader(pthread_t **thread,
 				void *param)
 {
 	*thread = calloc(1, sizeof(pthread_t));
+	thread_start *ts = malloc(sizeof(thread_start));
+	if (!*thread || !ts) {
+		free(*thread);
+		free(ts);
+		*thread = NULL;
+		return EAGAIN;
+	}
+
+	ts->start = start;
+	ts->param = param;
 
+	int ret;
 	if (attr != NULL) {
 		pthread_attr_setstacksize(*attr, 512 * 1024);
-		return pthread_create(*thread, *attr, start, param);
+		ret = pthread_create(*thread, *attr, thread_entry, ts);
 	} else {
 		pthread_attr_t attrr;
 		pthread_attr_init(&attrr);
 		pthread_attr_setstacksize(&attrr, 512 * 1024);
-		return pthread_create(*thread, &attrr, start, param);
+		ret = pthread_create(*thread, &attrr, thread_entry, ts);
 	}
 
+	if (ret != 0)
+		free(ts);
+	return ret;
 }
 
 int pthread_mutexattr_init_soloader(pthread_mutexattr_t **attr)
 {
-	*attr = calloc(1, sizeof(pthread_mutexattr_t));
+	*attr = obj_pool_alloc(&pthread_pool);
 
 	return pthread_mutexattr_init(*attr);
 }
@@ -312,21 +416,25 @@ int pthread_mutexattr_setpshared_soloader(pthread_mutexattr_t **attr, int pshare
 int pthread_mutexattr_destroy_soloader(pthread_mutexattr_t **attr)
 {
 	int ret = pthread_mutexattr_destroy(*attr);
-	free(*attr);
+	obj_pool_free(&pthread_pool, *attr);
 	return ret;
 }
 
 int pthread_mutex_destroy_soloader(pthread_mutex_t **mutex)
 {
+	// Still holding one of the static initializer tags, nothing was allocated
+	if ((uintptr_t)*mutex <= MUTEX_TYPE_ERRORCHECK)
+		return 0;
 	int ret = pthread_mutex_destroy(*mutex);
-	free(*mutex);
+	obj_pool_free(&pthread_pool, *mutex);
+	*mutex = NULL;
 	return ret;
 }
 
 int pthread_mutex_init_soloader(pthread_mutex_t **mutex,
 				const pthread_mutexattr_t **attr)
 {
-	*mutex = calloc(1, sizeof(pthread_mutex_t));
+	*mutex = obj_pool_alloc(&pthread_pool);
 
 	if (attr != NULL)
 		return pthread_mutex_init(*mutex, *attr);
@@ -336,14 +444,12 @@ int pthread_mutex_init_soloader(pthread_mutex_t **mutex,
 
 int pthread_mutex_lock_soloader(pthread_mutex_t **mutex)
 {
-	init_static_mutex(mutex);
-	return pthread_mutex_lock(*mutex);
+	return pthread_mutex_lock(init_static_mutex(mutex));
 }
 
 int pthread_mutex_trylock_soloader(pthread_mutex_t **mutex)
 {
-	init_static_mutex(mutex);
-	return pthread_mutex_trylock(*mutex);
+	return pthread_mutex_trylock(init_static_mutex(mutex));
 }
 
 int pthread_mutex_unlock_soloader(pthread_mutex_t **mutex)
@@ -358,17 +464,17 @@ int pthread_join_soloader(const pthread_t *thread, void **value_ptr)
 
 int pthread_cond_wait_soloader(pthread_cond_t **cond, pthread_mutex_t **mutex)
 {
-	return pthread_cond_wait(*cond, *mutex);
+	return pthread_cond_wait(init_static_cond(cond), init_static_mutex(mutex));
 }
 
 int pthread_cond_broadcast_soloader(pthread_cond_t **cond)
 {
-	return pthread_cond_broadcast(*cond);
+	return pthread_cond_broadcast(init_static_cond(cond));
 }
 
 int pthread_attr_init_soloader(pthread_attr_t **attr)
 {
-	*attr = calloc(1, sizeof(pthread_attr_t));
+	*attr = obj_pool_alloc(&pthread_pool);
 
 	return pthread_attr_init(*attr);
 }
@@ -487,10 +593,11 @@ FILE *fopen_hook(char *fname, char *mode) {
 	dlog("fopen(%s,%s)\n", fname, mode);
 	if (strncmp(fname, "ux0:", 4)) {
 		sprintf(real_fname, "%s/%s", data_path, fname);
-		f = fopen(real_fname, mode);
-	} else {
-		f = fopen(fname, mode);
+		fname = real_fname;
 	}
+	if (strpbrk(mode, "wa+"))
+		mmap_emu_invalidate(fname);
+	f = fopen(fname, mode);
 	return f;
 }
 
@@ -500,13 +607,21 @@ int open_hook(const char *fname, int flags, mode_t mode) {
 	dlog("open(%s)\n", fname);
 	if (strncmp(fname, "ux0:", 4)) {
 		sprintf(real_fname, "%s/%s", data_path, fname);
-		f = open(real_fname, flags, mode);
-	} else {
-		f = open(fname, flags, mode);
+		fname = real_fname;
 	}
+	if (flags & (O_WRONLY | O_RDWR))
+		mmap_emu_invalidate(fname);
+	f = open(fname, flags, mode);
+	if (f >= 0)
+		mmap_emu_open(f, fname);
 	return f;
 }
 
+int close_hook(int fd) {
+	mmap_emu_close(fd);
+	return close(fd);
+}
+
 extern void *__aeabi_atexit;
 extern void *__aeabi_ddiv;
 extern void *__aeabi_dmul;
@@ -541,12 +656,11 @@ int stat_hook(const char *pathname, void *statbuf) {
 }
 
 void *mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset) {
-	return memalign(0x1000, length);
+	return mmap_emu(addr, length, prot, flags, fd, offset);
 }
 
 int munmap(void *addr, size_t length) {
-	free(addr);
-	return 0;
+	return munmap_emu(addr, length);
 }
 
 int fstat_hook(int fd, void *statbuf) {
@@ -615,14 +729,15 @@ GLint glGetUniformLocation_fake(GLuint program, const GLchar *name) {
 }
 
 static so_default_dynlib gl_hook[] = {
-	{"glPixelStorei", (uintptr_t)&ret0},
+	{"glPixelStorei", (uintptr_t)&ret0, SO_GNU_HASH("glPixelStorei")},
 };
 static size_t gl_numhook = sizeof(gl_hook) / sizeof(*gl_hook);
 
 void *SDL_GL_GetProcAddress_fake(const char *symbol) {
 	dlog("looking for symbol %s\n", symbol);
+	uint32_t hash = so_gnu_hash((const uint8_t *)symbol);
 	for (size_t i = 0; i < gl_numhook; ++i) {
-		if (!strcmp(symbol, gl_hook[i].symbol)) {
+		if ((hash == gl_hook[i].hash || !gl_hook[i].hash) && !strcmp(symbol, gl_hook[i].symbol)) {
 			return (void *)gl_hook[i].func;
 		}
 	}
@@ -881,7 +996,7 @@ static so_default_dynlib default_dynlib[] = {
 	{ "clearerr", (uintptr_t)&clearerr },
 	{ "clock", (uintptr_t)&clock },
 	{ "clock_gettime", (uintptr_t)&clock_gettime_hook },
-	{ "close", (uintptr_t)&close },
+	{ "close", (uintptr_t)&close_hook },
 	{ "cos", (uintptr_t)&cos },
 	{ "cosf", (uintptr_t)&cosf },
 	{ "cosh", (uintptr_t)&cosh },
@@ -985,8 +1100,8 @@ static so_default_dynlib default_dynlib[] = {
 	{ "memmove", (uintptr_t)&memmove },
 	{ "memset", (uintptr_t)&sceClibMemset },
 	{ "mkdir", (uintptr_t)&mkdir },
-	// { "mmap", (uintptr_t)&mmap},
-	// { "munmap", (uintptr_t)&munmap},
+	{ "mmap", (uintptr_t)&mmap },
+	{ "munmap", (uintptr_t)&munmap },
 	{ "modf", (uintptr_t)&modf },
 	{ "modff", (uintptr_t)&modff },
 	// { "poll", (uintptr_t)&poll },
@@ -1398,6 +1513,8 @@ static so_default_dynlib default_dynlib[] = {
 	{ "strnlen", (uintptr_t)&strnlen },
 };
 static size_t numhooks = sizeof(default_dynlib) / sizeof(*default_dynlib);
+_Static_assert(sizeof(default_dynlib_hashes) / sizeof(*default_dynlib_hashes) == sizeof(default_dynlib) / sizeof(*default_dynlib),
+	"default_dynlib_hashes.h is out of date");
 
 int check_kubridge(void) {
 	int search_unk[2];
@@ -1413,18 +1530,20 @@ enum MethodIDs {
 typedef struct {
 	char *name;
 	enum MethodIDs id;
+	uint32_t hash;
 } NameToMethodID;
 
 static NameToMethodID name_to_method_ids[] = {
-	{ "<init>", INIT },
-	{ "getLanguage", GET_LANGUAGE },
+	{ "<init>", INIT, SO_GNU_HASH("<init>") },
+	{ "getLanguage", GET_LANGUAGE, SO_GNU_HASH("getLanguage") },
 };
 
 int GetMethodID(void *env, void *class, const char *name, const char *sig) {
 	printf("GetMethodID: %s\n", name);
 
+	uint32_t hash = so_gnu_hash((const uint8_t *)name);
 	for (int i = 0; i < sizeof(name_to_method_ids) / sizeof(NameToMethodID); i++) {
-		if (strcmp(name, name_to_method_ids[i].name) == 0) {
+		if ((hash == name_to_method_ids[i].hash || !name_to_method_ids[i].hash) && strcmp(name, name_to_method_ids[i].name) == 0) {
 			return name_to_method_ids[i].id;
 		}
 	}
@@ -1435,8 +1554,9 @@ int GetMethodID(void *env, void *class, const char *name, const char *sig) {
 int GetStaticMethodID(void *env, void *class, const char *name, const char *sig) {
 	printf("GetStaticMethodID: %s\n", name);
 	
+	uint32_t hash = so_gnu_hash((const uint8_t *)name);
 	for (int i = 0; i < sizeof(name_to_method_ids) / sizeof(NameToMethodID); i++) {
-		if (strcmp(name, name_to_method_ids[i].name) == 0)
+		if ((hash == name_to_method_ids[i].hash || !name_to_method_ids[i].hash) && strcmp(name, name_to_method_ids[i].name) == 0)
 			return name_to_method_ids[i].id;
 	}
 
@@ -1667,1420 +1787,1521 @@ int dataFromFilename(uint32_t *this, uint32_t *a1, float *a2) {
 	return ret;
 }
 
+static so_default_dynlib game_hooks[] = {
+	//{ "_Z5GGLogPKcz", (uintptr_t)&GGLog },
+	{ "_Z11GGErrorFuncPKcz", (uintptr_t)&ret0 },
+
+	{ "_ZN6GGCurl13httpPostASyncEP8GGStringP12GGDictionary", (uintptr_t)&ret0 },
+	{ "_ZN9Analytics6uploadEv", (uintptr_t)&ret0 },
+	{ "_Z11InitObbPathv", (uintptr_t)&InitObbPath },
+
+	{ "IMG_Linked_Version", (uintptr_t)&IMG_Linked_Version },
+	{ "IMG_Init", (uintptr_t)&IMG_Init },
+	{ "IMG_Quit", (uintptr_t)&IMG_Quit },
+	{ "IMG_LoadTyped_RW", (uintptr_t)&IMG_LoadTyped_RW },
+	{ "IMG_Load", (uintptr_t)&IMG_Load_hook },
+	{ "IMG_Load_RW", (uintptr_t)&IMG_Load_RW },
+	{ "IMG_LoadTexture", (uintptr_t)&IMG_LoadTexture },
+	{ "IMG_LoadTexture_RW", (uintptr_t)&IMG_LoadTexture_RW },
+	{ "IMG_LoadTextureTyped_RW", (uintptr_t)&IMG_LoadTextureTyped_RW },
+	{ "IMG_isXPM", (uintptr_t)&IMG_isXPM },
+	{ "IMG_LoadXPM_RW", (uintptr_t)&IMG_LoadXPM_RW },
+	{ "IMG_ReadXPMFromArray", (uintptr_t)&IMG_ReadXPMFromArray },
+	//{ "IMG_InitPNG", (uintptr_t)&IMG_InitPNG },
+	//{ "IMG_QuitPNG", (uintptr_t)&IMG_QuitPNG },
+	{ "IMG_isPNG", (uintptr_t)&IMG_isPNG },
+	{ "IMG_LoadPNG_RW", (uintptr_t)&IMG_LoadPNG_RW },
+	{ "IMG_SavePNG_RW", (uintptr_t)&IMG_SavePNG_RW },
+	{ "IMG_SavePNG", (uintptr_t)&IMG_SavePNG },
+	//{ "IMG_InitJPG", (uintptr_t)&IMG_InitJPG },
+	//{ "IMG_QuitJPG", (uintptr_t)&IMG_QuitJPG },
+	{ "IMG_isJPG", (uintptr_t)&IMG_isJPG },
+	{ "IMG_LoadJPG_RW", (uintptr_t)&IMG_LoadJPG_RW },
+	{ "IMG_isBMP", (uintptr_t)&IMG_isBMP },
+	{ "IMG_isICO", (uintptr_t)&IMG_isICO },
+	{ "IMG_isCUR", (uintptr_t)&IMG_isCUR },
+	{ "IMG_LoadBMP_RW", (uintptr_t)&IMG_LoadBMP_RW },
+	{ "IMG_LoadICO_RW", (uintptr_t)&IMG_LoadICO_RW },
+	{ "IMG_LoadCUR_RW", (uintptr_t)&IMG_LoadCUR_RW },
+	{ "IMG_isPCX", (uintptr_t)&IMG_isPCX },
+	{ "IMG_LoadPCX_RW", (uintptr_t)&IMG_LoadPCX_RW },
+	//{ "IMG_InitWEBP", (uintptr_t)&IMG_InitWEBP },
+	//{ "IMG_QuitWEBP", (uintptr_t)&IMG_QuitWEBP },
+	//{ "IMG_isWEB", (uintptr_t)&IMG_isWEB },
+	{ "IMG_LoadWEBP_RW", (uintptr_t)&IMG_LoadWEBP_RW },
+	{ "IMG_isXCF", (uintptr_t)&IMG_isXCF },
+	{ "IMG_LoadXCF_RW", (uintptr_t)&IMG_LoadXCF_RW },
+	{ "IMG_isGIF", (uintptr_t)&IMG_isGIF },
+	{ "IMG_LoadGIF_RW", (uintptr_t)&IMG_LoadGIF_RW },
+	{ "IMG_LoadTGA_RW", (uintptr_t)&IMG_LoadTGA_RW },
+	//{ "IMG_InitTIF", (uintptr_t)&IMG_InitTIF },
+	//{ "IMG_QuitTIF", (uintptr_t)&IMG_QuitTIF },
+	{ "IMG_isTIF", (uintptr_t)&IMG_isTIF },
+	{ "IMG_LoadTIF_RW", (uintptr_t)&IMG_LoadTIF_RW },
+	{ "IMG_isPNM", (uintptr_t)&IMG_isPNM },
+	{ "IMG_LoadPNM_RW", (uintptr_t)&IMG_LoadPNM_RW },
+	{ "IMG_isLBM", (uintptr_t)&IMG_isLBM },
+	{ "IMG_LoadLBM_RW", (uintptr_t)&IMG_LoadLBM_RW },
+	{ "IMG_isXV", (uintptr_t)&IMG_isXV },
+	{ "IMG_LoadXV_RW", (uintptr_t)&IMG_LoadXV_RW },
+
+	//{ "SDL_AddBasicVideoDisplay", (uintptr_t)&SDL_AddBasicVideoDisplay },
+	//{ "SDL_AddDisplayMode", (uintptr_t)&SDL_AddDisplayMode },
+	{ "SDL_AddEventWatch", (uintptr_t)&SDL_AddEventWatch },
+	{ "SDL_AddTimer", (uintptr_t)&SDL_AddTimer },
+	//{ "SDL_AddTouch", (uintptr_t)&SDL_AddTouch },
+	//{ "SDL_AddVideoDisplay", (uintptr_t)&SDL_AddVideoDisplay },
+	//{ "SDL_AllocBlitMap", (uintptr_t)&SDL_AllocBlitMap },
+	{ "SDL_AllocFormat", (uintptr_t)&SDL_AllocFormat },
+	{ "SDL_AllocPalette", (uintptr_t)&SDL_AllocPalette },
+	{ "SDL_AllocRW", (uintptr_t)&SDL_AllocRW },
+	{ "SDL_AndroidGetActivity", (uintptr_t)&ret0 },
+	{ "SDL_AndroidGetActivity_REAL", (uintptr_t)&ret0 },
+	{ "SDL_AndroidGetExternalCachePath", (uintptr_t)&SDL_AndroidGetExternalStoragePath },
+	{ "SDL_AndroidGetExternalStoragePath", (uintptr_t)&SDL_AndroidGetExternalStoragePath },
+	{ "SDL_AndroidGetExternalStorageState", (uintptr_t)&ret0 },
+	{ "SDL_AndroidGetInternalStoragePath", (uintptr_t)&SDL_AndroidGetInternalStoragePath },
+	{ "SDL_AndroidGetInternalStoragePath_REAL", (uintptr_t)&SDL_AndroidGetInternalStoragePath },
+	{ "SDL_AndroidGetJNIEnv", (uintptr_t)&Android_JNI_GetEnv },
+	{ "Android_JNI_GetEnv", (uintptr_t)&Android_JNI_GetEnv },
+	{ "SDL_Android_Init", (uintptr_t)&ret0 },
+	//{ "SDL_AssertionsInit", (uintptr_t)&SDL_AssertionsInit },
+	//{ "SDL_AssertionsQuit", (uintptr_t)&SDL_AssertionsQuit },
+	{ "SDL_AtomicCAS", (uintptr_t)&SDL_AtomicCAS },
+	{ "SDL_AtomicCASPtr", (uintptr_t)&SDL_AtomicCASPtr },
+	{ "SDL_AtomicLock", (uintptr_t)&SDL_AtomicLock },
+	{ "SDL_AtomicTryLock", (uintptr_t)&SDL_AtomicTryLock },
+	{ "SDL_AtomicUnlock", (uintptr_t)&SDL_AtomicUnlock },
+	{ "SDL_AudioInit", (uintptr_t)&SDL_AudioInit },
+	{ "SDL_AudioQuit", (uintptr_t)&SDL_AudioQuit },
+	//{ "SDL_BlendFillRect", (uintptr_t)&SDL_BlendFillRect },
+	//{ "SDL_BlendFillRects", (uintptr_t)&SDL_BlendFillRects },
+	//{ "SDL_BlendLine", (uintptr_t)&SDL_BlendLine },
+	//{ "SDL_BlendLines", (uintptr_t)&SDL_BlendLines },
+	//{ "SDL_BlendPoint", (uintptr_t)&SDL_BlendPoint },
+	//{ "SDL_BlendPoints", (uintptr_t)&SDL_BlendPoints },
+	//{ "SDL_BlitCopy", (uintptr_t)&SDL_BlitCopy },
+	//{ "SDL_Blit_Slow", (uintptr_t)&SDL_Blit_Slow },
+	{ "SDL_BuildAudioCVT", (uintptr_t)&SDL_BuildAudioCVT },
+	//{ "SDL_CalculateAudioSpec", (uintptr_t)&SDL_CalculateAudioSpec },
+	//{ "SDL_CalculateBlit", (uintptr_t)&SDL_CalculateBlit },
+	//{ "SDL_CalculateBlit0", (uintptr_t)&SDL_CalculateBlit0 },
+	//{ "SDL_CalculateBlit1", (uintptr_t)&SDL_CalculateBlit1 },
+	//{ "SDL_CalculateBlitA", (uintptr_t)&SDL_CalculateBlitA },
+	//{ "SDL_CalculateBlitN", (uintptr_t)&SDL_CalculateBlitN },
+	//{ "SDL_CalculateGammaRamp", (uintptr_t)&SDL_CalculateGammaRamp },
+	//{ "SDL_CalculatePitch", (uintptr_t)&SDL_CalculatePitch },
+	//{ "SDL_CalculateShapeBitmap", (uintptr_t)&SDL_CalculateShapeBitmap },
+	//{ "SDL_CalculateShapeTree", (uintptr_t)&SDL_CalculateShapeTree },
+	{ "SDL_ClearError", (uintptr_t)&SDL_ClearError },
+	{ "SDL_ClearHints", (uintptr_t)&SDL_ClearHints },
+	{ "SDL_CloseAudio", (uintptr_t)&SDL_CloseAudio },
+	{ "SDL_CloseAudioDevice", (uintptr_t)&SDL_CloseAudioDevice },
+	{ "SDL_CondBroadcast", (uintptr_t)&SDL_CondBroadcast },
+	{ "SDL_CondSignal", (uintptr_t)&SDL_CondSignal },
+	{ "SDL_CondWait", (uintptr_t)&SDL_CondWait },
+	{ "SDL_CondWaitTimeout", (uintptr_t)&SDL_CondWaitTimeout },
+	{ "SDL_ConvertAudio", (uintptr_t)&SDL_ConvertAudio },
+	{ "SDL_ConvertPixels", (uintptr_t)&SDL_ConvertPixels },
+	{ "SDL_ConvertSurface", (uintptr_t)&SDL_ConvertSurface },
+	{ "SDL_ConvertSurfaceFormat", (uintptr_t)&SDL_ConvertSurfaceFormat },
+	{ "SDL_CreateColorCursor", (uintptr_t)&SDL_CreateColorCursor },
+	{ "SDL_CreateCond", (uintptr_t)&SDL_CreateCond },
+	{ "SDL_CreateCursor", (uintptr_t)&SDL_CreateCursor },
+	{ "SDL_CreateMutex", (uintptr_t)&SDL_CreateMutex },
+	{ "SDL_CreateRGBSurface", (uintptr_t)&SDL_CreateRGBSurface },
+	{ "SDL_CreateRGBSurfaceFrom", (uintptr_t)&SDL_CreateRGBSurfaceFrom },
+	{ "SDL_CreateRenderer", (uintptr_t)&SDL_CreateRenderer },
+	{ "SDL_CreateSemaphore", (uintptr_t)&SDL_CreateSemaphore },
+	{ "SDL_CreateShapedWindow", (uintptr_t)&SDL_CreateShapedWindow },
+	{ "SDL_CreateSoftwareRenderer", (uintptr_t)&SDL_CreateSoftwareRenderer },
+	{ "SDL_CreateSystemCursor", (uintptr_t)&SDL_CreateSystemCursor },
+	{ "SDL_CreateTexture", (uintptr_t)&SDL_CreateTexture },
+	{ "SDL_CreateTextureFromSurface", (uintptr_t)&SDL_CreateTextureFromSurface },
+	{ "SDL_CreateThread", (uintptr_t)&SDL_CreateThread },
+	{ "SDL_CreateWindow", (uintptr_t)&SDL_CreateWindow },
+	{ "SDL_CreateWindowAndRenderer", (uintptr_t)&SDL_CreateWindowAndRenderer },
+	{ "SDL_CreateWindowFrom", (uintptr_t)&SDL_CreateWindowFrom },
+	{ "SDL_DelEventWatch", (uintptr_t)&SDL_DelEventWatch },
+	//{ "SDL_DelFinger", (uintptr_t)&SDL_DelFinger },
+	//{ "SDL_DelTouch", (uintptr_t)&SDL_DelTouch },
+	{ "SDL_Delay", (uintptr_t)&SDL_Delay },
+	{ "SDL_DestroyCond", (uintptr_t)&SDL_DestroyCond },
+	{ "SDL_DestroyMutex", (uintptr_t)&SDL_DestroyMutex },
+	{ "SDL_DestroyRenderer", (uintptr_t)&SDL_DestroyRenderer },
+	{ "SDL_DestroySemaphore", (uintptr_t)&SDL_DestroySemaphore },
+	{ "SDL_DestroyTexture", (uintptr_t)&SDL_DestroyTexture },
+	{ "SDL_DestroyWindow", (uintptr_t)&SDL_DestroyWindow },
+	{ "SDL_DisableScreenSaver", (uintptr_t)&SDL_DisableScreenSaver },
+	//{ "SDL_DitherColors", (uintptr_t)&SDL_DitherColors },
+	//{ "SDL_DrawLine", (uintptr_t)&SDL_DrawLine },
+	//{ "SDL_DrawLines", (uintptr_t)&SDL_DrawLines },
+	//{ "SDL_DrawPoint", (uintptr_t)&SDL_DrawPoint },
+	//{ "SDL_DrawPoints", (uintptr_t)&SDL_DrawPoints },
+	{ "SDL_EnableScreenSaver", (uintptr_t)&SDL_EnableScreenSaver },
+	{ "SDL_EnclosePoints", (uintptr_t)&SDL_EnclosePoints },
+	{ "SDL_Error", (uintptr_t)&SDL_Error },
+	{ "SDL_EventState", (uintptr_t)&SDL_EventState },
+	{ "SDL_FillRect", (uintptr_t)&SDL_FillRect },
+	{ "SDL_FillRects", (uintptr_t)&SDL_FillRects },
+	{ "SDL_FilterEvents", (uintptr_t)&SDL_FilterEvents },
+	//{ "SDL_FindColor", (uintptr_t)&SDL_FindColor },
+	//{ "SDL_FirstAudioFormat", (uintptr_t)&SDL_FirstAudioFormat },
+	{ "SDL_FlushEvent", (uintptr_t)&SDL_FlushEvent },
+	{ "SDL_FlushEvents", (uintptr_t)&SDL_FlushEvents },
+	//{ "SDL_FreeBlitMap", (uintptr_t)&SDL_FreeBlitMap },
+	{ "SDL_FreeCursor", (uintptr_t)&SDL_FreeCursor },
+	{ "SDL_FreeFormat", (uintptr_t)&SDL_FreeFormat },
+	{ "SDL_FreePalette", (uintptr_t)&SDL_FreePalette },
+	{ "SDL_FreeRW", (uintptr_t)&SDL_FreeRW },
+	//{ "SDL_FreeShapeTree", (uintptr_t)&SDL_FreeShapeTree },
+	{ "SDL_FreeSurface", (uintptr_t)&SDL_FreeSurface },
+	{ "SDL_FreeWAV", (uintptr_t)&SDL_FreeWAV },
+	{ "SDL_GL_BindTexture", (uintptr_t)&SDL_GL_BindTexture },
+	{ "SDL_GL_CreateContext", (uintptr_t)&SDL_GL_CreateContext },
+	{ "SDL_GL_DeleteContext", (uintptr_t)&SDL_GL_DeleteContext },
+	{ "SDL_GL_ExtensionSupported", (uintptr_t)&SDL_GL_ExtensionSupported },
+	{ "SDL_GL_GetAttribute", (uintptr_t)&SDL_GL_GetAttribute },
+	{ "SDL_GL_GetProcAddress", (uintptr_t)&SDL_GL_GetProcAddress },
+	{ "SDL_GL_GetSwapInterval", (uintptr_t)&SDL_GL_GetSwapInterval },
+	{ "SDL_GL_LoadLibrary", (uintptr_t)&SDL_GL_LoadLibrary },
+	{ "SDL_GL_MakeCurrent", (uintptr_t)&SDL_GL_MakeCurrent },
+	{ "SDL_GL_SetAttribute", (uintptr_t)&SDL_GL_SetAttribute },
+	{ "SDL_GL_SetSwapInterval", (uintptr_t)&SDL_GL_SetSwapInterval },
+	{ "SDL_GL_SwapWindow", (uintptr_t)&SDL_GL_SwapWindow },
+	{ "SDL_GL_UnbindTexture", (uintptr_t)&SDL_GL_UnbindTexture },
+	{ "SDL_GL_UnloadLibrary", (uintptr_t)&SDL_GL_UnloadLibrary },
+	{ "SDL_GameControllerAddMapping", (uintptr_t)&SDL_GameControllerAddMapping },
+	{ "SDL_GameControllerClose", (uintptr_t)&SDL_GameControllerClose },
+	{ "SDL_GameControllerEventState", (uintptr_t)&SDL_GameControllerEventState },
+	//{ "SDL_GameControllerEventWatcher", (uintptr_t)&SDL_GameControllerEventWatcher },
+	{ "SDL_GameControllerGetAttached", (uintptr_t)&SDL_GameControllerGetAttached },
+	{ "SDL_GameControllerGetAxis", (uintptr_t)&SDL_GameControllerGetAxis },
+	{ "SDL_GameControllerGetAxisFromString", (uintptr_t)&SDL_GameControllerGetAxisFromString },
+	{ "SDL_GameControllerGetBindForAxis", (uintptr_t)&SDL_GameControllerGetBindForAxis },
+	{ "SDL_GameControllerGetBindForButton", (uintptr_t)&SDL_GameControllerGetBindForButton },
+	{ "SDL_GameControllerGetButton", (uintptr_t)&SDL_GameControllerGetButton },
+	{ "SDL_GameControllerGetButtonFromString", (uintptr_t)&SDL_GameControllerGetButtonFromString },
+	{ "SDL_GameControllerGetJoystick", (uintptr_t)&SDL_GameControllerGetJoystick },
+	{ "SDL_GameControllerGetStringForAxis", (uintptr_t)&SDL_GameControllerGetStringForAxis },
+	{ "SDL_GameControllerGetStringForButton", (uintptr_t)&SDL_GameControllerGetStringForButton },
+	//{ "SDL_GameControllerInit", (uintptr_t)&SDL_GameControllerInit },
+	{ "SDL_GameControllerMapping", (uintptr_t)&SDL_GameControllerMapping },
+	{ "SDL_GameControllerMappingForGUID", (uintptr_t)&SDL_GameControllerMappingForGUID },
+	{ "SDL_GameControllerName", (uintptr_t)&SDL_GameControllerName },
+	{ "SDL_GameControllerNameForIndex", (uintptr_t)&SDL_GameControllerNameForIndex },
+	{ "SDL_GameControllerOpen", (uintptr_t)&SDL_GameControllerOpen },
+	//{ "SDL_GameControllerQuit", (uintptr_t)&SDL_GameControllerQuit },
+	{ "SDL_GameControllerUpdate", (uintptr_t)&SDL_GameControllerUpdate },
+	//{ "SDL_GestureAddTouch", (uintptr_t)&SDL_GestureAddTouch },
+	//{ "SDL_GestureProcessEvent", (uintptr_t)&SDL_GestureProcessEvent },
+	{ "SDL_GetAssertionReport", (uintptr_t)&SDL_GetAssertionReport },
+	{ "SDL_GetAudioDeviceName", (uintptr_t)&SDL_GetAudioDeviceName },
+	{ "SDL_GetAudioDeviceStatus", (uintptr_t)&SDL_GetAudioDeviceStatus },
+	{ "SDL_GetAudioDriver", (uintptr_t)&SDL_GetAudioDriver },
+	{ "SDL_GetAudioStatus", (uintptr_t)&SDL_GetAudioStatus },
+	{ "SDL_GetCPUCacheLineSize", (uintptr_t)&SDL_GetCPUCacheLineSize },
+	{ "SDL_GetCPUCount", (uintptr_t)&SDL_GetCPUCount },
+	{ "SDL_GetClipRect", (uintptr_t)&SDL_GetClipRect },
+	{ "SDL_GetClipboardText", (uintptr_t)&SDL_GetClipboardText },
+	{ "SDL_GetClosestDisplayMode", (uintptr_t)&SDL_GetClosestDisplayMode },
+	{ "SDL_GetColorKey", (uintptr_t)&SDL_GetColorKey },
+	{ "SDL_GetCurrentAudioDriver", (uintptr_t)&SDL_GetCurrentAudioDriver },
+	{ "SDL_GetCurrentDisplayMode", (uintptr_t)&SDL_GetCurrentDisplayMode },
+	{ "SDL_GetCurrentVideoDriver", (uintptr_t)&SDL_GetCurrentVideoDriver },
+	{ "SDL_GetCursor", (uintptr_t)&SDL_GetCursor },
+	//{ "SDL_GetDefaultKeymap", (uintptr_t)&SDL_GetDefaultKeymap },
+	{ "SDL_GetDesktopDisplayMode", (uintptr_t)&SDL_GetDesktopDisplayMode },
+	{ "SDL_GetDisplayBounds", (uintptr_t)&SDL_GetDisplayBounds },
+	//{ "SDL_GetDisplayForWindow", (uintptr_t)&SDL_GetDisplayForWindow },
+	{ "SDL_GetDisplayMode", (uintptr_t)&SDL_GetDisplayMode },
+	{ "SDL_GetDisplayName", (uintptr_t)&SDL_GetDisplayName },
+	//{ "SDL_GetErrBuf", (uintptr_t)&SDL_GetErrBuf },
+	{ "SDL_GetError", (uintptr_t)&SDL_GetError },
+	{ "SDL_GetEventFilter", (uintptr_t)&SDL_GetEventFilter },
+	//{ "SDL_GetFinger", (uintptr_t)&SDL_GetFinger },
+	//{ "SDL_GetFocusWindow", (uintptr_t)&SDL_GetFocusWindow },
+	{ "SDL_GetHint", (uintptr_t)&SDL_GetHint },
+	{ "SDL_GetKeyFromName", (uintptr_t)&SDL_GetKeyFromName },
+	{ "SDL_GetKeyFromScancode", (uintptr_t)&SDL_GetKeyFromScancode },
+	{ "SDL_GetKeyName", (uintptr_t)&SDL_GetKeyName },
+	{ "SDL_GetKeyboardFocus", (uintptr_t)&SDL_GetKeyboardFocus },
+	{ "SDL_GetKeyboardState", (uintptr_t)&SDL_GetKeyboardState },
+	{ "SDL_GetModState", (uintptr_t)&SDL_GetModState },
+	//{ "SDL_GetMouse", (uintptr_t)&SDL_GetMouse },
+	{ "SDL_GetMouseFocus", (uintptr_t)&SDL_GetMouseFocus },
+	{ "SDL_GetMouseState", (uintptr_t)&SDL_GetMouseState },
+	{ "SDL_GetNumAudioDevices", (uintptr_t)&SDL_GetNumAudioDevices },
+	{ "SDL_GetNumAudioDrivers", (uintptr_t)&SDL_GetNumAudioDrivers },
+	{ "SDL_GetNumDisplayModes", (uintptr_t)&SDL_GetNumDisplayModes },
+	{ "SDL_GetNumRenderDrivers", (uintptr_t)&SDL_GetNumRenderDrivers },
+	{ "SDL_GetNumTouchDevices", (uintptr_t)&SDL_GetNumTouchDevices },
+	{ "SDL_GetNumTouchFingers", (uintptr_t)&SDL_GetNumTouchFingers },
+	{ "SDL_GetNumVideoDisplays", (uintptr_t)&SDL_GetNumVideoDisplays },
+	{ "SDL_GetNumVideoDrivers", (uintptr_t)&SDL_GetNumVideoDrivers },
+	{ "SDL_GetPerformanceCounter", (uintptr_t)&SDL_GetPerformanceCounter },
+	{ "SDL_GetPerformanceFrequency", (uintptr_t)&SDL_GetPerformanceFrequency },
+	{ "SDL_GetPixelFormatName", (uintptr_t)&SDL_GetPixelFormatName },
+	{ "SDL_GetPlatform", (uintptr_t)&SDL_GetPlatform },
+	{ "SDL_GetPowerInfo", (uintptr_t)&SDL_GetPowerInfo },
+	{ "SDL_GetPrefPath", (uintptr_t)&SDL_GetPrefPath_hook },
+	{ "SDL_GetPrefPath_REAL", (uintptr_t)&SDL_GetPrefPath_hook },
+	//{ "SDL_GetPowerInfo_Android", (uintptr_t)&SDL_GetPowerInfo_Android },
+	{ "SDL_GetRGB", (uintptr_t)&SDL_GetRGB },
+	{ "SDL_GetRGBA", (uintptr_t)&SDL_GetRGBA },
+	{ "SDL_GetRelativeMouseMode", (uintptr_t)&SDL_GetRelativeMouseMode },
+	{ "SDL_GetRelativeMouseState", (uintptr_t)&SDL_GetRelativeMouseState },
+	{ "SDL_GetRenderDrawBlendMode", (uintptr_t)&SDL_GetRenderDrawBlendMode },
+	{ "SDL_GetRenderDrawColor", (uintptr_t)&SDL_GetRenderDrawColor },
+	{ "SDL_GetRenderDriverInfo", (uintptr_t)&SDL_GetRenderDriverInfo },
+	{ "SDL_GetRenderTarget", (uintptr_t)&SDL_GetRenderTarget },
+	{ "SDL_GetRenderer", (uintptr_t)&SDL_GetRenderer },
+	{ "SDL_GetRendererInfo", (uintptr_t)&SDL_GetRendererInfo },
+	{ "SDL_GetRevision", (uintptr_t)&SDL_GetRevision },
+	{ "SDL_GetRevisionNumber", (uintptr_t)&SDL_GetRevisionNumber },
+	{ "SDL_GetScancodeFromKey", (uintptr_t)&SDL_GetScancodeFromKey },
+	{ "SDL_GetScancodeFromName", (uintptr_t)&SDL_GetScancodeFromName },
+	{ "SDL_GetScancodeName", (uintptr_t)&SDL_GetScancodeName },
+	{ "SDL_GetShapedWindowMode", (uintptr_t)&SDL_GetShapedWindowMode },
+	//{ "SDL_GetSpanEnclosingRect", (uintptr_t)&SDL_GetSpanEnclosingRect },
+	{ "SDL_GetSurfaceAlphaMod", (uintptr_t)&SDL_GetSurfaceAlphaMod },
+	{ "SDL_GetSurfaceBlendMode", (uintptr_t)&SDL_GetSurfaceBlendMode },
+	{ "SDL_GetSurfaceColorMod", (uintptr_t)&SDL_GetSurfaceColorMod },
+	{ "SDL_GetTextureAlphaMod", (uintptr_t)&SDL_GetTextureAlphaMod },
+	{ "SDL_GetTextureBlendMode", (uintptr_t)&SDL_GetTextureBlendMode },
+	{ "SDL_GetTextureColorMod", (uintptr_t)&SDL_GetTextureColorMod },
+	{ "SDL_GetThreadID", (uintptr_t)&SDL_GetThreadID },
+	{ "SDL_GetThreadName", (uintptr_t)&SDL_GetThreadName },
+	{ "SDL_GetTicks", (uintptr_t)&SDL_GetTicks },
+	//{ "SDL_GetTouch", (uintptr_t)&SDL_GetTouch },
+	{ "SDL_GetTouchDevice", (uintptr_t)&SDL_GetTouchDevice },
+	{ "SDL_GetTouchFinger", (uintptr_t)&SDL_GetTouchFinger },
+	{ "SDL_GetVersion", (uintptr_t)&SDL_GetVersion },
+	//{ "SDL_GetVideoDevice", (uintptr_t)&SDL_GetVideoDevice },
+	{ "SDL_GetVideoDriver", (uintptr_t)&SDL_GetVideoDriver },
+	{ "SDL_GetWindowBrightness", (uintptr_t)&SDL_GetWindowBrightness },
+	{ "SDL_GetWindowData", (uintptr_t)&SDL_GetWindowData },
+	{ "SDL_GetWindowDisplayIndex", (uintptr_t)&SDL_GetWindowDisplayIndex },
+	{ "SDL_GetWindowDisplayMode", (uintptr_t)&SDL_GetWindowDisplayMode },
+	{ "SDL_GetWindowFlags", (uintptr_t)&SDL_GetWindowFlags },
+	{ "SDL_GetWindowFromID", (uintptr_t)&SDL_GetWindowFromID },
+	{ "SDL_GetWindowGammaRamp", (uintptr_t)&SDL_GetWindowGammaRamp },
+	{ "SDL_GetWindowGrab", (uintptr_t)&SDL_GetWindowGrab },
+	{ "SDL_GetWindowID", (uintptr_t)&SDL_GetWindowID },
+	{ "SDL_GetWindowMaximumSize", (uintptr_t)&SDL_GetWindowMaximumSize },
+	{ "SDL_GetWindowMinimumSize", (uintptr_t)&SDL_GetWindowMinimumSize },
+	{ "SDL_GetWindowPixelFormat", (uintptr_t)&SDL_GetWindowPixelFormat },
+	{ "SDL_GetWindowPosition", (uintptr_t)&SDL_GetWindowPosition },
+	{ "SDL_GetWindowSize", (uintptr_t)&SDL_GetWindowSize },
+	{ "SDL_GetWindowSurface", (uintptr_t)&SDL_GetWindowSurface },
+	{ "SDL_GetWindowTitle", (uintptr_t)&SDL_GetWindowTitle },
+	//{ "SDL_GetWindowWMInfo", (uintptr_t)&SDL_GetWindowWMInfo },
+	{ "SDL_HapticClose", (uintptr_t)&SDL_HapticClose },
+	{ "SDL_HapticDestroyEffect", (uintptr_t)&SDL_HapticDestroyEffect },
+	{ "SDL_HapticEffectSupported", (uintptr_t)&SDL_HapticEffectSupported },
+	{ "SDL_HapticGetEffectStatus", (uintptr_t)&SDL_HapticGetEffectStatus },
+	{ "SDL_HapticIndex", (uintptr_t)&SDL_HapticIndex },
+	//{ "SDL_HapticInit", (uintptr_t)&SDL_HapticInit },
+	{ "SDL_HapticName", (uintptr_t)&SDL_HapticName },
+	{ "SDL_HapticNewEffect", (uintptr_t)&SDL_HapticNewEffect },
+	{ "SDL_HapticNumAxes", (uintptr_t)&SDL_HapticNumAxes },
+	{ "SDL_HapticNumEffects", (uintptr_t)&SDL_HapticNumEffects },
+	{ "SDL_HapticNumEffectsPlaying", (uintptr_t)&SDL_HapticNumEffectsPlaying },
+	{ "SDL_HapticOpen", (uintptr_t)&SDL_HapticOpen },
+	{ "SDL_HapticOpenFromJoystick", (uintptr_t)&SDL_HapticOpenFromJoystick },
+	{ "SDL_HapticOpenFromMouse", (uintptr_t)&SDL_HapticOpenFromMouse },
+	{ "SDL_HapticOpened", (uintptr_t)&SDL_HapticOpened },
+	{ "SDL_HapticPause", (uintptr_t)&SDL_HapticPause },
+	{ "SDL_HapticQuery", (uintptr_t)&SDL_HapticQuery },
+	//{ "SDL_HapticQuit", (uintptr_t)&SDL_HapticQuit },
+	{ "SDL_HapticRumbleInit", (uintptr_t)&SDL_HapticRumbleInit },
+	{ "SDL_HapticRumblePlay", (uintptr_t)&SDL_HapticRumblePlay },
+	{ "SDL_HapticRumbleStop", (uintptr_t)&SDL_HapticRumbleStop },
+	{ "SDL_HapticRumbleSupported", (uintptr_t)&SDL_HapticRumbleSupported },
+	{ "SDL_HapticRunEffect", (uintptr_t)&SDL_HapticRunEffect },
+	{ "SDL_HapticSetAutocenter", (uintptr_t)&SDL_HapticSetAutocenter },
+	{ "SDL_HapticSetGain", (uintptr_t)&SDL_HapticSetGain },
+	{ "SDL_HapticStopAll", (uintptr_t)&SDL_HapticStopAll },
+	{ "SDL_HapticStopEffect", (uintptr_t)&SDL_HapticStopEffect },
+	{ "SDL_HapticUnpause", (uintptr_t)&SDL_HapticUnpause },
+	{ "SDL_HapticUpdateEffect", (uintptr_t)&SDL_HapticUpdateEffect },
+	{ "SDL_Has3DNow", (uintptr_t)&SDL_Has3DNow },
+	{ "SDL_HasAltiVec", (uintptr_t)&SDL_HasAltiVec },
+	{ "SDL_HasClipboardText", (uintptr_t)&SDL_HasClipboardText },
+	{ "SDL_HasEvent", (uintptr_t)&SDL_HasEvent },
+	{ "SDL_HasEvents", (uintptr_t)&SDL_HasEvents },
+	{ "SDL_HasIntersection", (uintptr_t)&SDL_HasIntersection },
+	{ "SDL_HasMMX", (uintptr_t)&SDL_HasMMX },
+	{ "SDL_HasRDTSC", (uintptr_t)&SDL_HasRDTSC },
+	{ "SDL_HasSSE", (uintptr_t)&SDL_HasSSE },
+	{ "SDL_HasSSE2", (uintptr_t)&SDL_HasSSE2 },
+	{ "SDL_HasSSE3", (uintptr_t)&SDL_HasSSE3 },
+	{ "SDL_HasSSE41", (uintptr_t)&SDL_HasSSE41 },
+	{ "SDL_HasSSE42", (uintptr_t)&SDL_HasSSE42 },
+	{ "SDL_HasScreenKeyboardSupport", (uintptr_t)&SDL_HasScreenKeyboardSupport },
+	{ "SDL_HideWindow", (uintptr_t)&SDL_HideWindow },
+	{ "SDL_Init", (uintptr_t)&SDL_Init },
+	//{ "SDL_InitFormat", (uintptr_t)&SDL_InitFormat },
+	{ "SDL_InitSubSystem", (uintptr_t)&SDL_InitSubSystem },
+	//{ "SDL_InstallParachute", (uintptr_t)&SDL_InstallParachute },
+	{ "SDL_IntersectRect", (uintptr_t)&SDL_IntersectRect },
+	{ "SDL_IntersectRectAndLine", (uintptr_t)&SDL_IntersectRectAndLine },
+	//{ "SDL_InvalidateMap", (uintptr_t)&SDL_InvalidateMap },
+	{ "SDL_IsGameController", (uintptr_t)&SDL_IsGameController },
+	{ "SDL_IsScreenKeyboardShown", (uintptr_t)&SDL_IsScreenKeyboardShown },
+	{ "SDL_IsScreenSaverEnabled", (uintptr_t)&SDL_IsScreenSaverEnabled },
+	{ "SDL_IsShapedWindow", (uintptr_t)&SDL_IsShapedWindow },
+	{ "SDL_IsTextInputActive", (uintptr_t)&SDL_IsTextInputActive },
+	{ "SDL_JoystickClose", (uintptr_t)&SDL_JoystickClose },
+	{ "SDL_JoystickEventState", (uintptr_t)&SDL_JoystickEventState },
+	{ "SDL_JoystickGetAttached", (uintptr_t)&SDL_JoystickGetAttached },
+	{ "SDL_JoystickGetAxis", (uintptr_t)&SDL_JoystickGetAxis },
+	{ "SDL_JoystickGetBall", (uintptr_t)&SDL_JoystickGetBall },
+	{ "SDL_JoystickGetButton", (uintptr_t)&SDL_JoystickGetButton },
+	{ "SDL_JoystickGetDeviceGUID", (uintptr_t)&SDL_JoystickGetDeviceGUID },
+	{ "SDL_JoystickGetGUID", (uintptr_t)&SDL_JoystickGetGUID },
+	{ "SDL_JoystickGetGUIDFromString", (uintptr_t)&SDL_JoystickGetGUIDFromString },
+	{ "SDL_JoystickGetGUIDString", (uintptr_t)&SDL_JoystickGetGUIDString },
+	{ "SDL_JoystickGetHat", (uintptr_t)&SDL_JoystickGetHat },
+	//{ "SDL_JoystickInit", (uintptr_t)&SDL_JoystickInit },
+	{ "SDL_JoystickInstanceID", (uintptr_t)&SDL_JoystickInstanceID },
+	{ "SDL_JoystickIsHaptic", (uintptr_t)&SDL_JoystickIsHaptic },
+	{ "SDL_JoystickName", (uintptr_t)&SDL_JoystickName },
+	{ "SDL_JoystickNameForIndex", (uintptr_t)&SDL_JoystickNameForIndex },
+	{ "SDL_JoystickNumAxes", (uintptr_t)&SDL_JoystickNumAxes },
+	{ "SDL_JoystickNumBalls", (uintptr_t)&SDL_JoystickNumBalls },
+	{ "SDL_JoystickNumButtons", (uintptr_t)&SDL_JoystickNumButtons },
+	{ "SDL_JoystickNumHats", (uintptr_t)&SDL_JoystickNumHats },
+	{ "SDL_JoystickOpen", (uintptr_t)&SDL_JoystickOpen },
+	//{ "SDL_JoystickQuit", (uintptr_t)&SDL_JoystickQuit },
+	{ "SDL_JoystickUpdate", (uintptr_t)&SDL_JoystickUpdate },
+	//{ "SDL_KeyboardInit", (uintptr_t)&SDL_KeyboardInit },
+	//{ "SDL_KeyboardQuit", (uintptr_t)&SDL_KeyboardQuit },
+	{ "SDL_LoadBMP_RW", (uintptr_t)&SDL_LoadBMP_RW },
+	{ "SDL_LoadDollarTemplates", (uintptr_t)&SDL_LoadDollarTemplates },
+	{ "SDL_LoadFunction", (uintptr_t)&SDL_LoadFunction },
+	{ "SDL_LoadObject", (uintptr_t)&SDL_LoadObject },
+	{ "SDL_LoadWAV_RW", (uintptr_t)&SDL_LoadWAV_RW },
+	{ "SDL_LockAudio", (uintptr_t)&SDL_LockAudio },
+	{ "SDL_LockAudioDevice", (uintptr_t)&SDL_LockAudioDevice },
+	{ "SDL_LockMutex", (uintptr_t)&SDL_LockMutex },
+	{ "SDL_LockSurface", (uintptr_t)&SDL_LockSurface },
+	{ "SDL_LockTexture", (uintptr_t)&SDL_LockTexture },
+	{ "SDL_Log", (uintptr_t)&ret0 },
+	{ "SDL_LogCritical", (uintptr_t)&ret0 },
+	{ "SDL_LogDebug", (uintptr_t)&ret0 },
+	{ "SDL_LogError", (uintptr_t)&ret0 },
+	{ "SDL_LogGetOutputFunction", (uintptr_t)&ret0 },
+	{ "SDL_LogGetPriority", (uintptr_t)&ret0 },
+	{ "SDL_LogInfo", (uintptr_t)&ret0 },
+	{ "SDL_LogMessage", (uintptr_t)&ret0 },
+	{ "SDL_LogMessageV", (uintptr_t)&ret0 }, //MessageV);
+	{ "SDL_LogResetPriorities", (uintptr_t)&ret0 }, //ResetPriorities);
+	{ "SDL_LogSetAllPriority", (uintptr_t)&ret0 }, //SetAllPriority);
+	{ "SDL_LogSetOutputFunction", (uintptr_t)&ret0 }, //SetOutputFunction);
+	{ "SDL_LogSetPriority", (uintptr_t)&ret0 }, //SetPriority);
+	{ "SDL_LogVerbose", (uintptr_t)&ret0 }, //Verbose);
+	{ "SDL_LogWarn", (uintptr_t)&ret0 }, //Warn);
+	{ "SDL_LowerBlit", (uintptr_t)&SDL_LowerBlit },
+	{ "SDL_LowerBlitScaled", (uintptr_t)&SDL_LowerBlitScaled },
+	{ "SDL_MapRGB", (uintptr_t)&SDL_MapRGB },
+	{ "SDL_MapRGBA", (uintptr_t)&SDL_MapRGBA },
+	//{ "SDL_MapSurface", (uintptr_t)&SDL_MapSurface },
+	{ "SDL_MasksToPixelFormatEnum", (uintptr_t)&SDL_MasksToPixelFormatEnum },
+	{ "SDL_MaximizeWindow", (uintptr_t)&SDL_MaximizeWindow },
+	{ "SDL_MinimizeWindow", (uintptr_t)&SDL_MinimizeWindow },
+	{ "SDL_MixAudio", (uintptr_t)&SDL_MixAudio },
+	{ "SDL_MixAudioFormat", (uintptr_t)&SDL_MixAudioFormat },
+	//{ "SDL_MouseInit", (uintptr_t)&SDL_MouseInit },
+	{ "SDL_MouseIsHaptic", (uintptr_t)&SDL_MouseIsHaptic },
+	//{ "SDL_MouseQuit", (uintptr_t)&SDL_MouseQuit },
+	//{ "SDL_NextAudioFormat", (uintptr_t)&SDL_NextAudioFormat },
+	{ "SDL_NumHaptics", (uintptr_t)&SDL_NumHaptics },
+	{ "SDL_NumJoysticks", (uintptr_t)&SDL_NumJoysticks },
+	//{ "SDL_OnWindowFocusGained", (uintptr_t)&SDL_OnWindowFocusGained },
+	//{ "SDL_OnWindowFocusLost", (uintptr_t)&SDL_OnWindowFocusLost },
+	//{ "SDL_OnWindowHidden", (uintptr_t)&SDL_OnWindowHidden },
+	//{ "SDL_OnWindowMinimized", (uintptr_t)&SDL_OnWindowMinimized },
+	//{ "SDL_OnWindowResized", (uintptr_t)&SDL_OnWindowResized },
+	//{ "SDL_OnWindowRestored", (uintptr_t)&SDL_OnWindowRestored },
+	//{ "SDL_OnWindowShown", (uintptr_t)&SDL_OnWindowShown },
+	{ "SDL_OpenAudio", (uintptr_t)&SDL_OpenAudio_fake },
+	{ "SDL_OpenAudioDevice", (uintptr_t)&SDL_OpenAudioDevice },
+	{ "SDL_PauseAudio", (uintptr_t)&SDL_PauseAudio },
+	{ "SDL_PauseAudioDevice", (uintptr_t)&SDL_PauseAudioDevice },
+	{ "SDL_PeepEvents", (uintptr_t)&SDL_PeepEvents },
+	{ "SDL_PixelFormatEnumToMasks", (uintptr_t)&SDL_PixelFormatEnumToMasks },
+	{ "SDL_PollEvent", (uintptr_t)&SDL_PollEvent },
+	//{ "SDL_PrivateGameControllerAxis", (uintptr_t)&SDL_PrivateGameControllerAxis },
+	//{ "SDL_PrivateGameControllerButton", (uintptr_t)&SDL_PrivateGameControllerButton },
+	//{ "SDL_PrivateGameControllerParseButton", (uintptr_t)&SDL_PrivateGameControllerParseButton },
+	//{ "SDL_PrivateGameControllerRefreshMapping", (uintptr_t)&SDL_PrivateGameControllerRefreshMapping },
+	//{ "SDL_PrivateGetControllerGUIDFromMappingString", (uintptr_t)&SDL_PrivateGetControllerGUIDFromMappingString },
+	//{ "SDL_PrivateGetControllerMapping", (uintptr_t)&SDL_PrivateGetControllerMapping },
+	//{ "SDL_PrivateGetControllerMappingForGUID", (uintptr_t)&SDL_PrivateGetControllerMappingForGUID },
+	//{ "SDL_PrivateGetControllerMappingFromMappingString", (uintptr_t)&SDL_PrivateGetControllerMappingFromMappingString },
+	//{ "SDL_PrivateGetControllerNameFromMappingString", (uintptr_t)&SDL_PrivateGetControllerNameFromMappingString },
+	//{ "SDL_PrivateJoystickAxis", (uintptr_t)&SDL_PrivateJoystickAxis },
+	//{ "SDL_PrivateJoystickBall", (uintptr_t)&SDL_PrivateJoystickBall },
+	//{ "SDL_PrivateJoystickButton", (uintptr_t)&SDL_PrivateJoystickButton },
+	//{ "SDL_PrivateJoystickHat", (uintptr_t)&SDL_PrivateJoystickHat },
+	//{ "SDL_PrivateJoystickNeedsPolling", (uintptr_t)&SDL_PrivateJoystickNeedsPolling },
+	//{ "SDL_PrivateJoystickValid", (uintptr_t)&SDL_PrivateJoystickValid },
+	//{ "SDL_PrivateLoadButtonMapping", (uintptr_t)&SDL_PrivateLoadButtonMapping },
+	{ "SDL_PumpEvents", (uintptr_t)&SDL_PumpEvents },
+	{ "SDL_PushEvent", (uintptr_t)&SDL_PushEvent },
+	{ "SDL_QueryTexture", (uintptr_t)&SDL_QueryTexture },
+	{ "SDL_Quit", (uintptr_t)&SDL_Quit },
+	//{ "SDL_QuitInit", (uintptr_t)&SDL_QuitInit },
+	//{ "SDL_QuitQuit", (uintptr_t)&SDL_QuitQuit },
+	{ "SDL_QuitSubSystem", (uintptr_t)&SDL_QuitSubSystem },
+	//{ "SDL_RLEAlphaBlit", (uintptr_t)&SDL_RLEAlphaBlit },
+	//{ "SDL_RLEBlit", (uintptr_t)&SDL_RLEBlit },
+	//{ "SDL_RLESurface", (uintptr_t)&SDL_RLESurface },
+	{ "SDL_RWFromConstMem", (uintptr_t)&SDL_RWFromConstMem },
+	{ "SDL_RWFromFP", (uintptr_t)&SDL_RWFromFP },
+	{ "SDL_RWFromFile", (uintptr_t)&SDL_RWFromFile_hook },
+	{ "SDL_RWFromMem", (uintptr_t)&SDL_RWFromMem },
+	{ "SDL_RaiseWindow", (uintptr_t)&SDL_RaiseWindow },
+	{ "SDL_ReadBE16", (uintptr_t)&SDL_ReadBE16 },
+	{ "SDL_ReadBE32", (uintptr_t)&SDL_ReadBE32 },
+	{ "SDL_ReadBE64", (uintptr_t)&SDL_ReadBE64 },
+	{ "SDL_ReadLE16", (uintptr_t)&SDL_ReadLE16 },
+	{ "SDL_ReadLE32", (uintptr_t)&SDL_ReadLE32 },
+	{ "SDL_ReadLE64", (uintptr_t)&SDL_ReadLE64 },
+	{ "SDL_ReadU8", (uintptr_t)&SDL_ReadU8 },
+	{ "SDL_RecordGesture", (uintptr_t)&SDL_RecordGesture },
+	//{ "SDL_RecreateWindow", (uintptr_t)&SDL_RecreateWindow },
+	{ "SDL_RegisterEvents", (uintptr_t)&SDL_RegisterEvents },
+	//{ "SDL_RegisterHintChangedCb", (uintptr_t)&SDL_RegisterHintChangedCb },
+	{ "SDL_RemoveTimer", (uintptr_t)&SDL_RemoveTimer },
+	{ "SDL_RenderClear", (uintptr_t)&SDL_RenderClear },
+	{ "SDL_RenderCopy", (uintptr_t)&SDL_RenderCopy },
+	{ "SDL_RenderCopyEx", (uintptr_t)&SDL_RenderCopyEx },
+	{ "SDL_RenderDrawLine", (uintptr_t)&SDL_RenderDrawLine },
+	{ "SDL_RenderDrawLines", (uintptr_t)&SDL_RenderDrawLines },
+	{ "SDL_RenderDrawPoint", (uintptr_t)&SDL_RenderDrawPoint },
+	{ "SDL_RenderDrawPoints", (uintptr_t)&SDL_RenderDrawPoints },
+	{ "SDL_RenderDrawRect", (uintptr_t)&SDL_RenderDrawRect },
+	{ "SDL_RenderDrawRects", (uintptr_t)&SDL_RenderDrawRects },
+	{ "SDL_RenderFillRect", (uintptr_t)&SDL_RenderFillRect },
+	{ "SDL_RenderFillRects", (uintptr_t)&SDL_RenderFillRects },
+	{ "SDL_RenderGetLogicalSize", (uintptr_t)&SDL_RenderGetLogicalSize },
+	{ "SDL_RenderGetScale", (uintptr_t)&SDL_RenderGetScale },
+	{ "SDL_RenderGetViewport", (uintptr_t)&SDL_RenderGetViewport },
+	{ "SDL_RenderPresent", (uintptr_t)&SDL_RenderPresent },
+	{ "SDL_RenderReadPixels", (uintptr_t)&SDL_RenderReadPixels },
+	{ "SDL_RenderSetLogicalSize", (uintptr_t)&SDL_RenderSetLogicalSize },
+	{ "SDL_RenderSetScale", (uintptr_t)&SDL_RenderSetScale },
+	{ "SDL_RenderSetViewport", (uintptr_t)&SDL_RenderSetViewport },
+	{ "SDL_RenderTargetSupported", (uintptr_t)&SDL_RenderTargetSupported },
+	{ "SDL_ResetAssertionReport", (uintptr_t)&SDL_ResetAssertionReport },
+	//{ "SDL_ResetKeyboard", (uintptr_t)&SDL_ResetKeyboard },
+	//{ "SDL_ResetMouse", (uintptr_t)&SDL_ResetMouse },
+	{ "SDL_RestoreWindow", (uintptr_t)&SDL_RestoreWindow },
+	//{ "SDL_RunAudio", (uintptr_t)&SDL_RunAudio },
+	//{ "SDL_RunThread", (uintptr_t)&SDL_RunThread },
+	//{ "SDL_SW_CopyYUVToRGB", (uintptr_t)&SDL_SW_CopyYUVToRGB },
+	//{ "SDL_SW_CreateYUVTexture", (uintptr_t)&SDL_SW_CreateYUVTexture },
+	//{ "SDL_SW_DestroyYUVTexture", (uintptr_t)&SDL_SW_DestroyYUVTexture },
+	//{ "SDL_SW_LockYUVTexture", (uintptr_t)&SDL_SW_LockYUVTexture },
+	//{ "SDL_SW_QueryYUVTexturePixels", (uintptr_t)&SDL_SW_QueryYUVTexturePixels },
+	//{ "SDL_SW_UnlockYUVTexture", (uintptr_t)&SDL_SW_UnlockYUVTexture },
+	//{ "SDL_SW_UpdateYUVTexture", (uintptr_t)&SDL_SW_UpdateYUVTexture },
+	//{ "SDL_SYS_CreateThread", (uintptr_t)&SDL_SYS_CreateThread },
+	//{ "SDL_SYS_GetInstanceIdOfDeviceIndex", (uintptr_t)&SDL_SYS_GetInstanceIdOfDeviceIndex },
+	//{ "SDL_SYS_HapticClose", (uintptr_t)&SDL_SYS_HapticClose },
+	//{ "SDL_SYS_HapticDestroyEffect", (uintptr_t)&SDL_SYS_HapticDestroyEffect },
+	//{ "SDL_SYS_HapticGetEffectStatus", (uintptr_t)&SDL_SYS_HapticGetEffectStatus },
+	//{ "SDL_SYS_HapticInit", (uintptr_t)&SDL_SYS_HapticInit },
+	//{ "SDL_SYS_HapticMouse", (uintptr_t)&SDL_SYS_HapticMouse },
+	//{ "SDL_SYS_HapticName", (uintptr_t)&SDL_SYS_HapticName },
+	//{ "SDL_SYS_HapticNewEffect", (uintptr_t)&SDL_SYS_HapticNewEffect },
+	//{ "SDL_SYS_HapticOpen", (uintptr_t)&SDL_SYS_HapticOpen },
+	//{ "SDL_SYS_HapticOpenFromJoystick", (uintptr_t)&SDL_SYS_HapticOpenFromJoystick },
+	//{ "SDL_SYS_HapticPause", (uintptr_t)&SDL_SYS_HapticPause },
+	//{ "SDL_SYS_HapticQuit", (uintptr_t)&SDL_SYS_HapticQuit },
+	//{ "SDL_SYS_HapticRunEffect", (uintptr_t)&SDL_SYS_HapticRunEffect },
+	//{ "SDL_SYS_HapticSetAutocenter", (uintptr_t)&SDL_SYS_HapticSetAutocenter },
+	//{ "SDL_SYS_HapticSetGain", (uintptr_t)&SDL_SYS_HapticSetGain },
+	//{ "SDL_SYS_HapticStopAll", (uintptr_t)&SDL_SYS_HapticStopAll },
+	//{ "SDL_SYS_HapticStopEffect", (uintptr_t)&SDL_SYS_HapticStopEffect },
+	//{ "SDL_SYS_HapticUnpause", (uintptr_t)&SDL_SYS_HapticUnpause },
+	//{ "SDL_SYS_HapticUpdateEffect", (uintptr_t)&SDL_SYS_HapticUpdateEffect },
+	//{ "SDL_SYS_JoystickAttached", (uintptr_t)&SDL_SYS_JoystickAttached },
+	//{ "SDL_SYS_JoystickClose", (uintptr_t)&SDL_SYS_JoystickClose },
+	//{ "SDL_SYS_JoystickDetect", (uintptr_t)&SDL_SYS_JoystickDetect },
+	//{ "SDL_SYS_JoystickGetDeviceGUID", (uintptr_t)&SDL_SYS_JoystickGetDeviceGUID },
+	//{ "SDL_SYS_JoystickGetGUID", (uintptr_t)&SDL_SYS_JoystickGetGUID },
+	//{ "SDL_SYS_JoystickInit", (uintptr_t)&SDL_SYS_JoystickInit },
+	//{ "SDL_SYS_JoystickIsHaptic", (uintptr_t)&SDL_SYS_JoystickIsHaptic },
+	//{ "SDL_SYS_JoystickNameForDeviceIndex", (uintptr_t)&SDL_SYS_JoystickNameForDeviceIndex },
+	//{ "SDL_SYS_JoystickNeedsPolling", (uintptr_t)&SDL_SYS_JoystickNeedsPolling },
+	//{ "SDL_SYS_JoystickOpen", (uintptr_t)&SDL_SYS_JoystickOpen },
+	//{ "SDL_SYS_JoystickQuit", (uintptr_t)&SDL_SYS_JoystickQuit },
+	//{ "SDL_SYS_JoystickSameHaptic", (uintptr_t)&SDL_SYS_JoystickSameHaptic },
+	//{ "SDL_SYS_JoystickUpdate", (uintptr_t)&SDL_SYS_JoystickUpdate },
+	//{ "SDL_SYS_NumJoysticks", (uintptr_t)&SDL_SYS_NumJoysticks },
+	//{ "SDL_SYS_SetThreadPriority", (uintptr_t)&SDL_SYS_SetThreadPriority },
+	//{ "SDL_SYS_SetupThread", (uintptr_t)&SDL_SYS_SetupThread },
+	//{ "SDL_SYS_WaitThread", (uintptr_t)&SDL_SYS_WaitThread },
+	{ "SDL_SaveAllDollarTemplates", (uintptr_t)&SDL_SaveAllDollarTemplates },
+	{ "SDL_SaveBMP_RW", (uintptr_t)&SDL_SaveBMP_RW },
+	{ "SDL_SaveDollarTemplate", (uintptr_t)&SDL_SaveDollarTemplate },
+	{ "SDL_SemPost", (uintptr_t)&SDL_SemPost },
+	{ "SDL_SemTryWait", (uintptr_t)&SDL_SemTryWait },
+	{ "SDL_SemValue", (uintptr_t)&SDL_SemValue },
+	{ "SDL_SemWait", (uintptr_t)&SDL_SemWait },
+	{ "SDL_SemWaitTimeout", (uintptr_t)&SDL_SemWaitTimeout },
+	//{ "SDL_SendClipboardUpdate", (uintptr_t)&SDL_SendClipboardUpdate },
+	//{ "SDL_SendDropFile", (uintptr_t)&SDL_SendDropFile },
+	//{ "SDL_SendEditingText", (uintptr_t)&SDL_SendEditingText },
+	//{ "SDL_SendGestureMulti", (uintptr_t)&SDL_SendGestureMulti },
+	//{ "SDL_SendKeyboardKey", (uintptr_t)&SDL_SendKeyboardKey },
+	//{ "SDL_SendKeyboardText", (uintptr_t)&SDL_SendKeyboardText },
+	//{ "SDL_SendMouseButton", (uintptr_t)&SDL_SendMouseButton },
+	//{ "SDL_SendMouseMotion", (uintptr_t)&SDL_SendMouseMotion },
+	//{ "SDL_SendMouseWheel", (uintptr_t)&SDL_SendMouseWheel },
+	//{ "SDL_SendQuit", (uintptr_t)&SDL_SendQuit },
+	//{ "SDL_SendSysWMEvent", (uintptr_t)&SDL_SendSysWMEvent },
+	//{ "SDL_SendTouch", (uintptr_t)&SDL_SendTouch },
+	//{ "SDL_SendTouchMotion", (uintptr_t)&SDL_SendTouchMotion },
+	//{ "SDL_SendWindowEvent", (uintptr_t)&SDL_SendWindowEvent },
+	{ "SDL_SetAssertionHandler", (uintptr_t)&SDL_SetAssertionHandler },
+	{ "SDL_SetClipRect", (uintptr_t)&SDL_SetClipRect },
+	{ "SDL_SetClipboardText", (uintptr_t)&SDL_SetClipboardText },
+	{ "SDL_SetColorKey", (uintptr_t)&SDL_SetColorKey },
+	{ "SDL_SetCursor", (uintptr_t)&SDL_SetCursor },
+	//{ "SDL_SetDefaultCursor", (uintptr_t)&SDL_SetDefaultCursor },
+	{ "SDL_SetError", (uintptr_t)&SDL_SetError },
+	{ "SDL_SetEventFilter", (uintptr_t)&SDL_SetEventFilter },
+	{ "SDL_SetHint", (uintptr_t)&SDL_SetHint },
+	{ "SDL_SetHintWithPriority", (uintptr_t)&SDL_SetHintWithPriority },
+	//{ "SDL_SetKeyboardFocus", (uintptr_t)&SDL_SetKeyboardFocus },
+	//{ "SDL_SetKeymap", (uintptr_t)&SDL_SetKeymap },
+	{ "SDL_SetModState", (uintptr_t)&SDL_SetModState },
+	//{ "SDL_SetMouseFocus", (uintptr_t)&SDL_SetMouseFocus },
+	{ "SDL_SetPaletteColors", (uintptr_t)&SDL_SetPaletteColors },
+	{ "SDL_SetPixelFormatPalette", (uintptr_t)&SDL_SetPixelFormatPalette },
+	{ "SDL_SetRelativeMouseMode", (uintptr_t)&SDL_SetRelativeMouseMode },
+	{ "SDL_SetRenderDrawBlendMode", (uintptr_t)&SDL_SetRenderDrawBlendMode },
+	{ "SDL_SetRenderDrawColor", (uintptr_t)&SDL_SetRenderDrawColor },
+	{ "SDL_SetRenderTarget", (uintptr_t)&SDL_SetRenderTarget },
+	//{ "SDL_SetScancodeName", (uintptr_t)&SDL_SetScancodeName },
+	{ "SDL_SetSurfaceAlphaMod", (uintptr_t)&SDL_SetSurfaceAlphaMod },
+	{ "SDL_SetSurfaceBlendMode", (uintptr_t)&SDL_SetSurfaceBlendMode },
+	{ "SDL_SetSurfaceColorMod", (uintptr_t)&SDL_SetSurfaceColorMod },
+	{ "SDL_SetSurfacePalette", (uintptr_t)&SDL_SetSurfacePalette },
+	{ "SDL_SetSurfaceRLE", (uintptr_t)&SDL_SetSurfaceRLE },
+	{ "SDL_SetTextInputRect", (uintptr_t)&SDL_SetTextInputRect },
+	{ "SDL_SetTextureAlphaMod", (uintptr_t)&SDL_SetTextureAlphaMod },
+	{ "SDL_SetTextureBlendMode", (uintptr_t)&SDL_SetTextureBlendMode },
+	{ "SDL_SetTextureColorMod", (uintptr_t)&SDL_SetTextureColorMod },
+	{ "SDL_SetThreadPriority", (uintptr_t)&SDL_SetThreadPriority },
+	{ "SDL_SetWindowBordered", (uintptr_t)&SDL_SetWindowBordered },
+	{ "SDL_SetWindowBrightness", (uintptr_t)&SDL_SetWindowBrightness },
+	{ "SDL_SetWindowData", (uintptr_t)&SDL_SetWindowData },
+	{ "SDL_SetWindowDisplayMode", (uintptr_t)&SDL_SetWindowDisplayMode },
+	{ "SDL_SetWindowFullscreen", (uintptr_t)&SDL_SetWindowFullscreen },
+	{ "SDL_SetWindowGammaRamp", (uintptr_t)&SDL_SetWindowGammaRamp },
+	{ "SDL_SetWindowGrab", (uintptr_t)&SDL_SetWindowGrab },
+	{ "SDL_SetWindowIcon", (uintptr_t)&SDL_SetWindowIcon },
+	{ "SDL_SetWindowMaximumSize", (uintptr_t)&SDL_SetWindowMaximumSize },
+	{ "SDL_SetWindowMinimumSize", (uintptr_t)&SDL_SetWindowMinimumSize },
+	{ "SDL_SetWindowPosition", (uintptr_t)&SDL_SetWindowPosition },
+	{ "SDL_SetWindowShape", (uintptr_t)&SDL_SetWindowShape },
+	{ "SDL_SetWindowSize", (uintptr_t)&SDL_SetWindowSize },
+	{ "SDL_SetWindowTitle", (uintptr_t)&SDL_SetWindowTitle },
+	//{ "SDL_ShouldAllowTopmost", (uintptr_t)&SDL_ShouldAllowTopmost },
+	{ "SDL_ShowCursor", (uintptr_t)&SDL_ShowCursor },
+	{ "SDL_ShowMessageBox", (uintptr_t)&SDL_ShowMessageBox },
+	//{ "SDL_ShowProgressHUD", (uintptr_t)&SDL_ShowProgressHUD },
+	{ "SDL_ShowSimpleMessageBox", (uintptr_t)&SDL_ShowSimpleMessageBox },
+	{ "SDL_ShowWindow", (uintptr_t)&SDL_ShowWindow },
+	{ "SDL_SoftStretch", (uintptr_t)&SDL_SoftStretch },
+	//{ "SDL_StartEventLoop", (uintptr_t)&SDL_StartEventLoop },
+	{ "SDL_StartTextInput", (uintptr_t)&SDL_StartTextInput },
+	//{ "SDL_StartTicks", (uintptr_t)&SDL_StartTicks },
+	//{ "SDL_StopEventLoop", (uintptr_t)&SDL_StopEventLoop },
+	{ "SDL_StopTextInput", (uintptr_t)&SDL_StopTextInput },
+	{ "SDL_ThreadID", (uintptr_t)&SDL_ThreadID },
+	//{ "SDL_TimerInit", (uintptr_t)&SDL_TimerInit },
+	//{ "SDL_TimerQuit", (uintptr_t)&SDL_TimerQuit },
+	//{ "SDL_TouchInit", (uintptr_t)&SDL_TouchInit },
+	//{ "SDL_TouchQuit", (uintptr_t)&SDL_TouchQuit },
+	//{ "SDL_TraverseShapeTree", (uintptr_t)&SDL_TraverseShapeTree },
+	{ "SDL_TryLockMutex", (uintptr_t)&SDL_TryLockMutex },
+	//{ "SDL_UnRLESurface", (uintptr_t)&SDL_UnRLESurface },
+	//{ "SDL_UninstallParachute", (uintptr_t)&SDL_UninstallParachute },
+	{ "SDL_UnionRect", (uintptr_t)&SDL_UnionRect },
+	{ "SDL_UnloadObject", (uintptr_t)&SDL_UnloadObject },
+	{ "SDL_UnlockAudio", (uintptr_t)&SDL_UnlockAudio },
+	{ "SDL_UnlockAudioDevice", (uintptr_t)&SDL_UnlockAudioDevice },
+	{ "SDL_UnlockMutex", (uintptr_t)&SDL_UnlockMutex },
+	{ "SDL_UnlockSurface", (uintptr_t)&SDL_UnlockSurface },
+	{ "SDL_UnlockTexture", (uintptr_t)&SDL_UnlockTexture },
+	{ "SDL_UpdateTexture", (uintptr_t)&SDL_UpdateTexture },
+	//{ "SDL_UpdateWindowGrab", (uintptr_t)&SDL_UpdateWindowGrab },
+	{ "SDL_UpdateWindowSurface", (uintptr_t)&SDL_UpdateWindowSurface },
+	{ "SDL_UpdateWindowSurfaceRects", (uintptr_t)&SDL_UpdateWindowSurfaceRects },
+	{ "SDL_UpperBlit", (uintptr_t)&SDL_UpperBlit },
+	{ "SDL_UpperBlitScaled", (uintptr_t)&SDL_UpperBlitScaled },
+	//{ "SDL_Vibrate", (uintptr_t)&SDL_Vibrate },
+	{ "SDL_VideoInit", (uintptr_t)&SDL_VideoInit },
+	{ "SDL_VideoQuit", (uintptr_t)&SDL_VideoQuit },
+	{ "SDL_WaitEvent", (uintptr_t)&SDL_WaitEvent },
+	{ "SDL_WaitEventTimeout", (uintptr_t)&SDL_WaitEventTimeout },
+	{ "SDL_WaitThread", (uintptr_t)&SDL_WaitThread },
+	{ "SDL_WarpMouseInWindow", (uintptr_t)&SDL_WarpMouseInWindow },
+	{ "SDL_WasInit", (uintptr_t)&SDL_WasInit },
+	{ "SDL_WriteBE16", (uintptr_t)&SDL_WriteBE16 },
+	{ "SDL_WriteBE32", (uintptr_t)&SDL_WriteBE32 },
+	{ "SDL_WriteBE64", (uintptr_t)&SDL_WriteBE64 },
+	{ "SDL_WriteLE16", (uintptr_t)&SDL_WriteLE16 },
+	{ "SDL_WriteLE32", (uintptr_t)&SDL_WriteLE32 },
+	{ "SDL_WriteLE64", (uintptr_t)&SDL_WriteLE64 },
+	{ "SDL_WriteU8", (uintptr_t)&SDL_WriteU8 },
+	{ "SDL_abs", (uintptr_t)&SDL_abs },
+	{ "SDL_atof", (uintptr_t)&SDL_atof },
+	{ "SDL_atoi", (uintptr_t)&SDL_atoi },
+	{ "SDL_calloc", (uintptr_t)&SDL_calloc },
+	{ "SDL_ceil", (uintptr_t)&SDL_ceil },
+	{ "SDL_cosf", (uintptr_t)&SDL_cosf },
+	{ "SDL_free", (uintptr_t)&SDL_free },
+	{ "SDL_getenv", (uintptr_t)&SDL_getenv },
+	{ "SDL_iconv", (uintptr_t)&SDL_iconv },
+	{ "SDL_iconv_close", (uintptr_t)&SDL_iconv_close },
+	{ "SDL_iconv_open", (uintptr_t)&SDL_iconv_open },
+	{ "SDL_iconv_string", (uintptr_t)&SDL_iconv_string },
+	{ "SDL_isdigit", (uintptr_t)&SDL_isdigit },
+	{ "SDL_isspace", (uintptr_t)&SDL_isspace },
+	{ "SDL_itoa", (uintptr_t)&SDL_itoa },
+	{ "SDL_lltoa", (uintptr_t)&SDL_lltoa },
+	{ "SDL_ltoa", (uintptr_t)&SDL_ltoa },
+	{ "SDL_malloc", (uintptr_t)&SDL_malloc },
+	{ "SDL_memcmp", (uintptr_t)&SDL_memcmp },
+	{ "SDL_memcpy", (uintptr_t)&SDL_memcpy },
+	{ "SDL_memmove", (uintptr_t)&SDL_memmove },
+	{ "SDL_memset", (uintptr_t)&SDL_memset },
+	{ "SDL_qsort", (uintptr_t)&SDL_qsort },
+	{ "SDL_realloc", (uintptr_t)&SDL_realloc },
+	{ "SDL_setenv", (uintptr_t)&SDL_setenv },
+	{ "SDL_sinf", (uintptr_t)&SDL_sinf },
+	{ "SDL_snprintf", (uintptr_t)&SDL_snprintf },
+	{ "SDL_sscanf", (uintptr_t)&SDL_sscanf },
+	{ "SDL_strcasecmp", (uintptr_t)&SDL_strcasecmp },
+	{ "SDL_strchr", (uintptr_t)&SDL_strchr },
+	{ "SDL_strcmp", (uintptr_t)&SDL_strcmp },
+	{ "SDL_strdup", (uintptr_t)&SDL_strdup },
+	{ "SDL_strlcat", (uintptr_t)&SDL_strlcat },
+	{ "SDL_strlcpy", (uintptr_t)&SDL_strlcpy },
+	{ "SDL_strlen", (uintptr_t)&SDL_strlen },
+	{ "SDL_strlwr", (uintptr_t)&SDL_strlwr },
+	{ "SDL_strncasecmp", (uintptr_t)&SDL_strncasecmp },
+	{ "SDL_strncmp", (uintptr_t)&SDL_strncmp },
+	{ "SDL_strrchr", (uintptr_t)&SDL_strrchr },
+	{ "SDL_strrev", (uintptr_t)&SDL_strrev },
+	{ "SDL_strstr", (uintptr_t)&SDL_strstr },
+	{ "SDL_strtod", (uintptr_t)&SDL_strtod },
+	{ "SDL_strtol", (uintptr_t)&SDL_strtol },
+	{ "SDL_strtoll", (uintptr_t)&SDL_strtoll },
+	{ "SDL_strtoul", (uintptr_t)&SDL_strtoul },
+	{ "SDL_strtoull", (uintptr_t)&SDL_strtoull },
+	{ "SDL_strupr", (uintptr_t)&SDL_strupr },
+	{ "SDL_tolower", (uintptr_t)&SDL_tolower },
+	{ "SDL_toupper", (uintptr_t)&SDL_toupper },
+	{ "SDL_uitoa", (uintptr_t)&SDL_uitoa },
+	{ "SDL_ulltoa", (uintptr_t)&SDL_ulltoa },
+	{ "SDL_ultoa", (uintptr_t)&SDL_ultoa },
+	{ "SDL_utf8strlcpy", (uintptr_t)&SDL_utf8strlcpy },
+	{ "SDL_vsnprintf", (uintptr_t)&SDL_vsnprintf },
+	{ "SDL_wcslcat", (uintptr_t)&SDL_wcslcat },
+	{ "SDL_wcslcpy", (uintptr_t)&SDL_wcslcpy },
+	{ "SDL_wcslen", (uintptr_t)&SDL_wcslen },
+	//{ "SDL_AddBasicVideoDisplay_REAL", (uintptr_t)&SDL_AddBasicVideoDisplay },
+	//{ "SDL_AddDisplayMode_REAL", (uintptr_t)&SDL_AddDisplayMode },
+	{ "SDL_AddEventWatch_REAL", (uintptr_t)&SDL_AddEventWatch },
+	{ "SDL_AddTimer_REAL", (uintptr_t)&SDL_AddTimer },
+	//{ "SDL_AddTouch_REAL", (uintptr_t)&SDL_AddTouch },
+	//{ "SDL_AddVideoDisplay_REAL", (uintptr_t)&SDL_AddVideoDisplay },
+	//{ "SDL_AllocBlitMap_REAL", (uintptr_t)&SDL_AllocBlitMap },
+	{ "SDL_AllocFormat_REAL", (uintptr_t)&SDL_AllocFormat },
+	{ "SDL_AllocPalette_REAL", (uintptr_t)&SDL_AllocPalette },
+	{ "SDL_AllocRW_REAL", (uintptr_t)&SDL_AllocRW },
+	{ "SDL_AndroidGetActivity_REAL", (uintptr_t)&ret0 },
+	{ "SDL_AndroidGetExternalCachePath_REAL", (uintptr_t)&SDL_AndroidGetExternalStoragePath },
+	{ "SDL_AndroidGetExternalStoragePath_REAL", (uintptr_t)&SDL_AndroidGetExternalStoragePath },
+	{ "SDL_AndroidGetExternalStorageState_REAL", (uintptr_t)&ret0 },
+	{ "SDL_AndroidGetInternalStoragePath_REAL", (uintptr_t)&SDL_AndroidGetInternalStoragePath },
+	{ "SDL_AndroidGetJNIEnv_REAL", (uintptr_t)&Android_JNI_GetEnv },
+	{ "Android_JNI_GetEnv_REAL", (uintptr_t)&Android_JNI_GetEnv },
+	{ "SDL_Android_Init_REAL", (uintptr_t)&ret0 },
+	//{ "SDL_AssertionsInit_REAL", (uintptr_t)&SDL_AssertionsInit },
+	//{ "SDL_AssertionsQuit_REAL", (uintptr_t)&SDL_AssertionsQuit },
+	{ "SDL_AtomicCAS_REAL", (uintptr_t)&SDL_AtomicCAS },
+	{ "SDL_AtomicCASPtr_REAL", (uintptr_t)&SDL_AtomicCASPtr },
+	{ "SDL_AtomicLock_REAL", (uintptr_t)&SDL_AtomicLock },
+	{ "SDL_AtomicTryLock_REAL", (uintptr_t)&SDL_AtomicTryLock },
+	{ "SDL_AtomicUnlock_REAL", (uintptr_t)&SDL_AtomicUnlock },
+	{ "SDL_AudioInit_REAL", (uintptr_t)&SDL_AudioInit },
+	{ "SDL_AudioQuit_REAL", (uintptr_t)&SDL_AudioQuit },
+	//{ "SDL_BlendFillRect_REAL", (uintptr_t)&SDL_BlendFillRect },
+	//{ "SDL_BlendFillRects_REAL", (uintptr_t)&SDL_BlendFillRects },
+	//{ "SDL_BlendLine_REAL", (uintptr_t)&SDL_BlendLine },
+	//{ "SDL_BlendLines_REAL", (uintptr_t)&SDL_BlendLines },
+	//{ "SDL_BlendPoint_REAL", (uintptr_t)&SDL_BlendPoint },
+	//{ "SDL_BlendPoints_REAL", (uintptr_t)&SDL_BlendPoints },
+	//{ "SDL_BlitCopy_REAL", (uintptr_t)&SDL_BlitCopy },
+	//{ "SDL_Blit_Slow_REAL", (uintptr_t)&SDL_Blit_Slow },
+	{ "SDL_BuildAudioCVT_REAL", (uintptr_t)&SDL_BuildAudioCVT },
+	//{ "SDL_CalculateAudioSpec_REAL", (uintptr_t)&SDL_CalculateAudioSpec },
+	//{ "SDL_CalculateBlit_REAL", (uintptr_t)&SDL_CalculateBlit },
+	//{ "SDL_CalculateBlit0_REAL", (uintptr_t)&SDL_CalculateBlit0 },
+	//{ "SDL_CalculateBlit1_REAL", (uintptr_t)&SDL_CalculateBlit1 },
+	//{ "SDL_CalculateBlitA_REAL", (uintptr_t)&SDL_CalculateBlitA },
+	//{ "SDL_CalculateBlitN_REAL", (uintptr_t)&SDL_CalculateBlitN },
+	//{ "SDL_CalculateGammaRamp_REAL", (uintptr_t)&SDL_CalculateGammaRamp },
+	//{ "SDL_CalculatePitch_REAL", (uintptr_t)&SDL_CalculatePitch },
+	//{ "SDL_CalculateShapeBitmap_REAL", (uintptr_t)&SDL_CalculateShapeBitmap },
+	//{ "SDL_CalculateShapeTree_REAL", (uintptr_t)&SDL_CalculateShapeTree },
+	{ "SDL_ClearError_REAL", (uintptr_t)&SDL_ClearError },
+	{ "SDL_ClearHints_REAL", (uintptr_t)&SDL_ClearHints },
+	{ "SDL_CloseAudio_REAL", (uintptr_t)&SDL_CloseAudio },
+	{ "SDL_CloseAudioDevice_REAL", (uintptr_t)&SDL_CloseAudioDevice },
+	{ "SDL_CondBroadcast_REAL", (uintptr_t)&SDL_CondBroadcast },
+	{ "SDL_CondSignal_REAL", (uintptr_t)&SDL_CondSignal },
+	{ "SDL_CondWait_REAL", (uintptr_t)&SDL_CondWait },
+	{ "SDL_CondWaitTimeout_REAL", (uintptr_t)&SDL_CondWaitTimeout },
+	{ "SDL_ConvertAudio_REAL", (uintptr_t)&SDL_ConvertAudio },
+	{ "SDL_ConvertPixels_REAL", (uintptr_t)&SDL_ConvertPixels },
+	{ "SDL_ConvertSurface_REAL", (uintptr_t)&SDL_ConvertSurface },
+	{ "SDL_ConvertSurfaceFormat_REAL", (uintptr_t)&SDL_ConvertSurfaceFormat },
+	{ "SDL_CreateColorCursor_REAL", (uintptr_t)&SDL_CreateColorCursor },
+	{ "SDL_CreateCond_REAL", (uintptr_t)&SDL_CreateCond },
+	{ "SDL_CreateCursor_REAL", (uintptr_t)&SDL_CreateCursor },
+	{ "SDL_CreateMutex_REAL", (uintptr_t)&SDL_CreateMutex },
+	{ "SDL_CreateRGBSurface_REAL", (uintptr_t)&SDL_CreateRGBSurface },
+	{ "SDL_CreateRGBSurfaceFrom_REAL", (uintptr_t)&SDL_CreateRGBSurfaceFrom },
+	{ "SDL_CreateRenderer_REAL", (uintptr_t)&SDL_CreateRenderer },
+	{ "SDL_CreateSemaphore_REAL", (uintptr_t)&SDL_CreateSemaphore },
+	{ "SDL_CreateShapedWindow_REAL", (uintptr_t)&SDL_CreateShapedWindow },
+	{ "SDL_CreateSoftwareRenderer_REAL", (uintptr_t)&SDL_CreateSoftwareRenderer },
+	{ "SDL_CreateSystemCursor_REAL", (uintptr_t)&SDL_CreateSystemCursor },
+	{ "SDL_CreateTexture_REAL", (uintptr_t)&SDL_CreateTexture },
+	{ "SDL_CreateTextureFromSurface_REAL", (uintptr_t)&SDL_CreateTextureFromSurface },
+	{ "SDL_CreateThread_REAL", (uintptr_t)&SDL_CreateThread },
+	{ "SDL_CreateWindow_REAL", (uintptr_t)&SDL_CreateWindow },
+	{ "SDL_CreateWindowAndRenderer_REAL", (uintptr_t)&SDL_CreateWindowAndRenderer },
+	{ "SDL_CreateWindowFrom_REAL", (uintptr_t)&SDL_CreateWindowFrom },
+	{ "SDL_DelEventWatch_REAL", (uintptr_t)&SDL_DelEventWatch },
+	//{ "SDL_DelFinger_REAL", (uintptr_t)&SDL_DelFinger },
+	//{ "SDL_DelTouch_REAL", (uintptr_t)&SDL_DelTouch },
+	{ "SDL_Delay_REAL", (uintptr_t)&SDL_Delay },
+	{ "SDL_DestroyCond_REAL", (uintptr_t)&SDL_DestroyCond },
+	{ "SDL_DestroyMutex_REAL", (uintptr_t)&SDL_DestroyMutex },
+	{ "SDL_DestroyRenderer_REAL", (uintptr_t)&SDL_DestroyRenderer },
+	{ "SDL_DestroySemaphore_REAL", (uintptr_t)&SDL_DestroySemaphore },
+	{ "SDL_DestroyTexture_REAL", (uintptr_t)&SDL_DestroyTexture },
+	{ "SDL_DestroyWindow_REAL", (uintptr_t)&SDL_DestroyWindow },
+	{ "SDL_DisableScreenSaver_REAL", (uintptr_t)&SDL_DisableScreenSaver },
+	//{ "SDL_DitherColors_REAL", (uintptr_t)&SDL_DitherColors },
+	//{ "SDL_DrawLine_REAL", (uintptr_t)&SDL_DrawLine },
+	//{ "SDL_DrawLines_REAL", (uintptr_t)&SDL_DrawLines },
+	//{ "SDL_DrawPoint_REAL", (uintptr_t)&SDL_DrawPoint },
+	//{ "SDL_DrawPoints_REAL", (uintptr_t)&SDL_DrawPoints },
+	{ "SDL_EnableScreenSaver_REAL", (uintptr_t)&SDL_EnableScreenSaver },
+	{ "SDL_EnclosePoints_REAL", (uintptr_t)&SDL_EnclosePoints },
+	{ "SDL_Error_REAL", (uintptr_t)&SDL_Error },
+	{ "SDL_EventState_REAL", (uintptr_t)&SDL_EventState },
+	{ "SDL_FillRect_REAL", (uintptr_t)&SDL_FillRect },
+	{ "SDL_FillRects_REAL", (uintptr_t)&SDL_FillRects },
+	{ "SDL_FilterEvents_REAL", (uintptr_t)&SDL_FilterEvents },
+	//{ "SDL_FindColor_REAL", (uintptr_t)&SDL_FindColor },
+	//{ "SDL_FirstAudioFormat_REAL", (uintptr_t)&SDL_FirstAudioFormat },
+	{ "SDL_FlushEvent_REAL", (uintptr_t)&SDL_FlushEvent },
+	{ "SDL_FlushEvents_REAL", (uintptr_t)&SDL_FlushEvents },
+	//{ "SDL_FreeBlitMap_REAL", (uintptr_t)&SDL_FreeBlitMap },
+	{ "SDL_FreeCursor_REAL", (uintptr_t)&SDL_FreeCursor },
+	{ "SDL_FreeFormat_REAL", (uintptr_t)&SDL_FreeFormat },
+	{ "SDL_FreePalette_REAL", (uintptr_t)&SDL_FreePalette },
+	{ "SDL_FreeRW_REAL", (uintptr_t)&SDL_FreeRW },
+	//{ "SDL_FreeShapeTree_REAL", (uintptr_t)&SDL_FreeShapeTree },
+	{ "SDL_FreeSurface_REAL", (uintptr_t)&SDL_FreeSurface },
+	{ "SDL_FreeWAV_REAL", (uintptr_t)&SDL_FreeWAV },
+	{ "SDL_GL_BindTexture_REAL", (uintptr_t)&SDL_GL_BindTexture },
+	{ "SDL_GL_CreateContext_REAL", (uintptr_t)&SDL_GL_CreateContext },
+	{ "SDL_GL_DeleteContext_REAL", (uintptr_t)&SDL_GL_DeleteContext },
+	{ "SDL_GL_ExtensionSupported_REAL", (uintptr_t)&SDL_GL_ExtensionSupported },
+	{ "SDL_GL_GetAttribute_REAL", (uintptr_t)&SDL_GL_GetAttribute },
+	{ "SDL_GL_GetProcAddress_REAL", (uintptr_t)&SDL_GL_GetProcAddress },
+	{ "SDL_GL_GetSwapInterval_REAL", (uintptr_t)&SDL_GL_GetSwapInterval },
+	{ "SDL_GL_LoadLibrary_REAL", (uintptr_t)&SDL_GL_LoadLibrary },
+	{ "SDL_GL_MakeCurrent_REAL", (uintptr_t)&SDL_GL_MakeCurrent },
+	{ "SDL_GL_SetAttribute_REAL", (uintptr_t)&SDL_GL_SetAttribute },
+	{ "SDL_GL_SetSwapInterval_REAL", (uintptr_t)&SDL_GL_SetSwapInterval },
+	{ "SDL_GL_SwapWindow_REAL", (uintptr_t)&SDL_GL_SwapWindow },
+	{ "SDL_GL_UnbindTexture_REAL", (uintptr_t)&SDL_GL_UnbindTexture },
+	{ "SDL_GL_UnloadLibrary_REAL", (uintptr_t)&SDL_GL_UnloadLibrary },
+	{ "SDL_GameControllerAddMapping_REAL", (uintptr_t)&SDL_GameControllerAddMapping },
+	{ "SDL_GameControllerClose_REAL", (uintptr_t)&SDL_GameControllerClose },
+	{ "SDL_GameControllerEventState_REAL", (uintptr_t)&SDL_GameControllerEventState },
+	//{ "SDL_GameControllerEventWatcher_REAL", (uintptr_t)&SDL_GameControllerEventWatcher },
+	{ "SDL_GameControllerGetAttached_REAL", (uintptr_t)&SDL_GameControllerGetAttached },
+	{ "SDL_GameControllerGetAxis_REAL", (uintptr_t)&SDL_GameControllerGetAxis },
+	{ "SDL_GameControllerGetAxisFromString_REAL", (uintptr_t)&SDL_GameControllerGetAxisFromString },
+	{ "SDL_GameControllerGetBindForAxis_REAL", (uintptr_t)&SDL_GameControllerGetBindForAxis },
+	{ "SDL_GameControllerGetBindForButton_REAL", (uintptr_t)&SDL_GameControllerGetBindForButton },
+	{ "SDL_GameControllerGetButton_REAL", (uintptr_t)&SDL_GameControllerGetButton },
+	{ "SDL_GameControllerGetButtonFromString_REAL", (uintptr_t)&SDL_GameControllerGetButtonFromString },
+	{ "SDL_GameControllerGetJoystick_REAL", (uintptr_t)&SDL_GameControllerGetJoystick },
+	{ "SDL_GameControllerGetStringForAxis_REAL", (uintptr_t)&SDL_GameControllerGetStringForAxis },
+	{ "SDL_GameControllerGetStringForButton_REAL", (uintptr_t)&SDL_GameControllerGetStringForButton },
+	//{ "SDL_GameControllerInit_REAL", (uintptr_t)&SDL_GameControllerInit },
+	{ "SDL_GameControllerMapping_REAL", (uintptr_t)&SDL_GameControllerMapping },
+	{ "SDL_GameControllerMappingForGUID_REAL", (uintptr_t)&SDL_GameControllerMappingForGUID },
+	{ "SDL_GameControllerName_REAL", (uintptr_t)&SDL_GameControllerName },
+	{ "SDL_GameControllerNameForIndex_REAL", (uintptr_t)&SDL_GameControllerNameForIndex },
+	{ "SDL_GameControllerOpen_REAL", (uintptr_t)&SDL_GameControllerOpen },
+	//{ "SDL_GameControllerQuit_REAL", (uintptr_t)&SDL_GameControllerQuit },
+	{ "SDL_GameControllerUpdate_REAL", (uintptr_t)&SDL_GameControllerUpdate },
+	//{ "SDL_GestureAddTouch_REAL", (uintptr_t)&SDL_GestureAddTouch },
+	//{ "SDL_GestureProcessEvent_REAL", (uintptr_t)&SDL_GestureProcessEvent },
+	{ "SDL_GetAssertionReport_REAL", (uintptr_t)&SDL_GetAssertionReport },
+	{ "SDL_GetAudioDeviceName_REAL", (uintptr_t)&SDL_GetAudioDeviceName },
+	{ "SDL_GetAudioDeviceStatus_REAL", (uintptr_t)&SDL_GetAudioDeviceStatus },
+	{ "SDL_GetAudioDriver_REAL", (uintptr_t)&SDL_GetAudioDriver },
+	{ "SDL_GetAudioStatus_REAL", (uintptr_t)&SDL_GetAudioStatus },
+	{ "SDL_GetCPUCacheLineSize_REAL", (uintptr_t)&SDL_GetCPUCacheLineSize },
+	{ "SDL_GetCPUCount_REAL", (uintptr_t)&SDL_GetCPUCount },
+	{ "SDL_GetClipRect_REAL", (uintptr_t)&SDL_GetClipRect },
+	{ "SDL_GetClipboardText_REAL", (uintptr_t)&SDL_GetClipboardText },
+	{ "SDL_GetClosestDisplayMode_REAL", (uintptr_t)&SDL_GetClosestDisplayMode },
+	{ "SDL_GetColorKey_REAL", (uintptr_t)&SDL_GetColorKey },
+	{ "SDL_GetCurrentAudioDriver_REAL", (uintptr_t)&SDL_GetCurrentAudioDriver },
+	{ "SDL_GetCurrentDisplayMode_REAL", (uintptr_t)&SDL_GetCurrentDisplayMode },
+	{ "SDL_GetCurrentVideoDriver_REAL", (uintptr_t)&SDL_GetCurrentVideoDriver },
+	{ "SDL_GetCursor_REAL", (uintptr_t)&SDL_GetCursor },
+	//{ "SDL_GetDefaultKeymap_REAL", (uintptr_t)&SDL_GetDefaultKeymap },
+	{ "SDL_GetDesktopDisplayMode_REAL", (uintptr_t)&SDL_GetDesktopDisplayMode },
+	{ "SDL_GetDisplayBounds_REAL", (uintptr_t)&SDL_GetDisplayBounds },
+	//{ "SDL_GetDisplayForWindow_REAL", (uintptr_t)&SDL_GetDisplayForWindow },
+	{ "SDL_GetDisplayMode_REAL", (uintptr_t)&SDL_GetDisplayMode },
+	{ "SDL_GetDisplayName_REAL", (uintptr_t)&SDL_GetDisplayName },
+	//{ "SDL_GetErrBuf_REAL", (uintptr_t)&SDL_GetErrBuf },
+	{ "SDL_GetError_REAL", (uintptr_t)&SDL_GetError },
+	{ "SDL_GetEventFilter_REAL", (uintptr_t)&SDL_GetEventFilter },
+	//{ "SDL_GetFinger_REAL", (uintptr_t)&SDL_GetFinger },
+	//{ "SDL_GetFocusWindow_REAL", (uintptr_t)&SDL_GetFocusWindow },
+	{ "SDL_GetHint_REAL", (uintptr_t)&SDL_GetHint },
+	{ "SDL_GetKeyFromName_REAL", (uintptr_t)&SDL_GetKeyFromName },
+	{ "SDL_GetKeyFromScancode_REAL", (uintptr_t)&SDL_GetKeyFromScancode },
+	{ "SDL_GetKeyName_REAL", (uintptr_t)&SDL_GetKeyName },
+	{ "SDL_GetKeyboardFocus_REAL", (uintptr_t)&SDL_GetKeyboardFocus },
+	{ "SDL_GetKeyboardState_REAL", (uintptr_t)&SDL_GetKeyboardState },
+	{ "SDL_GetModState_REAL", (uintptr_t)&SDL_GetModState },
+	//{ "SDL_GetMouse_REAL", (uintptr_t)&SDL_GetMouse },
+	{ "SDL_GetMouseFocus_REAL", (uintptr_t)&SDL_GetMouseFocus },
+	{ "SDL_GetMouseState_REAL", (uintptr_t)&SDL_GetMouseState },
+	{ "SDL_GetNumAudioDevices_REAL", (uintptr_t)&SDL_GetNumAudioDevices },
+	{ "SDL_GetNumAudioDrivers_REAL", (uintptr_t)&SDL_GetNumAudioDrivers },
+	{ "SDL_GetNumDisplayModes_REAL", (uintptr_t)&SDL_GetNumDisplayModes },
+	{ "SDL_GetNumRenderDrivers_REAL", (uintptr_t)&SDL_GetNumRenderDrivers },
+	{ "SDL_GetNumTouchDevices_REAL", (uintptr_t)&SDL_GetNumTouchDevices },
+	{ "SDL_GetNumTouchFingers_REAL", (uintptr_t)&SDL_GetNumTouchFingers },
+	{ "SDL_GetNumVideoDisplays_REAL", (uintptr_t)&SDL_GetNumVideoDisplays },
+	{ "SDL_GetNumVideoDrivers_REAL", (uintptr_t)&SDL_GetNumVideoDrivers },
+	{ "SDL_GetPerformanceCounter_REAL", (uintptr_t)&SDL_GetPerformanceCounter },
+	{ "SDL_GetPerformanceFrequency_REAL", (uintptr_t)&SDL_GetPerformanceFrequency },
+	{ "SDL_GetPixelFormatName_REAL", (uintptr_t)&SDL_GetPixelFormatName },
+	{ "SDL_GetPlatform_REAL", (uintptr_t)&SDL_GetPlatform },
+	{ "SDL_GetPowerInfo_REAL", (uintptr_t)&SDL_GetPowerInfo },
+	//{ "SDL_GetPowerInfo_Android_REAL", (uintptr_t)&SDL_GetPowerInfo_Android },
+	{ "SDL_GetRGB_REAL", (uintptr_t)&SDL_GetRGB },
+	{ "SDL_GetRGBA_REAL", (uintptr_t)&SDL_GetRGBA },
+	{ "SDL_GetRelativeMouseMode_REAL", (uintptr_t)&SDL_GetRelativeMouseMode },
+	{ "SDL_GetRelativeMouseState_REAL", (uintptr_t)&SDL_GetRelativeMouseState },
+	{ "SDL_GetRenderDrawBlendMode_REAL", (uintptr_t)&SDL_GetRenderDrawBlendMode },
+	{ "SDL_GetRenderDrawColor_REAL", (uintptr_t)&SDL_GetRenderDrawColor },
+	{ "SDL_GetRenderDriverInfo_REAL", (uintptr_t)&SDL_GetRenderDriverInfo },
+	{ "SDL_GetRenderTarget_REAL", (uintptr_t)&SDL_GetRenderTarget },
+	{ "SDL_GetRenderer_REAL", (uintptr_t)&SDL_GetRenderer },
+	{ "SDL_GetRendererInfo_REAL", (uintptr_t)&SDL_GetRendererInfo },
+	{ "SDL_GetRevision_REAL", (uintptr_t)&SDL_GetRevision },
+	{ "SDL_GetRevisionNumber_REAL", (uintptr_t)&SDL_GetRevisionNumber },
+	{ "SDL_GetScancodeFromKey_REAL", (uintptr_t)&SDL_GetScancodeFromKey },
+	{ "SDL_GetScancodeFromName_REAL", (uintptr_t)&SDL_GetScancodeFromName },
+	{ "SDL_GetScancodeName_REAL", (uintptr_t)&SDL_GetScancodeName },
+	{ "SDL_GetShapedWindowMode_REAL", (uintptr_t)&SDL_GetShapedWindowMode },
+	//{ "SDL_GetSpanEnclosingRect_REAL", (uintptr_t)&SDL_GetSpanEnclosingRect },
+	{ "SDL_GetSurfaceAlphaMod_REAL", (uintptr_t)&SDL_GetSurfaceAlphaMod },
+	{ "SDL_GetSurfaceBlendMode_REAL", (uintptr_t)&SDL_GetSurfaceBlendMode },
+	{ "SDL_GetSurfaceColorMod_REAL", (uintptr_t)&SDL_GetSurfaceColorMod },
+	{ "SDL_GetTextureAlphaMod_REAL", (uintptr_t)&SDL_GetTextureAlphaMod },
+	{ "SDL_GetTextureBlendMode_REAL", (uintptr_t)&SDL_GetTextureBlendMode },
+	{ "SDL_GetTextureColorMod_REAL", (uintptr_t)&SDL_GetTextureColorMod },
+	{ "SDL_GetThreadID_REAL", (uintptr_t)&SDL_GetThreadID },
+	{ "SDL_GetThreadName_REAL", (uintptr_t)&SDL_GetThreadName },
+	{ "SDL_GetTicks_REAL", (uintptr_t)&SDL_GetTicks },
+	//{ "SDL_GetTouch_REAL", (uintptr_t)&SDL_GetTouch },
+	{ "SDL_GetTouchDevice_REAL", (uintptr_t)&SDL_GetTouchDevice },
+	{ "SDL_GetTouchFinger_REAL", (uintptr_t)&SDL_GetTouchFinger },
+	{ "SDL_GetVersion_REAL", (uintptr_t)&SDL_GetVersion },
+	//{ "SDL_GetVideoDevice_REAL", (uintptr_t)&SDL_GetVideoDevice },
+	{ "SDL_GetVideoDriver_REAL", (uintptr_t)&SDL_GetVideoDriver },
+	{ "SDL_GetWindowBrightness_REAL", (uintptr_t)&SDL_GetWindowBrightness },
+	{ "SDL_GetWindowData_REAL", (uintptr_t)&SDL_GetWindowData },
+	{ "SDL_GetWindowDisplayIndex_REAL", (uintptr_t)&SDL_GetWindowDisplayIndex },
+	{ "SDL_GetWindowDisplayMode_REAL", (uintptr_t)&SDL_GetWindowDisplayMode },
+	{ "SDL_GetWindowFlags_REAL", (uintptr_t)&SDL_GetWindowFlags },
+	{ "SDL_GetWindowFromID_REAL", (uintptr_t)&SDL_GetWindowFromID },
+	{ "SDL_GetWindowGammaRamp_REAL", (uintptr_t)&SDL_GetWindowGammaRamp },
+	{ "SDL_GetWindowGrab_REAL", (uintptr_t)&SDL_GetWindowGrab },
+	{ "SDL_GetWindowID_REAL", (uintptr_t)&SDL_GetWindowID },
+	{ "SDL_GetWindowMaximumSize_REAL", (uintptr_t)&SDL_GetWindowMaximumSize },
+	{ "SDL_GetWindowMinimumSize_REAL", (uintptr_t)&SDL_GetWindowMinimumSize },
+	{ "SDL_GetWindowPixelFormat_REAL", (uintptr_t)&SDL_GetWindowPixelFormat },
+	{ "SDL_GetWindowPosition_REAL", (uintptr_t)&SDL_GetWindowPosition },
+	{ "SDL_GetWindowSize_REAL", (uintptr_t)&SDL_GetWindowSize },
+	{ "SDL_GetWindowSurface_REAL", (uintptr_t)&SDL_GetWindowSurface },
+	{ "SDL_GetWindowTitle_REAL", (uintptr_t)&SDL_GetWindowTitle },
+	//{ "SDL_GetWindowWMInfo_REAL", (uintptr_t)&SDL_GetWindowWMInfo },
+	{ "SDL_HapticClose_REAL", (uintptr_t)&SDL_HapticClose },
+	{ "SDL_HapticDestroyEffect_REAL", (uintptr_t)&SDL_HapticDestroyEffect },
+	{ "SDL_HapticEffectSupported_REAL", (uintptr_t)&SDL_HapticEffectSupported },
+	{ "SDL_HapticGetEffectStatus_REAL", (uintptr_t)&SDL_HapticGetEffectStatus },
+	{ "SDL_HapticIndex_REAL", (uintptr_t)&SDL_HapticIndex },
+	//{ "SDL_HapticInit_REAL", (uintptr_t)&SDL_HapticInit },
+	{ "SDL_HapticName_REAL", (uintptr_t)&SDL_HapticName },
+	{ "SDL_HapticNewEffect_REAL", (uintptr_t)&SDL_HapticNewEffect },
+	{ "SDL_HapticNumAxes_REAL", (uintptr_t)&SDL_HapticNumAxes },
+	{ "SDL_HapticNumEffects_REAL", (uintptr_t)&SDL_HapticNumEffects },
+	{ "SDL_HapticNumEffectsPlaying_REAL", (uintptr_t)&SDL_HapticNumEffectsPlaying },
+	{ "SDL_HapticOpen_REAL", (uintptr_t)&SDL_HapticOpen },
+	{ "SDL_HapticOpenFromJoystick_REAL", (uintptr_t)&SDL_HapticOpenFromJoystick },
+	{ "SDL_HapticOpenFromMouse_REAL", (uintptr_t)&SDL_HapticOpenFromMouse },
+	{ "SDL_HapticOpened_REAL", (uintptr_t)&SDL_HapticOpened },
+	{ "SDL_HapticPause_REAL", (uintptr_t)&SDL_HapticPause },
+	{ "SDL_HapticQuery_REAL", (uintptr_t)&SDL_HapticQuery },
+	//{ "SDL_HapticQuit_REAL", (uintptr_t)&SDL_HapticQuit },
+	{ "SDL_HapticRumbleInit_REAL", (uintptr_t)&SDL_HapticRumbleInit },
+	{ "SDL_HapticRumblePlay_REAL", (uintptr_t)&SDL_HapticRumblePlay },
+	{ "SDL_HapticRumbleStop_REAL", (uintptr_t)&SDL_HapticRumbleStop },
+	{ "SDL_HapticRumbleSupported_REAL", (uintptr_t)&SDL_HapticRumbleSupported },
+	{ "SDL_HapticRunEffect_REAL", (uintptr_t)&SDL_HapticRunEffect },
+	{ "SDL_HapticSetAutocenter_REAL", (uintptr_t)&SDL_HapticSetAutocenter },
+	{ "SDL_HapticSetGain_REAL", (uintptr_t)&SDL_HapticSetGain },
+	{ "SDL_HapticStopAll_REAL", (uintptr_t)&SDL_HapticStopAll },
+	{ "SDL_HapticStopEffect_REAL", (uintptr_t)&SDL_HapticStopEffect },
+	{ "SDL_HapticUnpause_REAL", (uintptr_t)&SDL_HapticUnpause },
+	{ "SDL_HapticUpdateEffect_REAL", (uintptr_t)&SDL_HapticUpdateEffect },
+	{ "SDL_Has3DNow_REAL", (uintptr_t)&SDL_Has3DNow },
+	{ "SDL_HasAltiVec_REAL", (uintptr_t)&SDL_HasAltiVec },
+	{ "SDL_HasClipboardText_REAL", (uintptr_t)&SDL_HasClipboardText },
+	{ "SDL_HasEvent_REAL", (uintptr_t)&SDL_HasEvent },
+	{ "SDL_HasEvents_REAL", (uintptr_t)&SDL_HasEvents },
+	{ "SDL_HasIntersection_REAL", (uintptr_t)&SDL_HasIntersection },
+	{ "SDL_HasMMX_REAL", (uintptr_t)&SDL_HasMMX },
+	{ "SDL_HasRDTSC_REAL", (uintptr_t)&SDL_HasRDTSC },
+	{ "SDL_HasSSE_REAL", (uintptr_t)&SDL_HasSSE },
+	{ "SDL_HasSSE2_REAL", (uintptr_t)&SDL_HasSSE2 },
+	{ "SDL_HasSSE3_REAL", (uintptr_t)&SDL_HasSSE3 },
+	{ "SDL_HasSSE41_REAL", (uintptr_t)&SDL_HasSSE41 },
+	{ "SDL_HasSSE42_REAL", (uintptr_t)&SDL_HasSSE42 },
+	{ "SDL_HasScreenKeyboardSupport_REAL", (uintptr_t)&SDL_HasScreenKeyboardSupport },
+	{ "SDL_HideWindow_REAL", (uintptr_t)&SDL_HideWindow },
+	{ "SDL_Init_REAL", (uintptr_t)&SDL_Init },
+	//{ "SDL_InitFormat_REAL", (uintptr_t)&SDL_InitFormat },
+	{ "SDL_InitSubSystem_REAL", (uintptr_t)&SDL_InitSubSystem },
+	//{ "SDL_InstallParachute_REAL", (uintptr_t)&SDL_InstallParachute },
+	{ "SDL_IntersectRect_REAL", (uintptr_t)&SDL_IntersectRect },
+	{ "SDL_IntersectRectAndLine_REAL", (uintptr_t)&SDL_IntersectRectAndLine },
+	//{ "SDL_InvalidateMap_REAL", (uintptr_t)&SDL_InvalidateMap },
+	{ "SDL_IsGameController_REAL", (uintptr_t)&SDL_IsGameController },
+	{ "SDL_IsScreenKeyboardShown_REAL", (uintptr_t)&SDL_IsScreenKeyboardShown },
+	{ "SDL_IsScreenSaverEnabled_REAL", (uintptr_t)&SDL_IsScreenSaverEnabled },
+	{ "SDL_IsShapedWindow_REAL", (uintptr_t)&SDL_IsShapedWindow },
+	{ "SDL_IsTextInputActive_REAL", (uintptr_t)&SDL_IsTextInputActive },
+	{ "SDL_JoystickClose_REAL", (uintptr_t)&SDL_JoystickClose },
+	{ "SDL_JoystickEventState_REAL", (uintptr_t)&SDL_JoystickEventState },
+	{ "SDL_JoystickGetAttached_REAL", (uintptr_t)&SDL_JoystickGetAttached },
+	{ "SDL_JoystickGetAxis_REAL", (uintptr_t)&SDL_JoystickGetAxis },
+	{ "SDL_JoystickGetBall_REAL", (uintptr_t)&SDL_JoystickGetBall },
+	{ "SDL_JoystickGetButton_REAL", (uintptr_t)&SDL_JoystickGetButton },
+	{ "SDL_JoystickGetDeviceGUID_REAL", (uintptr_t)&SDL_JoystickGetDeviceGUID },
+	{ "SDL_JoystickGetGUID_REAL", (uintptr_t)&SDL_JoystickGetGUID },
+	{ "SDL_JoystickGetGUIDFromString_REAL", (uintptr_t)&SDL_JoystickGetGUIDFromString },
+	{ "SDL_JoystickGetGUIDString_REAL", (uintptr_t)&SDL_JoystickGetGUIDString },
+	{ "SDL_JoystickGetHat_REAL", (uintptr_t)&SDL_JoystickGetHat },
+	//{ "SDL_JoystickInit_REAL", (uintptr_t)&SDL_JoystickInit },
+	{ "SDL_JoystickInstanceID_REAL", (uintptr_t)&SDL_JoystickInstanceID },
+	{ "SDL_JoystickIsHaptic_REAL", (uintptr_t)&SDL_JoystickIsHaptic },
+	{ "SDL_JoystickName_REAL", (uintptr_t)&SDL_JoystickName },
+	{ "SDL_JoystickNameForIndex_REAL", (uintptr_t)&SDL_JoystickNameForIndex },
+	{ "SDL_JoystickNumAxes_REAL", (uintptr_t)&SDL_JoystickNumAxes },
+	{ "SDL_JoystickNumBalls_REAL", (uintptr_t)&SDL_JoystickNumBalls },
+	{ "SDL_JoystickNumButtons_REAL", (uintptr_t)&SDL_JoystickNumButtons },
+	{ "SDL_JoystickNumHats_REAL", (uintptr_t)&SDL_JoystickNumHats },
+	{ "SDL_JoystickOpen_REAL", (uintptr_t)&SDL_JoystickOpen },
+	//{ "SDL_JoystickQuit_REAL", (uintptr_t)&SDL_JoystickQuit },
+	{ "SDL_JoystickUpdate_REAL", (uintptr_t)&SDL_JoystickUpdate },
+	//{ "SDL_KeyboardInit_REAL", (uintptr_t)&SDL_KeyboardInit },
+	//{ "SDL_KeyboardQuit_REAL", (uintptr_t)&SDL_KeyboardQuit },
+	{ "SDL_LoadBMP_RW_REAL", (uintptr_t)&SDL_LoadBMP_RW },
+	{ "SDL_LoadDollarTemplates_REAL", (uintptr_t)&SDL_LoadDollarTemplates },
+	{ "SDL_LoadFunction_REAL", (uintptr_t)&SDL_LoadFunction },
+	{ "SDL_LoadObject_REAL", (uintptr_t)&SDL_LoadObject },
+	{ "SDL_LoadWAV_RW_REAL", (uintptr_t)&SDL_LoadWAV_RW },
+	{ "SDL_LockAudio_REAL", (uintptr_t)&SDL_LockAudio },
+	{ "SDL_LockAudioDevice_REAL", (uintptr_t)&SDL_LockAudioDevice },
+	{ "SDL_LockMutex_REAL", (uintptr_t)&SDL_LockMutex },
+	{ "SDL_LockSurface_REAL", (uintptr_t)&SDL_LockSurface },
+	{ "SDL_LockTexture_REAL", (uintptr_t)&SDL_LockTexture },
+	{ "SDL_Log_REAL", (uintptr_t)&ret0 }, //);
+	{ "SDL_LogCritical_REAL", (uintptr_t)&ret0 }, //Critical);
+	{ "SDL_LogDebug_REAL", (uintptr_t)&ret0 }, //Debug);
+	{ "SDL_LogError_REAL", (uintptr_t)&ret0 }, //Error);
+	{ "SDL_LogGetOutputFunction_REAL", (uintptr_t)&ret0 }, //GetOutputFunction);
+	{ "SDL_LogGetPriority_REAL", (uintptr_t)&ret0 }, //GetPriority);
+	{ "SDL_LogInfo_REAL", (uintptr_t)&ret0 }, //Info);
+	{ "SDL_LogMessage_REAL", (uintptr_t)&ret0 }, //Message);
+	{ "SDL_LogMessageV_REAL", (uintptr_t)&ret0 }, //MessageV);
+	{ "SDL_LogResetPriorities_REAL", (uintptr_t)&ret0 }, //ResetPriorities);
+	{ "SDL_LogSetAllPriority_REAL", (uintptr_t)&ret0 }, //SetAllPriority);
+	{ "SDL_LogSetOutputFunction_REAL", (uintptr_t)&ret0 }, //SetOutputFunction);
+	{ "SDL_LogSetPriority_REAL", (uintptr_t)&ret0 }, //SetPriority);
+	{ "SDL_LogVerbose_REAL", (uintptr_t)&ret0 }, //Verbose);
+	{ "SDL_LogWarn_REAL", (uintptr_t)&ret0 }, //Warn);
+	{ "SDL_LowerBlit_REAL", (uintptr_t)&SDL_LowerBlit },
+	{ "SDL_LowerBlitScaled_REAL", (uintptr_t)&SDL_LowerBlitScaled },
+	{ "SDL_MapRGB_REAL", (uintptr_t)&SDL_MapRGB },
+	{ "SDL_MapRGBA_REAL", (uintptr_t)&SDL_MapRGBA },
+	//{ "SDL_MapSurface_REAL", (uintptr_t)&SDL_MapSurface },
+	{ "SDL_MasksToPixelFormatEnum_REAL", (uintptr_t)&SDL_MasksToPixelFormatEnum },
+	{ "SDL_MaximizeWindow_REAL", (uintptr_t)&SDL_MaximizeWindow },
+	{ "SDL_MinimizeWindow_REAL", (uintptr_t)&SDL_MinimizeWindow },
+	{ "SDL_MixAudio_REAL", (uintptr_t)&SDL_MixAudio },
+	{ "SDL_MixAudioFormat_REAL", (uintptr_t)&SDL_MixAudioFormat },
+	//{ "SDL_MouseInit_REAL", (uintptr_t)&SDL_MouseInit },
+	{ "SDL_MouseIsHaptic_REAL", (uintptr_t)&SDL_MouseIsHaptic },
+	//{ "SDL_MouseQuit_REAL", (uintptr_t)&SDL_MouseQuit },
+	//{ "SDL_NextAudioFormat_REAL", (uintptr_t)&SDL_NextAudioFormat },
+	{ "SDL_NumHaptics_REAL", (uintptr_t)&SDL_NumHaptics },
+	{ "SDL_NumJoysticks_REAL", (uintptr_t)&SDL_NumJoysticks },
+	//{ "SDL_OnWindowFocusGained_REAL", (uintptr_t)&SDL_OnWindowFocusGained },
+	//{ "SDL_OnWindowFocusLost_REAL", (uintptr_t)&SDL_OnWindowFocusLost },
+	//{ "SDL_OnWindowHidden_REAL", (uintptr_t)&SDL_OnWindowHidden },
+	//{ "SDL_OnWindowMinimized_REAL", (uintptr_t)&SDL_OnWindowMinimized },
+	//{ "SDL_OnWindowResized_REAL", (uintptr_t)&SDL_OnWindowResized },
+	//{ "SDL_OnWindowRestored_REAL", (uintptr_t)&SDL_OnWindowRestored },
+	//{ "SDL_OnWindowShown_REAL", (uintptr_t)&SDL_OnWindowShown },
+	{ "SDL_OpenAudio_REAL", (uintptr_t)&SDL_OpenAudio },
+	{ "SDL_OpenAudioDevice_REAL", (uintptr_t)&SDL_OpenAudioDevice },
+	{ "SDL_PauseAudio_REAL", (uintptr_t)&SDL_PauseAudio },
+	{ "SDL_PauseAudioDevice_REAL", (uintptr_t)&SDL_PauseAudioDevice },
+	{ "SDL_PeepEvents_REAL", (uintptr_t)&SDL_PeepEvents },
+	{ "SDL_PixelFormatEnumToMasks_REAL", (uintptr_t)&SDL_PixelFormatEnumToMasks },
+	{ "SDL_PollEvent_REAL", (uintptr_t)&SDL_PollEvent },
+	//{ "SDL_PrivateGameControllerAxis_REAL", (uintptr_t)&SDL_PrivateGameControllerAxis },
+	//{ "SDL_PrivateGameControllerButton_REAL", (uintptr_t)&SDL_PrivateGameControllerButton },
+	//{ "SDL_PrivateGameControllerParseButton_REAL", (uintptr_t)&SDL_PrivateGameControllerParseButton },
+	//{ "SDL_PrivateGameControllerRefreshMapping_REAL", (uintptr_t)&SDL_PrivateGameControllerRefreshMapping },
+	//{ "SDL_PrivateGetControllerGUIDFromMappingString_REAL", (uintptr_t)&SDL_PrivateGetControllerGUIDFromMappingString },
+	//{ "SDL_PrivateGetControllerMapping_REAL", (uintptr_t)&SDL_PrivateGetControllerMapping },
+	//{ "SDL_PrivateGetControllerMappingForGUID_REAL", (uintptr_t)&SDL_PrivateGetControllerMappingForGUID },
+	//{ "SDL_PrivateGetControllerMappingFromMappingString_REAL", (uintptr_t)&SDL_PrivateGetControllerMappingFromMappingString },
+	//{ "SDL_PrivateGetControllerNameFromMappingString_REAL", (uintptr_t)&SDL_PrivateGetControllerNameFromMappingString },
+	//{ "SDL_PrivateJoystickAxis_REAL", (uintptr_t)&SDL_PrivateJoystickAxis },
+	//{ "SDL_PrivateJoystickBall_REAL", (uintptr_t)&SDL_PrivateJoystickBall },
+	//{ "SDL_PrivateJoystickButton_REAL", (uintptr_t)&SDL_PrivateJoystickButton },
+	//{ "SDL_PrivateJoystickHat_REAL", (uintptr_t)&SDL_PrivateJoystickHat },
+	//{ "SDL_PrivateJoystickNeedsPolling_REAL", (uintptr_t)&SDL_PrivateJoystickNeedsPolling },
+	//{ "SDL_PrivateJoystickValid_REAL", (uintptr_t)&SDL_PrivateJoystickValid },
+	//{ "SDL_PrivateLoadButtonMapping_REAL", (uintptr_t)&SDL_PrivateLoadButtonMapping },
+	{ "SDL_PumpEvents_REAL", (uintptr_t)&SDL_PumpEvents },
+	{ "SDL_PushEvent_REAL", (uintptr_t)&SDL_PushEvent },
+	{ "SDL_QueryTexture_REAL", (uintptr_t)&SDL_QueryTexture },
+	{ "SDL_Quit_REAL", (uintptr_t)&SDL_Quit },
+	//{ "SDL_QuitInit_REAL", (uintptr_t)&SDL_QuitInit },
+	//{ "SDL_QuitQuit_REAL", (uintptr_t)&SDL_QuitQuit },
+	{ "SDL_QuitSubSystem_REAL", (uintptr_t)&SDL_QuitSubSystem },
+	//{ "SDL_RLEAlphaBlit_REAL", (uintptr_t)&SDL_RLEAlphaBlit },
+	//{ "SDL_RLEBlit_REAL", (uintptr_t)&SDL_RLEBlit },
+	//{ "SDL_RLESurface_REAL", (uintptr_t)&SDL_RLESurface },
+	{ "SDL_RWFromConstMem_REAL", (uintptr_t)&SDL_RWFromConstMem },
+	{ "SDL_RWFromFP_REAL", (uintptr_t)&SDL_RWFromFP },
+	{ "SDL_RWFromFile_REAL", (uintptr_t)&SDL_RWFromFile_hook },
+	{ "SDL_RWFromMem_REAL", (uintptr_t)&SDL_RWFromMem },
+	{ "SDL_RaiseWindow_REAL", (uintptr_t)&SDL_RaiseWindow },
+	{ "SDL_ReadBE16_REAL", (uintptr_t)&SDL_ReadBE16 },
+	{ "SDL_ReadBE32_REAL", (uintptr_t)&SDL_ReadBE32 },
+	{ "SDL_ReadBE64_REAL", (uintptr_t)&SDL_ReadBE64 },
+	{ "SDL_ReadLE16_REAL", (uintptr_t)&SDL_ReadLE16 },
+	{ "SDL_ReadLE32_REAL", (uintptr_t)&SDL_ReadLE32 },
+	{ "SDL_ReadLE64_REAL", (uintptr_t)&SDL_ReadLE64 },
+	{ "SDL_ReadU8_REAL", (uintptr_t)&SDL_ReadU8 },
+	{ "SDL_RecordGesture_REAL", (uintptr_t)&SDL_RecordGesture },
+	//{ "SDL_RecreateWindow_REAL", (uintptr_t)&SDL_RecreateWindow },
+	{ "SDL_RegisterEvents_REAL", (uintptr_t)&SDL_RegisterEvents },
+	//{ "SDL_RegisterHintChangedCb_REAL", (uintptr_t)&SDL_RegisterHintChangedCb },
+	{ "SDL_RemoveTimer_REAL", (uintptr_t)&SDL_RemoveTimer },
+	{ "SDL_RenderClear_REAL", (uintptr_t)&SDL_RenderClear },
+	{ "SDL_RenderCopy_REAL", (uintptr_t)&SDL_RenderCopy },
+	{ "SDL_RenderCopyEx_REAL", (uintptr_t)&SDL_RenderCopyEx },
+	{ "SDL_RenderDrawLine_REAL", (uintptr_t)&SDL_RenderDrawLine },
+	{ "SDL_RenderDrawLines_REAL", (uintptr_t)&SDL_RenderDrawLines },
+	{ "SDL_RenderDrawPoint_REAL", (uintptr_t)&SDL_RenderDrawPoint },
+	{ "SDL_RenderDrawPoints_REAL", (uintptr_t)&SDL_RenderDrawPoints },
+	{ "SDL_RenderDrawRect_REAL", (uintptr_t)&SDL_RenderDrawRect },
+	{ "SDL_RenderDrawRects_REAL", (uintptr_t)&SDL_RenderDrawRects },
+	{ "SDL_RenderFillRect_REAL", (uintptr_t)&SDL_RenderFillRect },
+	{ "SDL_RenderFillRects_REAL", (uintptr_t)&SDL_RenderFillRects },
+	{ "SDL_RenderGetLogicalSize_REAL", (uintptr_t)&SDL_RenderGetLogicalSize },
+	{ "SDL_RenderGetScale_REAL", (uintptr_t)&SDL_RenderGetScale },
+	{ "SDL_RenderGetViewport_REAL", (uintptr_t)&SDL_RenderGetViewport },
+	{ "SDL_RenderPresent_REAL", (uintptr_t)&SDL_RenderPresent },
+	{ "SDL_RenderReadPixels_REAL", (uintptr_t)&SDL_RenderReadPixels },
+	{ "SDL_RenderSetLogicalSize_REAL", (uintptr_t)&SDL_RenderSetLogicalSize },
+	{ "SDL_RenderSetScale_REAL", (uintptr_t)&SDL_RenderSetScale },
+	{ "SDL_RenderSetViewport_REAL", (uintptr_t)&SDL_RenderSetViewport },
+	{ "SDL_RenderTargetSupported_REAL", (uintptr_t)&SDL_RenderTargetSupported },
+	{ "SDL_ResetAssertionReport_REAL", (uintptr_t)&SDL_ResetAssertionReport },
+	//{ "SDL_ResetKeyboard_REAL", (uintptr_t)&SDL_ResetKeyboard },
+	//{ "SDL_ResetMouse_REAL", (uintptr_t)&SDL_ResetMouse },
+	{ "SDL_RestoreWindow_REAL", (uintptr_t)&SDL_RestoreWindow },
+	//{ "SDL_RunAudio_REAL", (uintptr_t)&SDL_RunAudio },
+	//{ "SDL_RunThread_REAL", (uintptr_t)&SDL_RunThread },
+	//{ "SDL_SW_CopyYUVToRGB_REAL", (uintptr_t)&SDL_SW_CopyYUVToRGB },
+	//{ "SDL_SW_CreateYUVTexture_REAL", (uintptr_t)&SDL_SW_CreateYUVTexture },
+	//{ "SDL_SW_DestroyYUVTexture_REAL", (uintptr_t)&SDL_SW_DestroyYUVTexture },
+	//{ "SDL_SW_LockYUVTexture_REAL", (uintptr_t)&SDL_SW_LockYUVTexture },
+	//{ "SDL_SW_QueryYUVTexturePixels_REAL", (uintptr_t)&SDL_SW_QueryYUVTexturePixels },
+	//{ "SDL_SW_UnlockYUVTexture_REAL", (uintptr_t)&SDL_SW_UnlockYUVTexture },
+	//{ "SDL_SW_UpdateYUVTexture_REAL", (uintptr_t)&SDL_SW_UpdateYUVTexture },
+	//{ "SDL_SYS_CreateThread_REAL", (uintptr_t)&SDL_SYS_CreateThread },
+	//{ "SDL_SYS_GetInstanceIdOfDeviceIndex_REAL", (uintptr_t)&SDL_SYS_GetInstanceIdOfDeviceIndex },
+	//{ "SDL_SYS_HapticClose_REAL", (uintptr_t)&SDL_SYS_HapticClose },
+	//{ "SDL_SYS_HapticDestroyEffect_REAL", (uintptr_t)&SDL_SYS_HapticDestroyEffect },
+	//{ "SDL_SYS_HapticGetEffectStatus_REAL", (uintptr_t)&SDL_SYS_HapticGetEffectStatus },
+	//{ "SDL_SYS_HapticInit_REAL", (uintptr_t)&SDL_SYS_HapticInit },
+	//{ "SDL_SYS_HapticMouse_REAL", (uintptr_t)&SDL_SYS_HapticMouse },
+	//{ "SDL_SYS_HapticName_REAL", (uintptr_t)&SDL_SYS_HapticName },
+	//{ "SDL_SYS_HapticNewEffect_REAL", (uintptr_t)&SDL_SYS_HapticNewEffect },
+	//{ "SDL_SYS_HapticOpen_REAL", (uintptr_t)&SDL_SYS_HapticOpen },
+	//{ "SDL_SYS_HapticOpenFromJoystick_REAL", (uintptr_t)&SDL_SYS_HapticOpenFromJoystick },
+	//{ "SDL_SYS_HapticPause_REAL", (uintptr_t)&SDL_SYS_HapticPause },
+	//{ "SDL_SYS_HapticQuit_REAL", (uintptr_t)&SDL_SYS_HapticQuit },
+	//{ "SDL_SYS_HapticRunEffect_REAL", (uintptr_t)&SDL_SYS_HapticRunEffect },
+	//{ "SDL_SYS_HapticSetAutocenter_REAL", (uintptr_t)&SDL_SYS_HapticSetAutocenter },
+	//{ "SDL_SYS_HapticSetGain_REAL", (uintptr_t)&SDL_SYS_HapticSetGain },
+	//{ "SDL_SYS_HapticStopAll_REAL", (uintptr_t)&SDL_SYS_HapticStopAll },
+	//{ "SDL_SYS_HapticStopEffect_REAL", (uintptr_t)&SDL_SYS_HapticStopEffect },
+	//{ "SDL_SYS_HapticUnpause_REAL", (uintptr_t)&SDL_SYS_HapticUnpause },
+	//{ "SDL_SYS_HapticUpdateEffect_REAL", (uintptr_t)&SDL_SYS_HapticUpdateEffect },
+	//{ "SDL_SYS_JoystickAttached_REAL", (uintptr_t)&SDL_SYS_JoystickAttached },
+	//{ "SDL_SYS_JoystickClose_REAL", (uintptr_t)&SDL_SYS_JoystickClose },
+	//{ "SDL_SYS_JoystickDetect_REAL", (uintptr_t)&SDL_SYS_JoystickDetect },
+	//{ "SDL_SYS_JoystickGetDeviceGUID_REAL", (uintptr_t)&SDL_SYS_JoystickGetDeviceGUID },
+	//{ "SDL_SYS_JoystickGetGUID_REAL", (uintptr_t)&SDL_SYS_JoystickGetGUID },
+	//{ "SDL_SYS_JoystickInit_REAL", (uintptr_t)&SDL_SYS_JoystickInit },
+	//{ "SDL_SYS_JoystickIsHaptic_REAL", (uintptr_t)&SDL_SYS_JoystickIsHaptic },
+	//{ "SDL_SYS_JoystickNameForDeviceIndex_REAL", (uintptr_t)&SDL_SYS_JoystickNameForDeviceIndex },
+	//{ "SDL_SYS_JoystickNeedsPolling_REAL", (uintptr_t)&SDL_SYS_JoystickNeedsPolling },
+	//{ "SDL_SYS_JoystickOpen_REAL", (uintptr_t)&SDL_SYS_JoystickOpen },
+	//{ "SDL_SYS_JoystickQuit_REAL", (uintptr_t)&SDL_SYS_JoystickQuit },
+	//{ "SDL_SYS_JoystickSameHaptic_REAL", (uintptr_t)&SDL_SYS_JoystickSameHaptic },
+	//{ "SDL_SYS_JoystickUpdate_REAL", (uintptr_t)&SDL_SYS_JoystickUpdate },
+	//{ "SDL_SYS_NumJoysticks_REAL", (uintptr_t)&SDL_SYS_NumJoysticks },
+	//{ "SDL_SYS_SetThreadPriority_REAL", (uintptr_t)&SDL_SYS_SetThreadPriority },
+	//{ "SDL_SYS_SetupThread_REAL", (uintptr_t)&SDL_SYS_SetupThread },
+	//{ "SDL_SYS_WaitThread_REAL", (uintptr_t)&SDL_SYS_WaitThread },
+	{ "SDL_SaveAllDollarTemplates_REAL", (uintptr_t)&SDL_SaveAllDollarTemplates },
+	{ "SDL_SaveBMP_RW_REAL", (uintptr_t)&SDL_SaveBMP_RW },
+	{ "SDL_SaveDollarTemplate_REAL", (uintptr_t)&SDL_SaveDollarTemplate },
+	{ "SDL_SemPost_REAL", (uintptr_t)&SDL_SemPost },
+	{ "SDL_SemTryWait_REAL", (uintptr_t)&SDL_SemTryWait },
+	{ "SDL_SemValue_REAL", (uintptr_t)&SDL_SemValue },
+	{ "SDL_SemWait_REAL", (uintptr_t)&SDL_SemWait },
+	{ "SDL_SemWaitTimeout_REAL", (uintptr_t)&SDL_SemWaitTimeout },
+	//{ "SDL_SendClipboardUpdate_REAL", (uintptr_t)&SDL_SendClipboardUpdate },
+	//{ "SDL_SendDropFile_REAL", (uintptr_t)&SDL_SendDropFile },
+	//{ "SDL_SendEditingText_REAL", (uintptr_t)&SDL_SendEditingText },
+	//{ "SDL_SendGestureMulti_REAL", (uintptr_t)&SDL_SendGestureMulti },
+	//{ "SDL_SendKeyboardKey_REAL", (uintptr_t)&SDL_SendKeyboardKey },
+	//{ "SDL_SendKeyboardText_REAL", (uintptr_t)&SDL_SendKeyboardText },
+	//{ "SDL_SendMouseButton_REAL", (uintptr_t)&SDL_SendMouseButton },
+	//{ "SDL_SendMouseMotion_REAL", (uintptr_t)&SDL_SendMouseMotion },
+	//{ "SDL_SendMouseWheel_REAL", (uintptr_t)&SDL_SendMouseWheel },
+	//{ "SDL_SendQuit_REAL", (uintptr_t)&SDL_SendQuit },
+	//{ "SDL_SendSysWMEvent_REAL", (uintptr_t)&SDL_SendSysWMEvent },
+	//{ "SDL_SendTouch_REAL", (uintptr_t)&SDL_SendTouch },
+	//{ "SDL_SendTouchMotion_REAL", (uintptr_t)&SDL_SendTouchMotion },
+	//{ "SDL_SendWindowEvent_REAL", (uintptr_t)&SDL_SendWindowEvent },
+	{ "SDL_SetAssertionHandler_REAL", (uintptr_t)&SDL_SetAssertionHandler },
+	{ "SDL_SetClipRect_REAL", (uintptr_t)&SDL_SetClipRect },
+	{ "SDL_SetClipboardText_REAL", (uintptr_t)&SDL_SetClipboardText },
+	{ "SDL_SetColorKey_REAL", (uintptr_t)&SDL_SetColorKey },
+	{ "SDL_SetCursor_REAL", (uintptr_t)&SDL_SetCursor },
+	//{ "SDL_SetDefaultCursor_REAL", (uintptr_t)&SDL_SetDefaultCursor },
+	{ "SDL_SetError_REAL", (uintptr_t)&SDL_SetError },
+	{ "SDL_SetEventFilter_REAL", (uintptr_t)&SDL_SetEventFilter },
+	{ "SDL_SetHint_REAL", (uintptr_t)&SDL_SetHint },
+	{ "SDL_SetHintWithPriority_REAL", (uintptr_t)&SDL_SetHintWithPriority },
+	//{ "SDL_SetKeyboardFocus_REAL", (uintptr_t)&SDL_SetKeyboardFocus },
+	//{ "SDL_SetKeymap_REAL", (uintptr_t)&SDL_SetKeymap },
+	{ "SDL_SetModState_REAL", (uintptr_t)&SDL_SetModState },
+	//{ "SDL_SetMouseFocus_REAL", (uintptr_t)&SDL_SetMouseFocus },
+	{ "SDL_SetPaletteColors_REAL", (uintptr_t)&SDL_SetPaletteColors },
+	{ "SDL_SetPixelFormatPalette_REAL", (uintptr_t)&SDL_SetPixelFormatPalette },
+	{ "SDL_SetRelativeMouseMode_REAL", (uintptr_t)&SDL_SetRelativeMouseMode },
+	{ "SDL_SetRenderDrawBlendMode_REAL", (uintptr_t)&SDL_SetRenderDrawBlendMode },
+	{ "SDL_SetRenderDrawColor_REAL", (uintptr_t)&SDL_SetRenderDrawColor },
+	{ "SDL_SetRenderTarget_REAL", (uintptr_t)&SDL_SetRenderTarget },
+	//{ "SDL_SetScancodeName_REAL", (uintptr_t)&SDL_SetScancodeName },
+	{ "SDL_SetSurfaceAlphaMod_REAL", (uintptr_t)&SDL_SetSurfaceAlphaMod },
+	{ "SDL_SetSurfaceBlendMode_REAL", (uintptr_t)&SDL_SetSurfaceBlendMode },
+	{ "SDL_SetSurfaceColorMod_REAL", (uintptr_t)&SDL_SetSurfaceColorMod },
+	{ "SDL_SetSurfacePalette_REAL", (uintptr_t)&SDL_SetSurfacePalette },
+	{ "SDL_SetSurfaceRLE_REAL", (uintptr_t)&SDL_SetSurfaceRLE },
+	{ "SDL_SetTextInputRect_REAL", (uintptr_t)&SDL_SetTextInputRect },
+	{ "SDL_SetTextureAlphaMod_REAL", (uintptr_t)&SDL_SetTextureAlphaMod },
+	{ "SDL_SetTextureBlendMode_REAL", (uintptr_t)&SDL_SetTextureBlendMode },
+	{ "SDL_SetTextureColorMod_REAL", (uintptr_t)&SDL_SetTextureColorMod },
+	{ "SDL_SetThreadPriority_REAL", (uintptr_t)&SDL_SetThreadPriority },
+	{ "SDL_SetWindowBordered_REAL", (uintptr_t)&SDL_SetWindowBordered },
+	{ "SDL_SetWindowBrightness_REAL", (uintptr_t)&SDL_SetWindowBrightness },
+	{ "SDL_SetWindowData_REAL", (uintptr_t)&SDL_SetWindowData },
+	{ "SDL_SetWindowDisplayMode_REAL", (uintptr_t)&SDL_SetWindowDisplayMode },
+	{ "SDL_SetWindowFullscreen_REAL", (uintptr_t)&SDL_SetWindowFullscreen },
+	{ "SDL_SetWindowGammaRamp_REAL", (uintptr_t)&SDL_SetWindowGammaRamp },
+	{ "SDL_SetWindowGrab_REAL", (uintptr_t)&SDL_SetWindowGrab },
+	{ "SDL_SetWindowIcon_REAL", (uintptr_t)&SDL_SetWindowIcon },
+	{ "SDL_SetWindowMaximumSize_REAL", (uintptr_t)&SDL_SetWindowMaximumSize },
+	{ "SDL_SetWindowMinimumSize_REAL", (uintptr_t)&SDL_SetWindowMinimumSize },
+	{ "SDL_SetWindowPosition_REAL", (uintptr_t)&SDL_SetWindowPosition },
+	{ "SDL_SetWindowShape_REAL", (uintptr_t)&SDL_SetWindowShape },
+	{ "SDL_SetWindowSize_REAL", (uintptr_t)&SDL_SetWindowSize },
+	{ "SDL_SetWindowTitle_REAL", (uintptr_t)&SDL_SetWindowTitle },
+	//{ "SDL_ShouldAllowTopmost_REAL", (uintptr_t)&SDL_ShouldAllowTopmost },
+	{ "SDL_ShowCursor_REAL", (uintptr_t)&SDL_ShowCursor },
+	{ "SDL_ShowMessageBox_REAL", (uintptr_t)&SDL_ShowMessageBox },
+	//{ "SDL_ShowProgressHUD_REAL", (uintptr_t)&SDL_ShowProgressHUD },
+	{ "SDL_ShowSimpleMessageBox_REAL", (uintptr_t)&SDL_ShowSimpleMessageBox },
+	{ "SDL_ShowWindow_REAL", (uintptr_t)&SDL_ShowWindow },
+	{ "SDL_SoftStretch_REAL", (uintptr_t)&SDL_SoftStretch },
+	//{ "SDL_StartEventLoop_REAL", (uintptr_t)&SDL_StartEventLoop },
+	{ "SDL_StartTextInput_REAL", (uintptr_t)&SDL_StartTextInput },
+	//{ "SDL_StartTicks_REAL", (uintptr_t)&SDL_StartTicks },
+	//{ "SDL_StopEventLoop_REAL", (uintptr_t)&SDL_StopEventLoop },
+	{ "SDL_StopTextInput_REAL", (uintptr_t)&SDL_StopTextInput },
+	{ "SDL_ThreadID_REAL", (uintptr_t)&SDL_ThreadID },
+	//{ "SDL_TimerInit_REAL", (uintptr_t)&SDL_TimerInit },
+	//{ "SDL_TimerQuit_REAL", (uintptr_t)&SDL_TimerQuit },
+	//{ "SDL_TouchInit_REAL", (uintptr_t)&SDL_TouchInit },
+	//{ "SDL_TouchQuit_REAL", (uintptr_t)&SDL_TouchQuit },
+	//{ "SDL_TraverseShapeTree_REAL", (uintptr_t)&SDL_TraverseShapeTree },
+	{ "SDL_TryLockMutex_REAL", (uintptr_t)&SDL_TryLockMutex },
+	//{ "SDL_UnRLESurface_REAL", (uintptr_t)&SDL_UnRLESurface },
+	//{ "SDL_UninstallParachute_REAL", (uintptr_t)&SDL_UninstallParachute },
+	{ "SDL_UnionRect_REAL", (uintptr_t)&SDL_UnionRect },
+	{ "SDL_UnloadObject_REAL", (uintptr_t)&SDL_UnloadObject },
+	{ "SDL_UnlockAudio_REAL", (uintptr_t)&SDL_UnlockAudio },
+	{ "SDL_UnlockAudioDevice_REAL", (uintptr_t)&SDL_UnlockAudioDevice },
+	{ "SDL_UnlockMutex_REAL", (uintptr_t)&SDL_UnlockMutex },
+	{ "SDL_UnlockSurface_REAL", (uintptr_t)&SDL_UnlockSurface },
+	{ "SDL_UnlockTexture_REAL", (uintptr_t)&SDL_UnlockTexture },
+	{ "SDL_UpdateTexture_REAL", (uintptr_t)&SDL_UpdateTexture },
+	//{ "SDL_UpdateWindowGrab_REAL", (uintptr_t)&SDL_UpdateWindowGrab },
+	{ "SDL_UpdateWindowSurface_REAL", (uintptr_t)&SDL_UpdateWindowSurface },
+	{ "SDL_UpdateWindowSurfaceRects_REAL", (uintptr_t)&SDL_UpdateWindowSurfaceRects },
+	{ "SDL_UpperBlit_REAL", (uintptr_t)&SDL_UpperBlit },
+	{ "SDL_UpperBlitScaled_REAL", (uintptr_t)&SDL_UpperBlitScaled },
+	//{ "SDL_Vibrate_REAL", (uintptr_t)&SDL_Vibrate },
+	{ "SDL_VideoInit_REAL", (uintptr_t)&SDL_VideoInit },
+	{ "SDL_VideoQuit_REAL", (uintptr_t)&SDL_VideoQuit },
+	{ "SDL_WaitEvent_REAL", (uintptr_t)&SDL_WaitEvent },
+	{ "SDL_WaitEventTimeout_REAL", (uintptr_t)&SDL_WaitEventTimeout },
+	{ "SDL_WaitThread_REAL", (uintptr_t)&SDL_WaitThread },
+	{ "SDL_WarpMouseInWindow_REAL", (uintptr_t)&SDL_WarpMouseInWindow },
+	{ "SDL_WasInit_REAL", (uintptr_t)&SDL_WasInit },
+	{ "SDL_WriteBE16_REAL", (uintptr_t)&SDL_WriteBE16 },
+	{ "SDL_WriteBE32_REAL", (uintptr_t)&SDL_WriteBE32 },
+	{ "SDL_WriteBE64_REAL", (uintptr_t)&SDL_WriteBE64 },
+	{ "SDL_WriteLE16_REAL", (uintptr_t)&SDL_WriteLE16 },
+	{ "SDL_WriteLE32_REAL", (uintptr_t)&SDL_WriteLE32 },
+	{ "SDL_WriteLE64_REAL", (uintptr_t)&SDL_WriteLE64 },
+	{ "SDL_WriteU8_REAL", (uintptr_t)&SDL_WriteU8 },
+	{ "SDL_abs_REAL", (uintptr_t)&SDL_abs },
+	{ "SDL_atof_REAL", (uintptr_t)&SDL_atof },
+	{ "SDL_atoi_REAL", (uintptr_t)&SDL_atoi },
+	{ "SDL_calloc_REAL", (uintptr_t)&SDL_calloc },
+	{ "SDL_ceil_REAL", (uintptr_t)&SDL_ceil },
+	{ "SDL_cosf_REAL", (uintptr_t)&SDL_cosf },
+	{ "SDL_free_REAL", (uintptr_t)&SDL_free },
+	{ "SDL_getenv_REAL", (uintptr_t)&SDL_getenv },
+	{ "SDL_iconv_REAL", (uintptr_t)&SDL_iconv },
+	{ "SDL_iconv_close_REAL", (uintptr_t)&SDL_iconv_close },
+	{ "SDL_iconv_open_REAL", (uintptr_t)&SDL_iconv_open },
+	{ "SDL_iconv_string_REAL", (uintptr_t)&SDL_iconv_string },
+	{ "SDL_isdigit_REAL", (uintptr_t)&SDL_isdigit },
+	{ "SDL_isspace_REAL", (uintptr_t)&SDL_isspace },
+	{ "SDL_itoa_REAL", (uintptr_t)&SDL_itoa },
+	{ "SDL_lltoa_REAL", (uintptr_t)&SDL_lltoa },
+	{ "SDL_ltoa_REAL", (uintptr_t)&SDL_ltoa },
+	{ "SDL_malloc_REAL", (uintptr_t)&SDL_malloc },
+	{ "SDL_memcmp_REAL", (uintptr_t)&SDL_memcmp },
+	{ "SDL_memcpy_REAL", (uintptr_t)&SDL_memcpy },
+	{ "SDL_memmove_REAL", (uintptr_t)&SDL_memmove },
+	{ "SDL_memset_REAL", (uintptr_t)&SDL_memset },
+	{ "SDL_qsort_REAL", (uintptr_t)&SDL_qsort },
+	{ "SDL_realloc_REAL", (uintptr_t)&SDL_realloc },
+	{ "SDL_setenv_REAL", (uintptr_t)&SDL_setenv },
+	{ "SDL_sinf_REAL", (uintptr_t)&SDL_sinf },
+	{ "SDL_snprintf_REAL", (uintptr_t)&SDL_snprintf },
+	{ "SDL_sscanf_REAL", (uintptr_t)&SDL_sscanf },
+	{ "SDL_strcasecmp_REAL", (uintptr_t)&SDL_strcasecmp },
+	{ "SDL_strchr_REAL", (uintptr_t)&SDL_strchr },
+	{ "SDL_strcmp_REAL", (uintptr_t)&SDL_strcmp },
+	{ "SDL_strdup_REAL", (uintptr_t)&SDL_strdup },
+	{ "SDL_strlcat_REAL", (uintptr_t)&SDL_strlcat },
+	{ "SDL_strlcpy_REAL", (uintptr_t)&SDL_strlcpy },
+	{ "SDL_strlen_REAL", (uintptr_t)&SDL_strlen },
+	{ "SDL_strlwr_REAL", (uintptr_t)&SDL_strlwr },
+	{ "SDL_strncasecmp_REAL", (uintptr_t)&SDL_strncasecmp },
+	{ "SDL_strncmp_REAL", (uintptr_t)&SDL_strncmp },
+	{ "SDL_strrchr_REAL", (uintptr_t)&SDL_strrchr },
+	{ "SDL_strrev_REAL", (uintptr_t)&SDL_strrev },
+	{ "SDL_strstr_REAL", (uintptr_t)&SDL_strstr },
+	{ "SDL_strtod_REAL", (uintptr_t)&SDL_strtod },
+	{ "SDL_strtol_REAL", (uintptr_t)&SDL_strtol },
+	{ "SDL_strtoll_REAL", (uintptr_t)&SDL_strtoll },
+	{ "SDL_strtoul_REAL", (uintptr_t)&SDL_strtoul },
+	{ "SDL_strtoull_REAL", (uintptr_t)&SDL_strtoull },
+	{ "SDL_strupr_REAL", (uintptr_t)&SDL_strupr },
+	{ "SDL_tolower_REAL", (uintptr_t)&SDL_tolower },
+	{ "SDL_toupper_REAL", (uintptr_t)&SDL_toupper },
+	{ "SDL_uitoa_REAL", (uintptr_t)&SDL_uitoa },
+	{ "SDL_ulltoa_REAL", (uintptr_t)&SDL_ulltoa },
+	{ "SDL_ultoa_REAL", (uintptr_t)&SDL_ultoa },
+	{ "SDL_utf8strlcpy_REAL", (uintptr_t)&SDL_utf8strlcpy },
+	{ "SDL_vsnprintf_REAL", (uintptr_t)&SDL_vsnprintf },
+	{ "SDL_wcslcat_REAL", (uintptr_t)&SDL_wcslcat },
+	{ "SDL_wcslcpy_REAL", (uintptr_t)&SDL_wcslcpy },
+	{ "SDL_wcslen_REAL", (uintptr_t)&SDL_wcslen },
+};
+
 void patch_game(void) {
+	SceUInt64 patch_start = sceKernelGetProcessTimeWide();
+	so_hook_begin();
+
+#ifdef FIX_UNALIGNED
+	char fixup_path[256];
+	sprintf(fixup_path, "%s/unaligned.bin", data_path);
+	so_fix_unaligned(&thimbleweed_mod, fixup_path);
+#endif
+
 	//bool_hook = hook_addr(so_symbol(&thimbleweed_mod, "_ZN11GGUserPrefs7getBoolEPKcb"), (uintptr_t)&UserPrefsGetBool);
 	
 	dataFromFilename_hook = hook_addr(so_symbol(&thimbleweed_mod, "_ZN17GGPackfileManager16dataFromFilenameEP8GGStringb"), (uintptr_t)&dataFromFilename);
 	GGLoadDataFromFile = (void *)so_symbol(&thimbleweed_mod, "_Z18GGLoadDataFromFileP8GGStringPKhyyj");
-	
-	//hook_addr(so_symbol(&thimbleweed_mod, "_Z5GGLogPKcz"), (uintptr_t)&GGLog);
-	hook_addr(so_symbol(&thimbleweed_mod, "_Z11GGErrorFuncPKcz"), (uintptr_t)&ret0);
-	
-	hook_addr(so_symbol(&thimbleweed_mod, "_ZN6GGCurl13httpPostASyncEP8GGStringP12GGDictionary"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "_ZN9Analytics6uploadEv"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "_Z11InitObbPathv"), (uintptr_t)&InitObbPath);
-	
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_Linked_Version"), (uintptr_t)&IMG_Linked_Version);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_Init"), (uintptr_t)&IMG_Init);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_Quit"), (uintptr_t)&IMG_Quit);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadTyped_RW"), (uintptr_t)&IMG_LoadTyped_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_Load"), (uintptr_t)&IMG_Load_hook);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_Load_RW"), (uintptr_t)&IMG_Load_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadTexture"), (uintptr_t)&IMG_LoadTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadTexture_RW"), (uintptr_t)&IMG_LoadTexture_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadTextureTyped_RW"), (uintptr_t)&IMG_LoadTextureTyped_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isXPM"), (uintptr_t)&IMG_isXPM);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadXPM_RW"), (uintptr_t)&IMG_LoadXPM_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_ReadXPMFromArray"), (uintptr_t)&IMG_ReadXPMFromArray);
-	//hook_addr(so_symbol(&thimbleweed_mod, "IMG_InitPNG"), (uintptr_t)&IMG_InitPNG);
-	//hook_addr(so_symbol(&thimbleweed_mod, "IMG_QuitPNG"), (uintptr_t)&IMG_QuitPNG);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isPNG"), (uintptr_t)&IMG_isPNG);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadPNG_RW"), (uintptr_t)&IMG_LoadPNG_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_SavePNG_RW"), (uintptr_t)&IMG_SavePNG_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_SavePNG"), (uintptr_t)&IMG_SavePNG);
-	//hook_addr(so_symbol(&thimbleweed_mod, "IMG_InitJPG"), (uintptr_t)&IMG_InitJPG);
-	//hook_addr(so_symbol(&thimbleweed_mod, "IMG_QuitJPG"), (uintptr_t)&IMG_QuitJPG);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isJPG"), (uintptr_t)&IMG_isJPG);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadJPG_RW"), (uintptr_t)&IMG_LoadJPG_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isBMP"), (uintptr_t)&IMG_isBMP);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isICO"), (uintptr_t)&IMG_isICO);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isCUR"), (uintptr_t)&IMG_isCUR);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadBMP_RW"), (uintptr_t)&IMG_LoadBMP_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadICO_RW"), (uintptr_t)&IMG_LoadICO_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadCUR_RW"), (uintptr_t)&IMG_LoadCUR_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isPCX"), (uintptr_t)&IMG_isPCX);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadPCX_RW"), (uintptr_t)&IMG_LoadPCX_RW);
-	//hook_addr(so_symbol(&thimbleweed_mod, "IMG_InitWEBP"), (uintptr_t)&IMG_InitWEBP);
-	//hook_addr(so_symbol(&thimbleweed_mod, "IMG_QuitWEBP"), (uintptr_t)&IMG_QuitWEBP);
-	//hook_addr(so_symbol(&thimbleweed_mod, "IMG_isWEB"), (uintptr_t)&IMG_isWEB);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadWEBP_RW"), (uintptr_t)&IMG_LoadWEBP_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isXCF"), (uintptr_t)&IMG_isXCF);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadXCF_RW"), (uintptr_t)&IMG_LoadXCF_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isGIF"), (uintptr_t)&IMG_isGIF);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadGIF_RW"), (uintptr_t)&IMG_LoadGIF_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadTGA_RW"), (uintptr_t)&IMG_LoadTGA_RW);
-	//hook_addr(so_symbol(&thimbleweed_mod, "IMG_InitTIF"), (uintptr_t)&IMG_InitTIF);
-	//hook_addr(so_symbol(&thimbleweed_mod, "IMG_QuitTIF"), (uintptr_t)&IMG_QuitTIF);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isTIF"), (uintptr_t)&IMG_isTIF);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadTIF_RW"), (uintptr_t)&IMG_LoadTIF_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isPNM"), (uintptr_t)&IMG_isPNM);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadPNM_RW"), (uintptr_t)&IMG_LoadPNM_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isLBM"), (uintptr_t)&IMG_isLBM);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadLBM_RW"), (uintptr_t)&IMG_LoadLBM_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_isXV"), (uintptr_t)&IMG_isXV);
-	hook_addr(so_symbol(&thimbleweed_mod, "IMG_LoadXV_RW"), (uintptr_t)&IMG_LoadXV_RW);
-	
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddBasicVideoDisplay"), (uintptr_t)&SDL_AddBasicVideoDisplay);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddDisplayMode"), (uintptr_t)&SDL_AddDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddEventWatch"), (uintptr_t)&SDL_AddEventWatch);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddTimer"), (uintptr_t)&SDL_AddTimer);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddTouch"), (uintptr_t)&SDL_AddTouch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddVideoDisplay"), (uintptr_t)&SDL_AddVideoDisplay);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AllocBlitMap"), (uintptr_t)&SDL_AllocBlitMap);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AllocFormat"), (uintptr_t)&SDL_AllocFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AllocPalette"), (uintptr_t)&SDL_AllocPalette);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AllocRW"), (uintptr_t)&SDL_AllocRW);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetActivity"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetActivity_REAL"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetExternalCachePath"), (uintptr_t)&SDL_AndroidGetExternalStoragePath);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetExternalStoragePath"), (uintptr_t)&SDL_AndroidGetExternalStoragePath);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetExternalStorageState"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetInternalStoragePath"), (uintptr_t)&SDL_AndroidGetInternalStoragePath);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetInternalStoragePath_REAL"), (uintptr_t)&SDL_AndroidGetInternalStoragePath);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetJNIEnv"), (uintptr_t)&Android_JNI_GetEnv);
-	hook_addr(so_symbol(&thimbleweed_mod, "Android_JNI_GetEnv"), (uintptr_t)&Android_JNI_GetEnv);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Android_Init"), (uintptr_t)&ret0);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AssertionsInit"), (uintptr_t)&SDL_AssertionsInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AssertionsQuit"), (uintptr_t)&SDL_AssertionsQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AtomicCAS"), (uintptr_t)&SDL_AtomicCAS);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AtomicCASPtr"), (uintptr_t)&SDL_AtomicCASPtr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AtomicLock"), (uintptr_t)&SDL_AtomicLock);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AtomicTryLock"), (uintptr_t)&SDL_AtomicTryLock);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AtomicUnlock"), (uintptr_t)&SDL_AtomicUnlock);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AudioInit"), (uintptr_t)&SDL_AudioInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AudioQuit"), (uintptr_t)&SDL_AudioQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendFillRect"), (uintptr_t)&SDL_BlendFillRect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendFillRects"), (uintptr_t)&SDL_BlendFillRects);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendLine"), (uintptr_t)&SDL_BlendLine);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendLines"), (uintptr_t)&SDL_BlendLines);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendPoint"), (uintptr_t)&SDL_BlendPoint);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendPoints"), (uintptr_t)&SDL_BlendPoints);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlitCopy"), (uintptr_t)&SDL_BlitCopy);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_Blit_Slow"), (uintptr_t)&SDL_Blit_Slow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_BuildAudioCVT"), (uintptr_t)&SDL_BuildAudioCVT);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateAudioSpec"), (uintptr_t)&SDL_CalculateAudioSpec);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateBlit"), (uintptr_t)&SDL_CalculateBlit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateBlit0"), (uintptr_t)&SDL_CalculateBlit0);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateBlit1"), (uintptr_t)&SDL_CalculateBlit1);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateBlitA"), (uintptr_t)&SDL_CalculateBlitA);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateBlitN"), (uintptr_t)&SDL_CalculateBlitN);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateGammaRamp"), (uintptr_t)&SDL_CalculateGammaRamp);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculatePitch"), (uintptr_t)&SDL_CalculatePitch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateShapeBitmap"), (uintptr_t)&SDL_CalculateShapeBitmap);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateShapeTree"), (uintptr_t)&SDL_CalculateShapeTree);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ClearError"), (uintptr_t)&SDL_ClearError);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ClearHints"), (uintptr_t)&SDL_ClearHints);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CloseAudio"), (uintptr_t)&SDL_CloseAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CloseAudioDevice"), (uintptr_t)&SDL_CloseAudioDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CondBroadcast"), (uintptr_t)&SDL_CondBroadcast);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CondSignal"), (uintptr_t)&SDL_CondSignal);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CondWait"), (uintptr_t)&SDL_CondWait);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CondWaitTimeout"), (uintptr_t)&SDL_CondWaitTimeout);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ConvertAudio"), (uintptr_t)&SDL_ConvertAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ConvertPixels"), (uintptr_t)&SDL_ConvertPixels);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ConvertSurface"), (uintptr_t)&SDL_ConvertSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ConvertSurfaceFormat"), (uintptr_t)&SDL_ConvertSurfaceFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateColorCursor"), (uintptr_t)&SDL_CreateColorCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateCond"), (uintptr_t)&SDL_CreateCond);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateCursor"), (uintptr_t)&SDL_CreateCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateMutex"), (uintptr_t)&SDL_CreateMutex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateRGBSurface"), (uintptr_t)&SDL_CreateRGBSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateRGBSurfaceFrom"), (uintptr_t)&SDL_CreateRGBSurfaceFrom);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateRenderer"), (uintptr_t)&SDL_CreateRenderer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateSemaphore"), (uintptr_t)&SDL_CreateSemaphore);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateShapedWindow"), (uintptr_t)&SDL_CreateShapedWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateSoftwareRenderer"), (uintptr_t)&SDL_CreateSoftwareRenderer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateSystemCursor"), (uintptr_t)&SDL_CreateSystemCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateTexture"), (uintptr_t)&SDL_CreateTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateTextureFromSurface"), (uintptr_t)&SDL_CreateTextureFromSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateThread"), (uintptr_t)&SDL_CreateThread);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateWindow"), (uintptr_t)&SDL_CreateWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateWindowAndRenderer"), (uintptr_t)&SDL_CreateWindowAndRenderer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateWindowFrom"), (uintptr_t)&SDL_CreateWindowFrom);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DelEventWatch"), (uintptr_t)&SDL_DelEventWatch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DelFinger"), (uintptr_t)&SDL_DelFinger);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DelTouch"), (uintptr_t)&SDL_DelTouch);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Delay"), (uintptr_t)&SDL_Delay);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroyCond"), (uintptr_t)&SDL_DestroyCond);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroyMutex"), (uintptr_t)&SDL_DestroyMutex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroyRenderer"), (uintptr_t)&SDL_DestroyRenderer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroySemaphore"), (uintptr_t)&SDL_DestroySemaphore);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroyTexture"), (uintptr_t)&SDL_DestroyTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroyWindow"), (uintptr_t)&SDL_DestroyWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DisableScreenSaver"), (uintptr_t)&SDL_DisableScreenSaver);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DitherColors"), (uintptr_t)&SDL_DitherColors);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DrawLine"), (uintptr_t)&SDL_DrawLine);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DrawLines"), (uintptr_t)&SDL_DrawLines);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DrawPoint"), (uintptr_t)&SDL_DrawPoint);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DrawPoints"), (uintptr_t)&SDL_DrawPoints);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_EnableScreenSaver"), (uintptr_t)&SDL_EnableScreenSaver);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_EnclosePoints"), (uintptr_t)&SDL_EnclosePoints);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Error"), (uintptr_t)&SDL_Error);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_EventState"), (uintptr_t)&SDL_EventState);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FillRect"), (uintptr_t)&SDL_FillRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FillRects"), (uintptr_t)&SDL_FillRects);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FilterEvents"), (uintptr_t)&SDL_FilterEvents);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_FindColor"), (uintptr_t)&SDL_FindColor);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_FirstAudioFormat"), (uintptr_t)&SDL_FirstAudioFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FlushEvent"), (uintptr_t)&SDL_FlushEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FlushEvents"), (uintptr_t)&SDL_FlushEvents);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeBlitMap"), (uintptr_t)&SDL_FreeBlitMap);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeCursor"), (uintptr_t)&SDL_FreeCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeFormat"), (uintptr_t)&SDL_FreeFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreePalette"), (uintptr_t)&SDL_FreePalette);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeRW"), (uintptr_t)&SDL_FreeRW);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeShapeTree"), (uintptr_t)&SDL_FreeShapeTree);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeSurface"), (uintptr_t)&SDL_FreeSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeWAV"), (uintptr_t)&SDL_FreeWAV);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_BindTexture"), (uintptr_t)&SDL_GL_BindTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_CreateContext"), (uintptr_t)&SDL_GL_CreateContext);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_DeleteContext"), (uintptr_t)&SDL_GL_DeleteContext);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_ExtensionSupported"), (uintptr_t)&SDL_GL_ExtensionSupported);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_GetAttribute"), (uintptr_t)&SDL_GL_GetAttribute);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_GetProcAddress"), (uintptr_t)&SDL_GL_GetProcAddress);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_GetSwapInterval"), (uintptr_t)&SDL_GL_GetSwapInterval);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_LoadLibrary"), (uintptr_t)&SDL_GL_LoadLibrary);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_MakeCurrent"), (uintptr_t)&SDL_GL_MakeCurrent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_SetAttribute"), (uintptr_t)&SDL_GL_SetAttribute);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_SetSwapInterval"), (uintptr_t)&SDL_GL_SetSwapInterval);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_SwapWindow"), (uintptr_t)&SDL_GL_SwapWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_UnbindTexture"), (uintptr_t)&SDL_GL_UnbindTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_UnloadLibrary"), (uintptr_t)&SDL_GL_UnloadLibrary);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerAddMapping"), (uintptr_t)&SDL_GameControllerAddMapping);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerClose"), (uintptr_t)&SDL_GameControllerClose);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerEventState"), (uintptr_t)&SDL_GameControllerEventState);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerEventWatcher"), (uintptr_t)&SDL_GameControllerEventWatcher);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetAttached"), (uintptr_t)&SDL_GameControllerGetAttached);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetAxis"), (uintptr_t)&SDL_GameControllerGetAxis);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetAxisFromString"), (uintptr_t)&SDL_GameControllerGetAxisFromString);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetBindForAxis"), (uintptr_t)&SDL_GameControllerGetBindForAxis);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetBindForButton"), (uintptr_t)&SDL_GameControllerGetBindForButton);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetButton"), (uintptr_t)&SDL_GameControllerGetButton);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetButtonFromString"), (uintptr_t)&SDL_GameControllerGetButtonFromString);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetJoystick"), (uintptr_t)&SDL_GameControllerGetJoystick);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetStringForAxis"), (uintptr_t)&SDL_GameControllerGetStringForAxis);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetStringForButton"), (uintptr_t)&SDL_GameControllerGetStringForButton);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerInit"), (uintptr_t)&SDL_GameControllerInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerMapping"), (uintptr_t)&SDL_GameControllerMapping);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerMappingForGUID"), (uintptr_t)&SDL_GameControllerMappingForGUID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerName"), (uintptr_t)&SDL_GameControllerName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerNameForIndex"), (uintptr_t)&SDL_GameControllerNameForIndex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerOpen"), (uintptr_t)&SDL_GameControllerOpen);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerQuit"), (uintptr_t)&SDL_GameControllerQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerUpdate"), (uintptr_t)&SDL_GameControllerUpdate);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GestureAddTouch"), (uintptr_t)&SDL_GestureAddTouch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GestureProcessEvent"), (uintptr_t)&SDL_GestureProcessEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetAssertionReport"), (uintptr_t)&SDL_GetAssertionReport);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetAudioDeviceName"), (uintptr_t)&SDL_GetAudioDeviceName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetAudioDeviceStatus"), (uintptr_t)&SDL_GetAudioDeviceStatus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetAudioDriver"), (uintptr_t)&SDL_GetAudioDriver);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetAudioStatus"), (uintptr_t)&SDL_GetAudioStatus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCPUCacheLineSize"), (uintptr_t)&SDL_GetCPUCacheLineSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCPUCount"), (uintptr_t)&SDL_GetCPUCount);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetClipRect"), (uintptr_t)&SDL_GetClipRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetClipboardText"), (uintptr_t)&SDL_GetClipboardText);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetClosestDisplayMode"), (uintptr_t)&SDL_GetClosestDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetColorKey"), (uintptr_t)&SDL_GetColorKey);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCurrentAudioDriver"), (uintptr_t)&SDL_GetCurrentAudioDriver);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCurrentDisplayMode"), (uintptr_t)&SDL_GetCurrentDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCurrentVideoDriver"), (uintptr_t)&SDL_GetCurrentVideoDriver);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCursor"), (uintptr_t)&SDL_GetCursor);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDefaultKeymap"), (uintptr_t)&SDL_GetDefaultKeymap);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDesktopDisplayMode"), (uintptr_t)&SDL_GetDesktopDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDisplayBounds"), (uintptr_t)&SDL_GetDisplayBounds);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDisplayForWindow"), (uintptr_t)&SDL_GetDisplayForWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDisplayMode"), (uintptr_t)&SDL_GetDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDisplayName"), (uintptr_t)&SDL_GetDisplayName);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetErrBuf"), (uintptr_t)&SDL_GetErrBuf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetError"), (uintptr_t)&SDL_GetError);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetEventFilter"), (uintptr_t)&SDL_GetEventFilter);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetFinger"), (uintptr_t)&SDL_GetFinger);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetFocusWindow"), (uintptr_t)&SDL_GetFocusWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetHint"), (uintptr_t)&SDL_GetHint);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetKeyFromName"), (uintptr_t)&SDL_GetKeyFromName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetKeyFromScancode"), (uintptr_t)&SDL_GetKeyFromScancode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetKeyName"), (uintptr_t)&SDL_GetKeyName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetKeyboardFocus"), (uintptr_t)&SDL_GetKeyboardFocus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetKeyboardState"), (uintptr_t)&SDL_GetKeyboardState);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetModState"), (uintptr_t)&SDL_GetModState);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetMouse"), (uintptr_t)&SDL_GetMouse);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetMouseFocus"), (uintptr_t)&SDL_GetMouseFocus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetMouseState"), (uintptr_t)&SDL_GetMouseState);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumAudioDevices"), (uintptr_t)&SDL_GetNumAudioDevices);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumAudioDrivers"), (uintptr_t)&SDL_GetNumAudioDrivers);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumDisplayModes"), (uintptr_t)&SDL_GetNumDisplayModes);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumRenderDrivers"), (uintptr_t)&SDL_GetNumRenderDrivers);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumTouchDevices"), (uintptr_t)&SDL_GetNumTouchDevices);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumTouchFingers"), (uintptr_t)&SDL_GetNumTouchFingers);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumVideoDisplays"), (uintptr_t)&SDL_GetNumVideoDisplays);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumVideoDrivers"), (uintptr_t)&SDL_GetNumVideoDrivers);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPerformanceCounter"), (uintptr_t)&SDL_GetPerformanceCounter);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPerformanceFrequency"), (uintptr_t)&SDL_GetPerformanceFrequency);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPixelFormatName"), (uintptr_t)&SDL_GetPixelFormatName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPlatform"), (uintptr_t)&SDL_GetPlatform);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPowerInfo"), (uintptr_t)&SDL_GetPowerInfo);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPrefPath"), (uintptr_t)&SDL_GetPrefPath_hook);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPrefPath_REAL"), (uintptr_t)&SDL_GetPrefPath_hook);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPowerInfo_Android"), (uintptr_t)&SDL_GetPowerInfo_Android);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRGB"), (uintptr_t)&SDL_GetRGB);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRGBA"), (uintptr_t)&SDL_GetRGBA);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRelativeMouseMode"), (uintptr_t)&SDL_GetRelativeMouseMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRelativeMouseState"), (uintptr_t)&SDL_GetRelativeMouseState);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRenderDrawBlendMode"), (uintptr_t)&SDL_GetRenderDrawBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRenderDrawColor"), (uintptr_t)&SDL_GetRenderDrawColor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRenderDriverInfo"), (uintptr_t)&SDL_GetRenderDriverInfo);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRenderTarget"), (uintptr_t)&SDL_GetRenderTarget);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRenderer"), (uintptr_t)&SDL_GetRenderer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRendererInfo"), (uintptr_t)&SDL_GetRendererInfo);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRevision"), (uintptr_t)&SDL_GetRevision);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRevisionNumber"), (uintptr_t)&SDL_GetRevisionNumber);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetScancodeFromKey"), (uintptr_t)&SDL_GetScancodeFromKey);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetScancodeFromName"), (uintptr_t)&SDL_GetScancodeFromName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetScancodeName"), (uintptr_t)&SDL_GetScancodeName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetShapedWindowMode"), (uintptr_t)&SDL_GetShapedWindowMode);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetSpanEnclosingRect"), (uintptr_t)&SDL_GetSpanEnclosingRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetSurfaceAlphaMod"), (uintptr_t)&SDL_GetSurfaceAlphaMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetSurfaceBlendMode"), (uintptr_t)&SDL_GetSurfaceBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetSurfaceColorMod"), (uintptr_t)&SDL_GetSurfaceColorMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTextureAlphaMod"), (uintptr_t)&SDL_GetTextureAlphaMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTextureBlendMode"), (uintptr_t)&SDL_GetTextureBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTextureColorMod"), (uintptr_t)&SDL_GetTextureColorMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetThreadID"), (uintptr_t)&SDL_GetThreadID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetThreadName"), (uintptr_t)&SDL_GetThreadName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTicks"), (uintptr_t)&SDL_GetTicks);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTouch"), (uintptr_t)&SDL_GetTouch);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTouchDevice"), (uintptr_t)&SDL_GetTouchDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTouchFinger"), (uintptr_t)&SDL_GetTouchFinger);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetVersion"), (uintptr_t)&SDL_GetVersion);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetVideoDevice"), (uintptr_t)&SDL_GetVideoDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetVideoDriver"), (uintptr_t)&SDL_GetVideoDriver);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowBrightness"), (uintptr_t)&SDL_GetWindowBrightness);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowData"), (uintptr_t)&SDL_GetWindowData);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowDisplayIndex"), (uintptr_t)&SDL_GetWindowDisplayIndex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowDisplayMode"), (uintptr_t)&SDL_GetWindowDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowFlags"), (uintptr_t)&SDL_GetWindowFlags);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowFromID"), (uintptr_t)&SDL_GetWindowFromID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowGammaRamp"), (uintptr_t)&SDL_GetWindowGammaRamp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowGrab"), (uintptr_t)&SDL_GetWindowGrab);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowID"), (uintptr_t)&SDL_GetWindowID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowMaximumSize"), (uintptr_t)&SDL_GetWindowMaximumSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowMinimumSize"), (uintptr_t)&SDL_GetWindowMinimumSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowPixelFormat"), (uintptr_t)&SDL_GetWindowPixelFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowPosition"), (uintptr_t)&SDL_GetWindowPosition);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowSize"), (uintptr_t)&SDL_GetWindowSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowSurface"), (uintptr_t)&SDL_GetWindowSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowTitle"), (uintptr_t)&SDL_GetWindowTitle);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowWMInfo"), (uintptr_t)&SDL_GetWindowWMInfo);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticClose"), (uintptr_t)&SDL_HapticClose);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticDestroyEffect"), (uintptr_t)&SDL_HapticDestroyEffect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticEffectSupported"), (uintptr_t)&SDL_HapticEffectSupported);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticGetEffectStatus"), (uintptr_t)&SDL_HapticGetEffectStatus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticIndex"), (uintptr_t)&SDL_HapticIndex);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticInit"), (uintptr_t)&SDL_HapticInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticName"), (uintptr_t)&SDL_HapticName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticNewEffect"), (uintptr_t)&SDL_HapticNewEffect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticNumAxes"), (uintptr_t)&SDL_HapticNumAxes);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticNumEffects"), (uintptr_t)&SDL_HapticNumEffects);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticNumEffectsPlaying"), (uintptr_t)&SDL_HapticNumEffectsPlaying);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticOpen"), (uintptr_t)&SDL_HapticOpen);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticOpenFromJoystick"), (uintptr_t)&SDL_HapticOpenFromJoystick);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticOpenFromMouse"), (uintptr_t)&SDL_HapticOpenFromMouse);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticOpened"), (uintptr_t)&SDL_HapticOpened);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticPause"), (uintptr_t)&SDL_HapticPause);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticQuery"), (uintptr_t)&SDL_HapticQuery);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticQuit"), (uintptr_t)&SDL_HapticQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticRumbleInit"), (uintptr_t)&SDL_HapticRumbleInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticRumblePlay"), (uintptr_t)&SDL_HapticRumblePlay);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticRumbleStop"), (uintptr_t)&SDL_HapticRumbleStop);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticRumbleSupported"), (uintptr_t)&SDL_HapticRumbleSupported);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticRunEffect"), (uintptr_t)&SDL_HapticRunEffect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticSetAutocenter"), (uintptr_t)&SDL_HapticSetAutocenter);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticSetGain"), (uintptr_t)&SDL_HapticSetGain);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticStopAll"), (uintptr_t)&SDL_HapticStopAll);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticStopEffect"), (uintptr_t)&SDL_HapticStopEffect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticUnpause"), (uintptr_t)&SDL_HapticUnpause);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticUpdateEffect"), (uintptr_t)&SDL_HapticUpdateEffect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Has3DNow"), (uintptr_t)&SDL_Has3DNow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasAltiVec"), (uintptr_t)&SDL_HasAltiVec);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasClipboardText"), (uintptr_t)&SDL_HasClipboardText);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasEvent"), (uintptr_t)&SDL_HasEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasEvents"), (uintptr_t)&SDL_HasEvents);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasIntersection"), (uintptr_t)&SDL_HasIntersection);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasMMX"), (uintptr_t)&SDL_HasMMX);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasRDTSC"), (uintptr_t)&SDL_HasRDTSC);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasSSE"), (uintptr_t)&SDL_HasSSE);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasSSE2"), (uintptr_t)&SDL_HasSSE2);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasSSE3"), (uintptr_t)&SDL_HasSSE3);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasSSE41"), (uintptr_t)&SDL_HasSSE41);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasSSE42"), (uintptr_t)&SDL_HasSSE42);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasScreenKeyboardSupport"), (uintptr_t)&SDL_HasScreenKeyboardSupport);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HideWindow"), (uintptr_t)&SDL_HideWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Init"), (uintptr_t)&SDL_Init);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_InitFormat"), (uintptr_t)&SDL_InitFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_InitSubSystem"), (uintptr_t)&SDL_InitSubSystem);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_InstallParachute"), (uintptr_t)&SDL_InstallParachute);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IntersectRect"), (uintptr_t)&SDL_IntersectRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IntersectRectAndLine"), (uintptr_t)&SDL_IntersectRectAndLine);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_InvalidateMap"), (uintptr_t)&SDL_InvalidateMap);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IsGameController"), (uintptr_t)&SDL_IsGameController);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IsScreenKeyboardShown"), (uintptr_t)&SDL_IsScreenKeyboardShown);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IsScreenSaverEnabled"), (uintptr_t)&SDL_IsScreenSaverEnabled);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IsShapedWindow"), (uintptr_t)&SDL_IsShapedWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IsTextInputActive"), (uintptr_t)&SDL_IsTextInputActive);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickClose"), (uintptr_t)&SDL_JoystickClose);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickEventState"), (uintptr_t)&SDL_JoystickEventState);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetAttached"), (uintptr_t)&SDL_JoystickGetAttached);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetAxis"), (uintptr_t)&SDL_JoystickGetAxis);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetBall"), (uintptr_t)&SDL_JoystickGetBall);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetButton"), (uintptr_t)&SDL_JoystickGetButton);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetDeviceGUID"), (uintptr_t)&SDL_JoystickGetDeviceGUID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetGUID"), (uintptr_t)&SDL_JoystickGetGUID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetGUIDFromString"), (uintptr_t)&SDL_JoystickGetGUIDFromString);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetGUIDString"), (uintptr_t)&SDL_JoystickGetGUIDString);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetHat"), (uintptr_t)&SDL_JoystickGetHat);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickInit"), (uintptr_t)&SDL_JoystickInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickInstanceID"), (uintptr_t)&SDL_JoystickInstanceID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickIsHaptic"), (uintptr_t)&SDL_JoystickIsHaptic);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickName"), (uintptr_t)&SDL_JoystickName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickNameForIndex"), (uintptr_t)&SDL_JoystickNameForIndex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickNumAxes"), (uintptr_t)&SDL_JoystickNumAxes);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickNumBalls"), (uintptr_t)&SDL_JoystickNumBalls);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickNumButtons"), (uintptr_t)&SDL_JoystickNumButtons);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickNumHats"), (uintptr_t)&SDL_JoystickNumHats);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickOpen"), (uintptr_t)&SDL_JoystickOpen);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickQuit"), (uintptr_t)&SDL_JoystickQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickUpdate"), (uintptr_t)&SDL_JoystickUpdate);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_KeyboardInit"), (uintptr_t)&SDL_KeyboardInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_KeyboardQuit"), (uintptr_t)&SDL_KeyboardQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LoadBMP_RW"), (uintptr_t)&SDL_LoadBMP_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LoadDollarTemplates"), (uintptr_t)&SDL_LoadDollarTemplates);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LoadFunction"), (uintptr_t)&SDL_LoadFunction);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LoadObject"), (uintptr_t)&SDL_LoadObject);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LoadWAV_RW"), (uintptr_t)&SDL_LoadWAV_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LockAudio"), (uintptr_t)&SDL_LockAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LockAudioDevice"), (uintptr_t)&SDL_LockAudioDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LockMutex"), (uintptr_t)&SDL_LockMutex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LockSurface"), (uintptr_t)&SDL_LockSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LockTexture"), (uintptr_t)&SDL_LockTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Log"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogCritical"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogDebug"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogError"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogGetOutputFunction"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogGetPriority"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogInfo"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogMessage"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogMessageV"), (uintptr_t)&ret0); //MessageV);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogResetPriorities"), (uintptr_t)&ret0); //ResetPriorities);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogSetAllPriority"), (uintptr_t)&ret0); //SetAllPriority);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogSetOutputFunction"), (uintptr_t)&ret0); //SetOutputFunction);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogSetPriority"), (uintptr_t)&ret0); //SetPriority);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogVerbose"), (uintptr_t)&ret0); //Verbose);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogWarn"), (uintptr_t)&ret0); //Warn);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LowerBlit"), (uintptr_t)&SDL_LowerBlit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LowerBlitScaled"), (uintptr_t)&SDL_LowerBlitScaled);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MapRGB"), (uintptr_t)&SDL_MapRGB);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MapRGBA"), (uintptr_t)&SDL_MapRGBA);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_MapSurface"), (uintptr_t)&SDL_MapSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MasksToPixelFormatEnum"), (uintptr_t)&SDL_MasksToPixelFormatEnum);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MaximizeWindow"), (uintptr_t)&SDL_MaximizeWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MinimizeWindow"), (uintptr_t)&SDL_MinimizeWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MixAudio"), (uintptr_t)&SDL_MixAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MixAudioFormat"), (uintptr_t)&SDL_MixAudioFormat);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_MouseInit"), (uintptr_t)&SDL_MouseInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MouseIsHaptic"), (uintptr_t)&SDL_MouseIsHaptic);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_MouseQuit"), (uintptr_t)&SDL_MouseQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_NextAudioFormat"), (uintptr_t)&SDL_NextAudioFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_NumHaptics"), (uintptr_t)&SDL_NumHaptics);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_NumJoysticks"), (uintptr_t)&SDL_NumJoysticks);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowFocusGained"), (uintptr_t)&SDL_OnWindowFocusGained);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowFocusLost"), (uintptr_t)&SDL_OnWindowFocusLost);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowHidden"), (uintptr_t)&SDL_OnWindowHidden);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowMinimized"), (uintptr_t)&SDL_OnWindowMinimized);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowResized"), (uintptr_t)&SDL_OnWindowResized);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowRestored"), (uintptr_t)&SDL_OnWindowRestored);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowShown"), (uintptr_t)&SDL_OnWindowShown);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_OpenAudio"), (uintptr_t)&SDL_OpenAudio_fake);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_OpenAudioDevice"), (uintptr_t)&SDL_OpenAudioDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PauseAudio"), (uintptr_t)&SDL_PauseAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PauseAudioDevice"), (uintptr_t)&SDL_PauseAudioDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PeepEvents"), (uintptr_t)&SDL_PeepEvents);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PixelFormatEnumToMasks"), (uintptr_t)&SDL_PixelFormatEnumToMasks);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PollEvent"), (uintptr_t)&SDL_PollEvent);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGameControllerAxis"), (uintptr_t)&SDL_PrivateGameControllerAxis);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGameControllerButton"), (uintptr_t)&SDL_PrivateGameControllerButton);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGameControllerParseButton"), (uintptr_t)&SDL_PrivateGameControllerParseButton);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGameControllerRefreshMapping"), (uintptr_t)&SDL_PrivateGameControllerRefreshMapping);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGetControllerGUIDFromMappingString"), (uintptr_t)&SDL_PrivateGetControllerGUIDFromMappingString);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGetControllerMapping"), (uintptr_t)&SDL_PrivateGetControllerMapping);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGetControllerMappingForGUID"), (uintptr_t)&SDL_PrivateGetControllerMappingForGUID);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGetControllerMappingFromMappingString"), (uintptr_t)&SDL_PrivateGetControllerMappingFromMappingString);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGetControllerNameFromMappingString"), (uintptr_t)&SDL_PrivateGetControllerNameFromMappingString);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickAxis"), (uintptr_t)&SDL_PrivateJoystickAxis);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickBall"), (uintptr_t)&SDL_PrivateJoystickBall);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickButton"), (uintptr_t)&SDL_PrivateJoystickButton);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickHat"), (uintptr_t)&SDL_PrivateJoystickHat);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickNeedsPolling"), (uintptr_t)&SDL_PrivateJoystickNeedsPolling);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickValid"), (uintptr_t)&SDL_PrivateJoystickValid);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateLoadButtonMapping"), (uintptr_t)&SDL_PrivateLoadButtonMapping);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PumpEvents"), (uintptr_t)&SDL_PumpEvents);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PushEvent"), (uintptr_t)&SDL_PushEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_QueryTexture"), (uintptr_t)&SDL_QueryTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Quit"), (uintptr_t)&SDL_Quit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_QuitInit"), (uintptr_t)&SDL_QuitInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_QuitQuit"), (uintptr_t)&SDL_QuitQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_QuitSubSystem"), (uintptr_t)&SDL_QuitSubSystem);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RLEAlphaBlit"), (uintptr_t)&SDL_RLEAlphaBlit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RLEBlit"), (uintptr_t)&SDL_RLEBlit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RLESurface"), (uintptr_t)&SDL_RLESurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RWFromConstMem"), (uintptr_t)&SDL_RWFromConstMem);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RWFromFP"), (uintptr_t)&SDL_RWFromFP);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RWFromFile"), (uintptr_t)&SDL_RWFromFile_hook);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RWFromMem"), (uintptr_t)&SDL_RWFromMem);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RaiseWindow"), (uintptr_t)&SDL_RaiseWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadBE16"), (uintptr_t)&SDL_ReadBE16);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadBE32"), (uintptr_t)&SDL_ReadBE32);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadBE64"), (uintptr_t)&SDL_ReadBE64);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadLE16"), (uintptr_t)&SDL_ReadLE16);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadLE32"), (uintptr_t)&SDL_ReadLE32);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadLE64"), (uintptr_t)&SDL_ReadLE64);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadU8"), (uintptr_t)&SDL_ReadU8);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RecordGesture"), (uintptr_t)&SDL_RecordGesture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RecreateWindow"), (uintptr_t)&SDL_RecreateWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RegisterEvents"), (uintptr_t)&SDL_RegisterEvents);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RegisterHintChangedCb"), (uintptr_t)&SDL_RegisterHintChangedCb);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RemoveTimer"), (uintptr_t)&SDL_RemoveTimer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderClear"), (uintptr_t)&SDL_RenderClear);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderCopy"), (uintptr_t)&SDL_RenderCopy);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderCopyEx"), (uintptr_t)&SDL_RenderCopyEx);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawLine"), (uintptr_t)&SDL_RenderDrawLine);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawLines"), (uintptr_t)&SDL_RenderDrawLines);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawPoint"), (uintptr_t)&SDL_RenderDrawPoint);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawPoints"), (uintptr_t)&SDL_RenderDrawPoints);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawRect"), (uintptr_t)&SDL_RenderDrawRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawRects"), (uintptr_t)&SDL_RenderDrawRects);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderFillRect"), (uintptr_t)&SDL_RenderFillRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderFillRects"), (uintptr_t)&SDL_RenderFillRects);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderGetLogicalSize"), (uintptr_t)&SDL_RenderGetLogicalSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderGetScale"), (uintptr_t)&SDL_RenderGetScale);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderGetViewport"), (uintptr_t)&SDL_RenderGetViewport);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderPresent"), (uintptr_t)&SDL_RenderPresent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderReadPixels"), (uintptr_t)&SDL_RenderReadPixels);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderSetLogicalSize"), (uintptr_t)&SDL_RenderSetLogicalSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderSetScale"), (uintptr_t)&SDL_RenderSetScale);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderSetViewport"), (uintptr_t)&SDL_RenderSetViewport);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderTargetSupported"), (uintptr_t)&SDL_RenderTargetSupported);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ResetAssertionReport"), (uintptr_t)&SDL_ResetAssertionReport);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_ResetKeyboard"), (uintptr_t)&SDL_ResetKeyboard);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_ResetMouse"), (uintptr_t)&SDL_ResetMouse);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RestoreWindow"), (uintptr_t)&SDL_RestoreWindow);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RunAudio"), (uintptr_t)&SDL_RunAudio);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RunThread"), (uintptr_t)&SDL_RunThread);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_CopyYUVToRGB"), (uintptr_t)&SDL_SW_CopyYUVToRGB);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_CreateYUVTexture"), (uintptr_t)&SDL_SW_CreateYUVTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_DestroyYUVTexture"), (uintptr_t)&SDL_SW_DestroyYUVTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_LockYUVTexture"), (uintptr_t)&SDL_SW_LockYUVTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_QueryYUVTexturePixels"), (uintptr_t)&SDL_SW_QueryYUVTexturePixels);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_UnlockYUVTexture"), (uintptr_t)&SDL_SW_UnlockYUVTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_UpdateYUVTexture"), (uintptr_t)&SDL_SW_UpdateYUVTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_CreateThread"), (uintptr_t)&SDL_SYS_CreateThread);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_GetInstanceIdOfDeviceIndex"), (uintptr_t)&SDL_SYS_GetInstanceIdOfDeviceIndex);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticClose"), (uintptr_t)&SDL_SYS_HapticClose);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticDestroyEffect"), (uintptr_t)&SDL_SYS_HapticDestroyEffect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticGetEffectStatus"), (uintptr_t)&SDL_SYS_HapticGetEffectStatus);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticInit"), (uintptr_t)&SDL_SYS_HapticInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticMouse"), (uintptr_t)&SDL_SYS_HapticMouse);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticName"), (uintptr_t)&SDL_SYS_HapticName);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticNewEffect"), (uintptr_t)&SDL_SYS_HapticNewEffect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticOpen"), (uintptr_t)&SDL_SYS_HapticOpen);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticOpenFromJoystick"), (uintptr_t)&SDL_SYS_HapticOpenFromJoystick);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticPause"), (uintptr_t)&SDL_SYS_HapticPause);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticQuit"), (uintptr_t)&SDL_SYS_HapticQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticRunEffect"), (uintptr_t)&SDL_SYS_HapticRunEffect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticSetAutocenter"), (uintptr_t)&SDL_SYS_HapticSetAutocenter);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticSetGain"), (uintptr_t)&SDL_SYS_HapticSetGain);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticStopAll"), (uintptr_t)&SDL_SYS_HapticStopAll);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticStopEffect"), (uintptr_t)&SDL_SYS_HapticStopEffect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticUnpause"), (uintptr_t)&SDL_SYS_HapticUnpause);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticUpdateEffect"), (uintptr_t)&SDL_SYS_HapticUpdateEffect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickAttached"), (uintptr_t)&SDL_SYS_JoystickAttached);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickClose"), (uintptr_t)&SDL_SYS_JoystickClose);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickDetect"), (uintptr_t)&SDL_SYS_JoystickDetect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickGetDeviceGUID"), (uintptr_t)&SDL_SYS_JoystickGetDeviceGUID);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickGetGUID"), (uintptr_t)&SDL_SYS_JoystickGetGUID);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickInit"), (uintptr_t)&SDL_SYS_JoystickInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickIsHaptic"), (uintptr_t)&SDL_SYS_JoystickIsHaptic);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickNameForDeviceIndex"), (uintptr_t)&SDL_SYS_JoystickNameForDeviceIndex);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickNeedsPolling"), (uintptr_t)&SDL_SYS_JoystickNeedsPolling);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickOpen"), (uintptr_t)&SDL_SYS_JoystickOpen);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickQuit"), (uintptr_t)&SDL_SYS_JoystickQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickSameHaptic"), (uintptr_t)&SDL_SYS_JoystickSameHaptic);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickUpdate"), (uintptr_t)&SDL_SYS_JoystickUpdate);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_NumJoysticks"), (uintptr_t)&SDL_SYS_NumJoysticks);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_SetThreadPriority"), (uintptr_t)&SDL_SYS_SetThreadPriority);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_SetupThread"), (uintptr_t)&SDL_SYS_SetupThread);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_WaitThread"), (uintptr_t)&SDL_SYS_WaitThread);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SaveAllDollarTemplates"), (uintptr_t)&SDL_SaveAllDollarTemplates);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SaveBMP_RW"), (uintptr_t)&SDL_SaveBMP_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SaveDollarTemplate"), (uintptr_t)&SDL_SaveDollarTemplate);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SemPost"), (uintptr_t)&SDL_SemPost);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SemTryWait"), (uintptr_t)&SDL_SemTryWait);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SemValue"), (uintptr_t)&SDL_SemValue);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SemWait"), (uintptr_t)&SDL_SemWait);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SemWaitTimeout"), (uintptr_t)&SDL_SemWaitTimeout);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendClipboardUpdate"), (uintptr_t)&SDL_SendClipboardUpdate);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendDropFile"), (uintptr_t)&SDL_SendDropFile);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendEditingText"), (uintptr_t)&SDL_SendEditingText);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendGestureMulti"), (uintptr_t)&SDL_SendGestureMulti);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendKeyboardKey"), (uintptr_t)&SDL_SendKeyboardKey);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendKeyboardText"), (uintptr_t)&SDL_SendKeyboardText);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendMouseButton"), (uintptr_t)&SDL_SendMouseButton);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendMouseMotion"), (uintptr_t)&SDL_SendMouseMotion);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendMouseWheel"), (uintptr_t)&SDL_SendMouseWheel);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendQuit"), (uintptr_t)&SDL_SendQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendSysWMEvent"), (uintptr_t)&SDL_SendSysWMEvent);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendTouch"), (uintptr_t)&SDL_SendTouch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendTouchMotion"), (uintptr_t)&SDL_SendTouchMotion);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendWindowEvent"), (uintptr_t)&SDL_SendWindowEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetAssertionHandler"), (uintptr_t)&SDL_SetAssertionHandler);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetClipRect"), (uintptr_t)&SDL_SetClipRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetClipboardText"), (uintptr_t)&SDL_SetClipboardText);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetColorKey"), (uintptr_t)&SDL_SetColorKey);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetCursor"), (uintptr_t)&SDL_SetCursor);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetDefaultCursor"), (uintptr_t)&SDL_SetDefaultCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetError"), (uintptr_t)&SDL_SetError);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetEventFilter"), (uintptr_t)&SDL_SetEventFilter);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetHint"), (uintptr_t)&SDL_SetHint);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetHintWithPriority"), (uintptr_t)&SDL_SetHintWithPriority);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetKeyboardFocus"), (uintptr_t)&SDL_SetKeyboardFocus);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetKeymap"), (uintptr_t)&SDL_SetKeymap);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetModState"), (uintptr_t)&SDL_SetModState);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetMouseFocus"), (uintptr_t)&SDL_SetMouseFocus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetPaletteColors"), (uintptr_t)&SDL_SetPaletteColors);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetPixelFormatPalette"), (uintptr_t)&SDL_SetPixelFormatPalette);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetRelativeMouseMode"), (uintptr_t)&SDL_SetRelativeMouseMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetRenderDrawBlendMode"), (uintptr_t)&SDL_SetRenderDrawBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetRenderDrawColor"), (uintptr_t)&SDL_SetRenderDrawColor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetRenderTarget"), (uintptr_t)&SDL_SetRenderTarget);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetScancodeName"), (uintptr_t)&SDL_SetScancodeName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetSurfaceAlphaMod"), (uintptr_t)&SDL_SetSurfaceAlphaMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetSurfaceBlendMode"), (uintptr_t)&SDL_SetSurfaceBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetSurfaceColorMod"), (uintptr_t)&SDL_SetSurfaceColorMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetSurfacePalette"), (uintptr_t)&SDL_SetSurfacePalette);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetSurfaceRLE"), (uintptr_t)&SDL_SetSurfaceRLE);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetTextInputRect"), (uintptr_t)&SDL_SetTextInputRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetTextureAlphaMod"), (uintptr_t)&SDL_SetTextureAlphaMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetTextureBlendMode"), (uintptr_t)&SDL_SetTextureBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetTextureColorMod"), (uintptr_t)&SDL_SetTextureColorMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetThreadPriority"), (uintptr_t)&SDL_SetThreadPriority);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowBordered"), (uintptr_t)&SDL_SetWindowBordered);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowBrightness"), (uintptr_t)&SDL_SetWindowBrightness);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowData"), (uintptr_t)&SDL_SetWindowData);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowDisplayMode"), (uintptr_t)&SDL_SetWindowDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowFullscreen"), (uintptr_t)&SDL_SetWindowFullscreen);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowGammaRamp"), (uintptr_t)&SDL_SetWindowGammaRamp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowGrab"), (uintptr_t)&SDL_SetWindowGrab);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowIcon"), (uintptr_t)&SDL_SetWindowIcon);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowMaximumSize"), (uintptr_t)&SDL_SetWindowMaximumSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowMinimumSize"), (uintptr_t)&SDL_SetWindowMinimumSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowPosition"), (uintptr_t)&SDL_SetWindowPosition);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowShape"), (uintptr_t)&SDL_SetWindowShape);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowSize"), (uintptr_t)&SDL_SetWindowSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowTitle"), (uintptr_t)&SDL_SetWindowTitle);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShouldAllowTopmost"), (uintptr_t)&SDL_ShouldAllowTopmost);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShowCursor"), (uintptr_t)&SDL_ShowCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShowMessageBox"), (uintptr_t)&SDL_ShowMessageBox);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShowProgressHUD"), (uintptr_t)&SDL_ShowProgressHUD);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShowSimpleMessageBox"), (uintptr_t)&SDL_ShowSimpleMessageBox);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShowWindow"), (uintptr_t)&SDL_ShowWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SoftStretch"), (uintptr_t)&SDL_SoftStretch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_StartEventLoop"), (uintptr_t)&SDL_StartEventLoop);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_StartTextInput"), (uintptr_t)&SDL_StartTextInput);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_StartTicks"), (uintptr_t)&SDL_StartTicks);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_StopEventLoop"), (uintptr_t)&SDL_StopEventLoop);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_StopTextInput"), (uintptr_t)&SDL_StopTextInput);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ThreadID"), (uintptr_t)&SDL_ThreadID);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_TimerInit"), (uintptr_t)&SDL_TimerInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_TimerQuit"), (uintptr_t)&SDL_TimerQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_TouchInit"), (uintptr_t)&SDL_TouchInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_TouchQuit"), (uintptr_t)&SDL_TouchQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_TraverseShapeTree"), (uintptr_t)&SDL_TraverseShapeTree);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_TryLockMutex"), (uintptr_t)&SDL_TryLockMutex);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnRLESurface"), (uintptr_t)&SDL_UnRLESurface);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_UninstallParachute"), (uintptr_t)&SDL_UninstallParachute);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnionRect"), (uintptr_t)&SDL_UnionRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnloadObject"), (uintptr_t)&SDL_UnloadObject);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnlockAudio"), (uintptr_t)&SDL_UnlockAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnlockAudioDevice"), (uintptr_t)&SDL_UnlockAudioDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnlockMutex"), (uintptr_t)&SDL_UnlockMutex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnlockSurface"), (uintptr_t)&SDL_UnlockSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnlockTexture"), (uintptr_t)&SDL_UnlockTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpdateTexture"), (uintptr_t)&SDL_UpdateTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpdateWindowGrab"), (uintptr_t)&SDL_UpdateWindowGrab);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpdateWindowSurface"), (uintptr_t)&SDL_UpdateWindowSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpdateWindowSurfaceRects"), (uintptr_t)&SDL_UpdateWindowSurfaceRects);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpperBlit"), (uintptr_t)&SDL_UpperBlit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpperBlitScaled"), (uintptr_t)&SDL_UpperBlitScaled);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_Vibrate"), (uintptr_t)&SDL_Vibrate);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_VideoInit"), (uintptr_t)&SDL_VideoInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_VideoQuit"), (uintptr_t)&SDL_VideoQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WaitEvent"), (uintptr_t)&SDL_WaitEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WaitEventTimeout"), (uintptr_t)&SDL_WaitEventTimeout);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WaitThread"), (uintptr_t)&SDL_WaitThread);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WarpMouseInWindow"), (uintptr_t)&SDL_WarpMouseInWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WasInit"), (uintptr_t)&SDL_WasInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteBE16"), (uintptr_t)&SDL_WriteBE16);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteBE32"), (uintptr_t)&SDL_WriteBE32);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteBE64"), (uintptr_t)&SDL_WriteBE64);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteLE16"), (uintptr_t)&SDL_WriteLE16);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteLE32"), (uintptr_t)&SDL_WriteLE32);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteLE64"), (uintptr_t)&SDL_WriteLE64);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteU8"), (uintptr_t)&SDL_WriteU8);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_abs"), (uintptr_t)&SDL_abs);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_atof"), (uintptr_t)&SDL_atof);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_atoi"), (uintptr_t)&SDL_atoi);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_calloc"), (uintptr_t)&SDL_calloc);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ceil"), (uintptr_t)&SDL_ceil);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_cosf"), (uintptr_t)&SDL_cosf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_free"), (uintptr_t)&SDL_free);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_getenv"), (uintptr_t)&SDL_getenv);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_iconv"), (uintptr_t)&SDL_iconv);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_iconv_close"), (uintptr_t)&SDL_iconv_close);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_iconv_open"), (uintptr_t)&SDL_iconv_open);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_iconv_string"), (uintptr_t)&SDL_iconv_string);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_isdigit"), (uintptr_t)&SDL_isdigit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_isspace"), (uintptr_t)&SDL_isspace);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_itoa"), (uintptr_t)&SDL_itoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_lltoa"), (uintptr_t)&SDL_lltoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ltoa"), (uintptr_t)&SDL_ltoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_malloc"), (uintptr_t)&SDL_malloc);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_memcmp"), (uintptr_t)&SDL_memcmp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_memcpy"), (uintptr_t)&SDL_memcpy);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_memmove"), (uintptr_t)&SDL_memmove);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_memset"), (uintptr_t)&SDL_memset);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_qsort"), (uintptr_t)&SDL_qsort);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_realloc"), (uintptr_t)&SDL_realloc);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_setenv"), (uintptr_t)&SDL_setenv);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_sinf"), (uintptr_t)&SDL_sinf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_snprintf"), (uintptr_t)&SDL_snprintf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_sscanf"), (uintptr_t)&SDL_sscanf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strcasecmp"), (uintptr_t)&SDL_strcasecmp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strchr"), (uintptr_t)&SDL_strchr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strcmp"), (uintptr_t)&SDL_strcmp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strdup"), (uintptr_t)&SDL_strdup);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strlcat"), (uintptr_t)&SDL_strlcat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strlcpy"), (uintptr_t)&SDL_strlcpy);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strlen"), (uintptr_t)&SDL_strlen);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strlwr"), (uintptr_t)&SDL_strlwr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strncasecmp"), (uintptr_t)&SDL_strncasecmp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strncmp"), (uintptr_t)&SDL_strncmp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strrchr"), (uintptr_t)&SDL_strrchr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strrev"), (uintptr_t)&SDL_strrev);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strstr"), (uintptr_t)&SDL_strstr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strtod"), (uintptr_t)&SDL_strtod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strtol"), (uintptr_t)&SDL_strtol);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strtoll"), (uintptr_t)&SDL_strtoll);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strtoul"), (uintptr_t)&SDL_strtoul);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strtoull"), (uintptr_t)&SDL_strtoull);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strupr"), (uintptr_t)&SDL_strupr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_tolower"), (uintptr_t)&SDL_tolower);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_toupper"), (uintptr_t)&SDL_toupper);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_uitoa"), (uintptr_t)&SDL_uitoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ulltoa"), (uintptr_t)&SDL_ulltoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ultoa"), (uintptr_t)&SDL_ultoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_utf8strlcpy"), (uintptr_t)&SDL_utf8strlcpy);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_vsnprintf"), (uintptr_t)&SDL_vsnprintf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_wcslcat"), (uintptr_t)&SDL_wcslcat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_wcslcpy"), (uintptr_t)&SDL_wcslcpy);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_wcslen"), (uintptr_t)&SDL_wcslen);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddBasicVideoDisplay_REAL"), (uintptr_t)&SDL_AddBasicVideoDisplay);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddDisplayMode_REAL"), (uintptr_t)&SDL_AddDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddEventWatch_REAL"), (uintptr_t)&SDL_AddEventWatch);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddTimer_REAL"), (uintptr_t)&SDL_AddTimer);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddTouch_REAL"), (uintptr_t)&SDL_AddTouch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AddVideoDisplay_REAL"), (uintptr_t)&SDL_AddVideoDisplay);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AllocBlitMap_REAL"), (uintptr_t)&SDL_AllocBlitMap);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AllocFormat_REAL"), (uintptr_t)&SDL_AllocFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AllocPalette_REAL"), (uintptr_t)&SDL_AllocPalette);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AllocRW_REAL"), (uintptr_t)&SDL_AllocRW);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetActivity_REAL"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetExternalCachePath_REAL"), (uintptr_t)&SDL_AndroidGetExternalStoragePath);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetExternalStoragePath_REAL"), (uintptr_t)&SDL_AndroidGetExternalStoragePath);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetExternalStorageState_REAL"), (uintptr_t)&ret0);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetInternalStoragePath_REAL"), (uintptr_t)&SDL_AndroidGetInternalStoragePath);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AndroidGetJNIEnv_REAL"), (uintptr_t)&Android_JNI_GetEnv);
-	hook_addr(so_symbol(&thimbleweed_mod, "Android_JNI_GetEnv_REAL"), (uintptr_t)&Android_JNI_GetEnv);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Android_Init_REAL"), (uintptr_t)&ret0);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AssertionsInit_REAL"), (uintptr_t)&SDL_AssertionsInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_AssertionsQuit_REAL"), (uintptr_t)&SDL_AssertionsQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AtomicCAS_REAL"), (uintptr_t)&SDL_AtomicCAS);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AtomicCASPtr_REAL"), (uintptr_t)&SDL_AtomicCASPtr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AtomicLock_REAL"), (uintptr_t)&SDL_AtomicLock);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AtomicTryLock_REAL"), (uintptr_t)&SDL_AtomicTryLock);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AtomicUnlock_REAL"), (uintptr_t)&SDL_AtomicUnlock);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AudioInit_REAL"), (uintptr_t)&SDL_AudioInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_AudioQuit_REAL"), (uintptr_t)&SDL_AudioQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendFillRect_REAL"), (uintptr_t)&SDL_BlendFillRect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendFillRects_REAL"), (uintptr_t)&SDL_BlendFillRects);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendLine_REAL"), (uintptr_t)&SDL_BlendLine);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendLines_REAL"), (uintptr_t)&SDL_BlendLines);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendPoint_REAL"), (uintptr_t)&SDL_BlendPoint);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlendPoints_REAL"), (uintptr_t)&SDL_BlendPoints);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_BlitCopy_REAL"), (uintptr_t)&SDL_BlitCopy);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_Blit_Slow_REAL"), (uintptr_t)&SDL_Blit_Slow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_BuildAudioCVT_REAL"), (uintptr_t)&SDL_BuildAudioCVT);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateAudioSpec_REAL"), (uintptr_t)&SDL_CalculateAudioSpec);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateBlit_REAL"), (uintptr_t)&SDL_CalculateBlit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateBlit0_REAL"), (uintptr_t)&SDL_CalculateBlit0);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateBlit1_REAL"), (uintptr_t)&SDL_CalculateBlit1);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateBlitA_REAL"), (uintptr_t)&SDL_CalculateBlitA);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateBlitN_REAL"), (uintptr_t)&SDL_CalculateBlitN);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateGammaRamp_REAL"), (uintptr_t)&SDL_CalculateGammaRamp);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculatePitch_REAL"), (uintptr_t)&SDL_CalculatePitch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateShapeBitmap_REAL"), (uintptr_t)&SDL_CalculateShapeBitmap);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_CalculateShapeTree_REAL"), (uintptr_t)&SDL_CalculateShapeTree);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ClearError_REAL"), (uintptr_t)&SDL_ClearError);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ClearHints_REAL"), (uintptr_t)&SDL_ClearHints);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CloseAudio_REAL"), (uintptr_t)&SDL_CloseAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CloseAudioDevice_REAL"), (uintptr_t)&SDL_CloseAudioDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CondBroadcast_REAL"), (uintptr_t)&SDL_CondBroadcast);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CondSignal_REAL"), (uintptr_t)&SDL_CondSignal);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CondWait_REAL"), (uintptr_t)&SDL_CondWait);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CondWaitTimeout_REAL"), (uintptr_t)&SDL_CondWaitTimeout);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ConvertAudio_REAL"), (uintptr_t)&SDL_ConvertAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ConvertPixels_REAL"), (uintptr_t)&SDL_ConvertPixels);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ConvertSurface_REAL"), (uintptr_t)&SDL_ConvertSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ConvertSurfaceFormat_REAL"), (uintptr_t)&SDL_ConvertSurfaceFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateColorCursor_REAL"), (uintptr_t)&SDL_CreateColorCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateCond_REAL"), (uintptr_t)&SDL_CreateCond);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateCursor_REAL"), (uintptr_t)&SDL_CreateCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateMutex_REAL"), (uintptr_t)&SDL_CreateMutex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateRGBSurface_REAL"), (uintptr_t)&SDL_CreateRGBSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateRGBSurfaceFrom_REAL"), (uintptr_t)&SDL_CreateRGBSurfaceFrom);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateRenderer_REAL"), (uintptr_t)&SDL_CreateRenderer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateSemaphore_REAL"), (uintptr_t)&SDL_CreateSemaphore);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateShapedWindow_REAL"), (uintptr_t)&SDL_CreateShapedWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateSoftwareRenderer_REAL"), (uintptr_t)&SDL_CreateSoftwareRenderer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateSystemCursor_REAL"), (uintptr_t)&SDL_CreateSystemCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateTexture_REAL"), (uintptr_t)&SDL_CreateTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateTextureFromSurface_REAL"), (uintptr_t)&SDL_CreateTextureFromSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateThread_REAL"), (uintptr_t)&SDL_CreateThread);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateWindow_REAL"), (uintptr_t)&SDL_CreateWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateWindowAndRenderer_REAL"), (uintptr_t)&SDL_CreateWindowAndRenderer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_CreateWindowFrom_REAL"), (uintptr_t)&SDL_CreateWindowFrom);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DelEventWatch_REAL"), (uintptr_t)&SDL_DelEventWatch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DelFinger_REAL"), (uintptr_t)&SDL_DelFinger);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DelTouch_REAL"), (uintptr_t)&SDL_DelTouch);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Delay_REAL"), (uintptr_t)&SDL_Delay);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroyCond_REAL"), (uintptr_t)&SDL_DestroyCond);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroyMutex_REAL"), (uintptr_t)&SDL_DestroyMutex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroyRenderer_REAL"), (uintptr_t)&SDL_DestroyRenderer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroySemaphore_REAL"), (uintptr_t)&SDL_DestroySemaphore);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroyTexture_REAL"), (uintptr_t)&SDL_DestroyTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DestroyWindow_REAL"), (uintptr_t)&SDL_DestroyWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_DisableScreenSaver_REAL"), (uintptr_t)&SDL_DisableScreenSaver);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DitherColors_REAL"), (uintptr_t)&SDL_DitherColors);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DrawLine_REAL"), (uintptr_t)&SDL_DrawLine);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DrawLines_REAL"), (uintptr_t)&SDL_DrawLines);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DrawPoint_REAL"), (uintptr_t)&SDL_DrawPoint);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_DrawPoints_REAL"), (uintptr_t)&SDL_DrawPoints);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_EnableScreenSaver_REAL"), (uintptr_t)&SDL_EnableScreenSaver);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_EnclosePoints_REAL"), (uintptr_t)&SDL_EnclosePoints);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Error_REAL"), (uintptr_t)&SDL_Error);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_EventState_REAL"), (uintptr_t)&SDL_EventState);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FillRect_REAL"), (uintptr_t)&SDL_FillRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FillRects_REAL"), (uintptr_t)&SDL_FillRects);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FilterEvents_REAL"), (uintptr_t)&SDL_FilterEvents);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_FindColor_REAL"), (uintptr_t)&SDL_FindColor);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_FirstAudioFormat_REAL"), (uintptr_t)&SDL_FirstAudioFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FlushEvent_REAL"), (uintptr_t)&SDL_FlushEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FlushEvents_REAL"), (uintptr_t)&SDL_FlushEvents);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeBlitMap_REAL"), (uintptr_t)&SDL_FreeBlitMap);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeCursor_REAL"), (uintptr_t)&SDL_FreeCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeFormat_REAL"), (uintptr_t)&SDL_FreeFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreePalette_REAL"), (uintptr_t)&SDL_FreePalette);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeRW_REAL"), (uintptr_t)&SDL_FreeRW);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeShapeTree_REAL"), (uintptr_t)&SDL_FreeShapeTree);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeSurface_REAL"), (uintptr_t)&SDL_FreeSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_FreeWAV_REAL"), (uintptr_t)&SDL_FreeWAV);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_BindTexture_REAL"), (uintptr_t)&SDL_GL_BindTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_CreateContext_REAL"), (uintptr_t)&SDL_GL_CreateContext);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_DeleteContext_REAL"), (uintptr_t)&SDL_GL_DeleteContext);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_ExtensionSupported_REAL"), (uintptr_t)&SDL_GL_ExtensionSupported);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_GetAttribute_REAL"), (uintptr_t)&SDL_GL_GetAttribute);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_GetProcAddress_REAL"), (uintptr_t)&SDL_GL_GetProcAddress);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_GetSwapInterval_REAL"), (uintptr_t)&SDL_GL_GetSwapInterval);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_LoadLibrary_REAL"), (uintptr_t)&SDL_GL_LoadLibrary);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_MakeCurrent_REAL"), (uintptr_t)&SDL_GL_MakeCurrent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_SetAttribute_REAL"), (uintptr_t)&SDL_GL_SetAttribute);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_SetSwapInterval_REAL"), (uintptr_t)&SDL_GL_SetSwapInterval);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_SwapWindow_REAL"), (uintptr_t)&SDL_GL_SwapWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_UnbindTexture_REAL"), (uintptr_t)&SDL_GL_UnbindTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GL_UnloadLibrary_REAL"), (uintptr_t)&SDL_GL_UnloadLibrary);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerAddMapping_REAL"), (uintptr_t)&SDL_GameControllerAddMapping);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerClose_REAL"), (uintptr_t)&SDL_GameControllerClose);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerEventState_REAL"), (uintptr_t)&SDL_GameControllerEventState);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerEventWatcher_REAL"), (uintptr_t)&SDL_GameControllerEventWatcher);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetAttached_REAL"), (uintptr_t)&SDL_GameControllerGetAttached);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetAxis_REAL"), (uintptr_t)&SDL_GameControllerGetAxis);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetAxisFromString_REAL"), (uintptr_t)&SDL_GameControllerGetAxisFromString);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetBindForAxis_REAL"), (uintptr_t)&SDL_GameControllerGetBindForAxis);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetBindForButton_REAL"), (uintptr_t)&SDL_GameControllerGetBindForButton);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetButton_REAL"), (uintptr_t)&SDL_GameControllerGetButton);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetButtonFromString_REAL"), (uintptr_t)&SDL_GameControllerGetButtonFromString);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetJoystick_REAL"), (uintptr_t)&SDL_GameControllerGetJoystick);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetStringForAxis_REAL"), (uintptr_t)&SDL_GameControllerGetStringForAxis);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerGetStringForButton_REAL"), (uintptr_t)&SDL_GameControllerGetStringForButton);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerInit_REAL"), (uintptr_t)&SDL_GameControllerInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerMapping_REAL"), (uintptr_t)&SDL_GameControllerMapping);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerMappingForGUID_REAL"), (uintptr_t)&SDL_GameControllerMappingForGUID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerName_REAL"), (uintptr_t)&SDL_GameControllerName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerNameForIndex_REAL"), (uintptr_t)&SDL_GameControllerNameForIndex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerOpen_REAL"), (uintptr_t)&SDL_GameControllerOpen);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerQuit_REAL"), (uintptr_t)&SDL_GameControllerQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GameControllerUpdate_REAL"), (uintptr_t)&SDL_GameControllerUpdate);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GestureAddTouch_REAL"), (uintptr_t)&SDL_GestureAddTouch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GestureProcessEvent_REAL"), (uintptr_t)&SDL_GestureProcessEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetAssertionReport_REAL"), (uintptr_t)&SDL_GetAssertionReport);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetAudioDeviceName_REAL"), (uintptr_t)&SDL_GetAudioDeviceName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetAudioDeviceStatus_REAL"), (uintptr_t)&SDL_GetAudioDeviceStatus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetAudioDriver_REAL"), (uintptr_t)&SDL_GetAudioDriver);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetAudioStatus_REAL"), (uintptr_t)&SDL_GetAudioStatus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCPUCacheLineSize_REAL"), (uintptr_t)&SDL_GetCPUCacheLineSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCPUCount_REAL"), (uintptr_t)&SDL_GetCPUCount);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetClipRect_REAL"), (uintptr_t)&SDL_GetClipRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetClipboardText_REAL"), (uintptr_t)&SDL_GetClipboardText);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetClosestDisplayMode_REAL"), (uintptr_t)&SDL_GetClosestDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetColorKey_REAL"), (uintptr_t)&SDL_GetColorKey);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCurrentAudioDriver_REAL"), (uintptr_t)&SDL_GetCurrentAudioDriver);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCurrentDisplayMode_REAL"), (uintptr_t)&SDL_GetCurrentDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCurrentVideoDriver_REAL"), (uintptr_t)&SDL_GetCurrentVideoDriver);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetCursor_REAL"), (uintptr_t)&SDL_GetCursor);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDefaultKeymap_REAL"), (uintptr_t)&SDL_GetDefaultKeymap);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDesktopDisplayMode_REAL"), (uintptr_t)&SDL_GetDesktopDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDisplayBounds_REAL"), (uintptr_t)&SDL_GetDisplayBounds);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDisplayForWindow_REAL"), (uintptr_t)&SDL_GetDisplayForWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDisplayMode_REAL"), (uintptr_t)&SDL_GetDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetDisplayName_REAL"), (uintptr_t)&SDL_GetDisplayName);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetErrBuf_REAL"), (uintptr_t)&SDL_GetErrBuf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetError_REAL"), (uintptr_t)&SDL_GetError);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetEventFilter_REAL"), (uintptr_t)&SDL_GetEventFilter);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetFinger_REAL"), (uintptr_t)&SDL_GetFinger);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetFocusWindow_REAL"), (uintptr_t)&SDL_GetFocusWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetHint_REAL"), (uintptr_t)&SDL_GetHint);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetKeyFromName_REAL"), (uintptr_t)&SDL_GetKeyFromName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetKeyFromScancode_REAL"), (uintptr_t)&SDL_GetKeyFromScancode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetKeyName_REAL"), (uintptr_t)&SDL_GetKeyName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetKeyboardFocus_REAL"), (uintptr_t)&SDL_GetKeyboardFocus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetKeyboardState_REAL"), (uintptr_t)&SDL_GetKeyboardState);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetModState_REAL"), (uintptr_t)&SDL_GetModState);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetMouse_REAL"), (uintptr_t)&SDL_GetMouse);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetMouseFocus_REAL"), (uintptr_t)&SDL_GetMouseFocus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetMouseState_REAL"), (uintptr_t)&SDL_GetMouseState);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumAudioDevices_REAL"), (uintptr_t)&SDL_GetNumAudioDevices);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumAudioDrivers_REAL"), (uintptr_t)&SDL_GetNumAudioDrivers);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumDisplayModes_REAL"), (uintptr_t)&SDL_GetNumDisplayModes);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumRenderDrivers_REAL"), (uintptr_t)&SDL_GetNumRenderDrivers);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumTouchDevices_REAL"), (uintptr_t)&SDL_GetNumTouchDevices);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumTouchFingers_REAL"), (uintptr_t)&SDL_GetNumTouchFingers);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumVideoDisplays_REAL"), (uintptr_t)&SDL_GetNumVideoDisplays);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetNumVideoDrivers_REAL"), (uintptr_t)&SDL_GetNumVideoDrivers);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPerformanceCounter_REAL"), (uintptr_t)&SDL_GetPerformanceCounter);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPerformanceFrequency_REAL"), (uintptr_t)&SDL_GetPerformanceFrequency);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPixelFormatName_REAL"), (uintptr_t)&SDL_GetPixelFormatName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPlatform_REAL"), (uintptr_t)&SDL_GetPlatform);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPowerInfo_REAL"), (uintptr_t)&SDL_GetPowerInfo);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetPowerInfo_Android_REAL"), (uintptr_t)&SDL_GetPowerInfo_Android);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRGB_REAL"), (uintptr_t)&SDL_GetRGB);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRGBA_REAL"), (uintptr_t)&SDL_GetRGBA);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRelativeMouseMode_REAL"), (uintptr_t)&SDL_GetRelativeMouseMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRelativeMouseState_REAL"), (uintptr_t)&SDL_GetRelativeMouseState);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRenderDrawBlendMode_REAL"), (uintptr_t)&SDL_GetRenderDrawBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRenderDrawColor_REAL"), (uintptr_t)&SDL_GetRenderDrawColor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRenderDriverInfo_REAL"), (uintptr_t)&SDL_GetRenderDriverInfo);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRenderTarget_REAL"), (uintptr_t)&SDL_GetRenderTarget);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRenderer_REAL"), (uintptr_t)&SDL_GetRenderer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRendererInfo_REAL"), (uintptr_t)&SDL_GetRendererInfo);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRevision_REAL"), (uintptr_t)&SDL_GetRevision);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetRevisionNumber_REAL"), (uintptr_t)&SDL_GetRevisionNumber);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetScancodeFromKey_REAL"), (uintptr_t)&SDL_GetScancodeFromKey);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetScancodeFromName_REAL"), (uintptr_t)&SDL_GetScancodeFromName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetScancodeName_REAL"), (uintptr_t)&SDL_GetScancodeName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetShapedWindowMode_REAL"), (uintptr_t)&SDL_GetShapedWindowMode);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetSpanEnclosingRect_REAL"), (uintptr_t)&SDL_GetSpanEnclosingRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetSurfaceAlphaMod_REAL"), (uintptr_t)&SDL_GetSurfaceAlphaMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetSurfaceBlendMode_REAL"), (uintptr_t)&SDL_GetSurfaceBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetSurfaceColorMod_REAL"), (uintptr_t)&SDL_GetSurfaceColorMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTextureAlphaMod_REAL"), (uintptr_t)&SDL_GetTextureAlphaMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTextureBlendMode_REAL"), (uintptr_t)&SDL_GetTextureBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTextureColorMod_REAL"), (uintptr_t)&SDL_GetTextureColorMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetThreadID_REAL"), (uintptr_t)&SDL_GetThreadID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetThreadName_REAL"), (uintptr_t)&SDL_GetThreadName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTicks_REAL"), (uintptr_t)&SDL_GetTicks);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTouch_REAL"), (uintptr_t)&SDL_GetTouch);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTouchDevice_REAL"), (uintptr_t)&SDL_GetTouchDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetTouchFinger_REAL"), (uintptr_t)&SDL_GetTouchFinger);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetVersion_REAL"), (uintptr_t)&SDL_GetVersion);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetVideoDevice_REAL"), (uintptr_t)&SDL_GetVideoDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetVideoDriver_REAL"), (uintptr_t)&SDL_GetVideoDriver);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowBrightness_REAL"), (uintptr_t)&SDL_GetWindowBrightness);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowData_REAL"), (uintptr_t)&SDL_GetWindowData);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowDisplayIndex_REAL"), (uintptr_t)&SDL_GetWindowDisplayIndex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowDisplayMode_REAL"), (uintptr_t)&SDL_GetWindowDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowFlags_REAL"), (uintptr_t)&SDL_GetWindowFlags);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowFromID_REAL"), (uintptr_t)&SDL_GetWindowFromID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowGammaRamp_REAL"), (uintptr_t)&SDL_GetWindowGammaRamp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowGrab_REAL"), (uintptr_t)&SDL_GetWindowGrab);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowID_REAL"), (uintptr_t)&SDL_GetWindowID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowMaximumSize_REAL"), (uintptr_t)&SDL_GetWindowMaximumSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowMinimumSize_REAL"), (uintptr_t)&SDL_GetWindowMinimumSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowPixelFormat_REAL"), (uintptr_t)&SDL_GetWindowPixelFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowPosition_REAL"), (uintptr_t)&SDL_GetWindowPosition);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowSize_REAL"), (uintptr_t)&SDL_GetWindowSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowSurface_REAL"), (uintptr_t)&SDL_GetWindowSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowTitle_REAL"), (uintptr_t)&SDL_GetWindowTitle);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_GetWindowWMInfo_REAL"), (uintptr_t)&SDL_GetWindowWMInfo);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticClose_REAL"), (uintptr_t)&SDL_HapticClose);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticDestroyEffect_REAL"), (uintptr_t)&SDL_HapticDestroyEffect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticEffectSupported_REAL"), (uintptr_t)&SDL_HapticEffectSupported);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticGetEffectStatus_REAL"), (uintptr_t)&SDL_HapticGetEffectStatus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticIndex_REAL"), (uintptr_t)&SDL_HapticIndex);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticInit_REAL"), (uintptr_t)&SDL_HapticInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticName_REAL"), (uintptr_t)&SDL_HapticName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticNewEffect_REAL"), (uintptr_t)&SDL_HapticNewEffect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticNumAxes_REAL"), (uintptr_t)&SDL_HapticNumAxes);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticNumEffects_REAL"), (uintptr_t)&SDL_HapticNumEffects);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticNumEffectsPlaying_REAL"), (uintptr_t)&SDL_HapticNumEffectsPlaying);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticOpen_REAL"), (uintptr_t)&SDL_HapticOpen);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticOpenFromJoystick_REAL"), (uintptr_t)&SDL_HapticOpenFromJoystick);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticOpenFromMouse_REAL"), (uintptr_t)&SDL_HapticOpenFromMouse);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticOpened_REAL"), (uintptr_t)&SDL_HapticOpened);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticPause_REAL"), (uintptr_t)&SDL_HapticPause);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticQuery_REAL"), (uintptr_t)&SDL_HapticQuery);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticQuit_REAL"), (uintptr_t)&SDL_HapticQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticRumbleInit_REAL"), (uintptr_t)&SDL_HapticRumbleInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticRumblePlay_REAL"), (uintptr_t)&SDL_HapticRumblePlay);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticRumbleStop_REAL"), (uintptr_t)&SDL_HapticRumbleStop);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticRumbleSupported_REAL"), (uintptr_t)&SDL_HapticRumbleSupported);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticRunEffect_REAL"), (uintptr_t)&SDL_HapticRunEffect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticSetAutocenter_REAL"), (uintptr_t)&SDL_HapticSetAutocenter);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticSetGain_REAL"), (uintptr_t)&SDL_HapticSetGain);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticStopAll_REAL"), (uintptr_t)&SDL_HapticStopAll);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticStopEffect_REAL"), (uintptr_t)&SDL_HapticStopEffect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticUnpause_REAL"), (uintptr_t)&SDL_HapticUnpause);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HapticUpdateEffect_REAL"), (uintptr_t)&SDL_HapticUpdateEffect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Has3DNow_REAL"), (uintptr_t)&SDL_Has3DNow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasAltiVec_REAL"), (uintptr_t)&SDL_HasAltiVec);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasClipboardText_REAL"), (uintptr_t)&SDL_HasClipboardText);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasEvent_REAL"), (uintptr_t)&SDL_HasEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasEvents_REAL"), (uintptr_t)&SDL_HasEvents);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasIntersection_REAL"), (uintptr_t)&SDL_HasIntersection);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasMMX_REAL"), (uintptr_t)&SDL_HasMMX);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasRDTSC_REAL"), (uintptr_t)&SDL_HasRDTSC);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasSSE_REAL"), (uintptr_t)&SDL_HasSSE);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasSSE2_REAL"), (uintptr_t)&SDL_HasSSE2);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasSSE3_REAL"), (uintptr_t)&SDL_HasSSE3);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasSSE41_REAL"), (uintptr_t)&SDL_HasSSE41);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasSSE42_REAL"), (uintptr_t)&SDL_HasSSE42);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HasScreenKeyboardSupport_REAL"), (uintptr_t)&SDL_HasScreenKeyboardSupport);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_HideWindow_REAL"), (uintptr_t)&SDL_HideWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Init_REAL"), (uintptr_t)&SDL_Init);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_InitFormat_REAL"), (uintptr_t)&SDL_InitFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_InitSubSystem_REAL"), (uintptr_t)&SDL_InitSubSystem);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_InstallParachute_REAL"), (uintptr_t)&SDL_InstallParachute);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IntersectRect_REAL"), (uintptr_t)&SDL_IntersectRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IntersectRectAndLine_REAL"), (uintptr_t)&SDL_IntersectRectAndLine);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_InvalidateMap_REAL"), (uintptr_t)&SDL_InvalidateMap);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IsGameController_REAL"), (uintptr_t)&SDL_IsGameController);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IsScreenKeyboardShown_REAL"), (uintptr_t)&SDL_IsScreenKeyboardShown);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IsScreenSaverEnabled_REAL"), (uintptr_t)&SDL_IsScreenSaverEnabled);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IsShapedWindow_REAL"), (uintptr_t)&SDL_IsShapedWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_IsTextInputActive_REAL"), (uintptr_t)&SDL_IsTextInputActive);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickClose_REAL"), (uintptr_t)&SDL_JoystickClose);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickEventState_REAL"), (uintptr_t)&SDL_JoystickEventState);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetAttached_REAL"), (uintptr_t)&SDL_JoystickGetAttached);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetAxis_REAL"), (uintptr_t)&SDL_JoystickGetAxis);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetBall_REAL"), (uintptr_t)&SDL_JoystickGetBall);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetButton_REAL"), (uintptr_t)&SDL_JoystickGetButton);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetDeviceGUID_REAL"), (uintptr_t)&SDL_JoystickGetDeviceGUID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetGUID_REAL"), (uintptr_t)&SDL_JoystickGetGUID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetGUIDFromString_REAL"), (uintptr_t)&SDL_JoystickGetGUIDFromString);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetGUIDString_REAL"), (uintptr_t)&SDL_JoystickGetGUIDString);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickGetHat_REAL"), (uintptr_t)&SDL_JoystickGetHat);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickInit_REAL"), (uintptr_t)&SDL_JoystickInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickInstanceID_REAL"), (uintptr_t)&SDL_JoystickInstanceID);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickIsHaptic_REAL"), (uintptr_t)&SDL_JoystickIsHaptic);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickName_REAL"), (uintptr_t)&SDL_JoystickName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickNameForIndex_REAL"), (uintptr_t)&SDL_JoystickNameForIndex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickNumAxes_REAL"), (uintptr_t)&SDL_JoystickNumAxes);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickNumBalls_REAL"), (uintptr_t)&SDL_JoystickNumBalls);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickNumButtons_REAL"), (uintptr_t)&SDL_JoystickNumButtons);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickNumHats_REAL"), (uintptr_t)&SDL_JoystickNumHats);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickOpen_REAL"), (uintptr_t)&SDL_JoystickOpen);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickQuit_REAL"), (uintptr_t)&SDL_JoystickQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_JoystickUpdate_REAL"), (uintptr_t)&SDL_JoystickUpdate);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_KeyboardInit_REAL"), (uintptr_t)&SDL_KeyboardInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_KeyboardQuit_REAL"), (uintptr_t)&SDL_KeyboardQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LoadBMP_RW_REAL"), (uintptr_t)&SDL_LoadBMP_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LoadDollarTemplates_REAL"), (uintptr_t)&SDL_LoadDollarTemplates);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LoadFunction_REAL"), (uintptr_t)&SDL_LoadFunction);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LoadObject_REAL"), (uintptr_t)&SDL_LoadObject);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LoadWAV_RW_REAL"), (uintptr_t)&SDL_LoadWAV_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LockAudio_REAL"), (uintptr_t)&SDL_LockAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LockAudioDevice_REAL"), (uintptr_t)&SDL_LockAudioDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LockMutex_REAL"), (uintptr_t)&SDL_LockMutex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LockSurface_REAL"), (uintptr_t)&SDL_LockSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LockTexture_REAL"), (uintptr_t)&SDL_LockTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Log_REAL"), (uintptr_t)&ret0); //);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogCritical_REAL"), (uintptr_t)&ret0); //Critical);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogDebug_REAL"), (uintptr_t)&ret0); //Debug);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogError_REAL"), (uintptr_t)&ret0); //Error);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogGetOutputFunction_REAL"), (uintptr_t)&ret0); //GetOutputFunction);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogGetPriority_REAL"), (uintptr_t)&ret0); //GetPriority);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogInfo_REAL"), (uintptr_t)&ret0); //Info);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogMessage_REAL"), (uintptr_t)&ret0); //Message);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogMessageV_REAL"), (uintptr_t)&ret0); //MessageV);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogResetPriorities_REAL"), (uintptr_t)&ret0); //ResetPriorities);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogSetAllPriority_REAL"), (uintptr_t)&ret0); //SetAllPriority);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogSetOutputFunction_REAL"), (uintptr_t)&ret0); //SetOutputFunction);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogSetPriority_REAL"), (uintptr_t)&ret0); //SetPriority);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogVerbose_REAL"), (uintptr_t)&ret0); //Verbose);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LogWarn_REAL"), (uintptr_t)&ret0); //Warn);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LowerBlit_REAL"), (uintptr_t)&SDL_LowerBlit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_LowerBlitScaled_REAL"), (uintptr_t)&SDL_LowerBlitScaled);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MapRGB_REAL"), (uintptr_t)&SDL_MapRGB);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MapRGBA_REAL"), (uintptr_t)&SDL_MapRGBA);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_MapSurface_REAL"), (uintptr_t)&SDL_MapSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MasksToPixelFormatEnum_REAL"), (uintptr_t)&SDL_MasksToPixelFormatEnum);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MaximizeWindow_REAL"), (uintptr_t)&SDL_MaximizeWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MinimizeWindow_REAL"), (uintptr_t)&SDL_MinimizeWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MixAudio_REAL"), (uintptr_t)&SDL_MixAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MixAudioFormat_REAL"), (uintptr_t)&SDL_MixAudioFormat);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_MouseInit_REAL"), (uintptr_t)&SDL_MouseInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_MouseIsHaptic_REAL"), (uintptr_t)&SDL_MouseIsHaptic);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_MouseQuit_REAL"), (uintptr_t)&SDL_MouseQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_NextAudioFormat_REAL"), (uintptr_t)&SDL_NextAudioFormat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_NumHaptics_REAL"), (uintptr_t)&SDL_NumHaptics);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_NumJoysticks_REAL"), (uintptr_t)&SDL_NumJoysticks);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowFocusGained_REAL"), (uintptr_t)&SDL_OnWindowFocusGained);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowFocusLost_REAL"), (uintptr_t)&SDL_OnWindowFocusLost);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowHidden_REAL"), (uintptr_t)&SDL_OnWindowHidden);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowMinimized_REAL"), (uintptr_t)&SDL_OnWindowMinimized);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowResized_REAL"), (uintptr_t)&SDL_OnWindowResized);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowRestored_REAL"), (uintptr_t)&SDL_OnWindowRestored);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_OnWindowShown_REAL"), (uintptr_t)&SDL_OnWindowShown);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_OpenAudio_REAL"), (uintptr_t)&SDL_OpenAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_OpenAudioDevice_REAL"), (uintptr_t)&SDL_OpenAudioDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PauseAudio_REAL"), (uintptr_t)&SDL_PauseAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PauseAudioDevice_REAL"), (uintptr_t)&SDL_PauseAudioDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PeepEvents_REAL"), (uintptr_t)&SDL_PeepEvents);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PixelFormatEnumToMasks_REAL"), (uintptr_t)&SDL_PixelFormatEnumToMasks);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PollEvent_REAL"), (uintptr_t)&SDL_PollEvent);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGameControllerAxis_REAL"), (uintptr_t)&SDL_PrivateGameControllerAxis);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGameControllerButton_REAL"), (uintptr_t)&SDL_PrivateGameControllerButton);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGameControllerParseButton_REAL"), (uintptr_t)&SDL_PrivateGameControllerParseButton);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGameControllerRefreshMapping_REAL"), (uintptr_t)&SDL_PrivateGameControllerRefreshMapping);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGetControllerGUIDFromMappingString_REAL"), (uintptr_t)&SDL_PrivateGetControllerGUIDFromMappingString);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGetControllerMapping_REAL"), (uintptr_t)&SDL_PrivateGetControllerMapping);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGetControllerMappingForGUID_REAL"), (uintptr_t)&SDL_PrivateGetControllerMappingForGUID);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGetControllerMappingFromMappingString_REAL"), (uintptr_t)&SDL_PrivateGetControllerMappingFromMappingString);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateGetControllerNameFromMappingString_REAL"), (uintptr_t)&SDL_PrivateGetControllerNameFromMappingString);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickAxis_REAL"), (uintptr_t)&SDL_PrivateJoystickAxis);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickBall_REAL"), (uintptr_t)&SDL_PrivateJoystickBall);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickButton_REAL"), (uintptr_t)&SDL_PrivateJoystickButton);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickHat_REAL"), (uintptr_t)&SDL_PrivateJoystickHat);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickNeedsPolling_REAL"), (uintptr_t)&SDL_PrivateJoystickNeedsPolling);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateJoystickValid_REAL"), (uintptr_t)&SDL_PrivateJoystickValid);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_PrivateLoadButtonMapping_REAL"), (uintptr_t)&SDL_PrivateLoadButtonMapping);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PumpEvents_REAL"), (uintptr_t)&SDL_PumpEvents);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_PushEvent_REAL"), (uintptr_t)&SDL_PushEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_QueryTexture_REAL"), (uintptr_t)&SDL_QueryTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_Quit_REAL"), (uintptr_t)&SDL_Quit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_QuitInit_REAL"), (uintptr_t)&SDL_QuitInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_QuitQuit_REAL"), (uintptr_t)&SDL_QuitQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_QuitSubSystem_REAL"), (uintptr_t)&SDL_QuitSubSystem);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RLEAlphaBlit_REAL"), (uintptr_t)&SDL_RLEAlphaBlit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RLEBlit_REAL"), (uintptr_t)&SDL_RLEBlit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RLESurface_REAL"), (uintptr_t)&SDL_RLESurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RWFromConstMem_REAL"), (uintptr_t)&SDL_RWFromConstMem);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RWFromFP_REAL"), (uintptr_t)&SDL_RWFromFP);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RWFromFile_REAL"), (uintptr_t)&SDL_RWFromFile_hook);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RWFromMem_REAL"), (uintptr_t)&SDL_RWFromMem);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RaiseWindow_REAL"), (uintptr_t)&SDL_RaiseWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadBE16_REAL"), (uintptr_t)&SDL_ReadBE16);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadBE32_REAL"), (uintptr_t)&SDL_ReadBE32);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadBE64_REAL"), (uintptr_t)&SDL_ReadBE64);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadLE16_REAL"), (uintptr_t)&SDL_ReadLE16);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadLE32_REAL"), (uintptr_t)&SDL_ReadLE32);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadLE64_REAL"), (uintptr_t)&SDL_ReadLE64);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ReadU8_REAL"), (uintptr_t)&SDL_ReadU8);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RecordGesture_REAL"), (uintptr_t)&SDL_RecordGesture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RecreateWindow_REAL"), (uintptr_t)&SDL_RecreateWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RegisterEvents_REAL"), (uintptr_t)&SDL_RegisterEvents);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RegisterHintChangedCb_REAL"), (uintptr_t)&SDL_RegisterHintChangedCb);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RemoveTimer_REAL"), (uintptr_t)&SDL_RemoveTimer);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderClear_REAL"), (uintptr_t)&SDL_RenderClear);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderCopy_REAL"), (uintptr_t)&SDL_RenderCopy);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderCopyEx_REAL"), (uintptr_t)&SDL_RenderCopyEx);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawLine_REAL"), (uintptr_t)&SDL_RenderDrawLine);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawLines_REAL"), (uintptr_t)&SDL_RenderDrawLines);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawPoint_REAL"), (uintptr_t)&SDL_RenderDrawPoint);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawPoints_REAL"), (uintptr_t)&SDL_RenderDrawPoints);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawRect_REAL"), (uintptr_t)&SDL_RenderDrawRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderDrawRects_REAL"), (uintptr_t)&SDL_RenderDrawRects);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderFillRect_REAL"), (uintptr_t)&SDL_RenderFillRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderFillRects_REAL"), (uintptr_t)&SDL_RenderFillRects);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderGetLogicalSize_REAL"), (uintptr_t)&SDL_RenderGetLogicalSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderGetScale_REAL"), (uintptr_t)&SDL_RenderGetScale);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderGetViewport_REAL"), (uintptr_t)&SDL_RenderGetViewport);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderPresent_REAL"), (uintptr_t)&SDL_RenderPresent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderReadPixels_REAL"), (uintptr_t)&SDL_RenderReadPixels);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderSetLogicalSize_REAL"), (uintptr_t)&SDL_RenderSetLogicalSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderSetScale_REAL"), (uintptr_t)&SDL_RenderSetScale);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderSetViewport_REAL"), (uintptr_t)&SDL_RenderSetViewport);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RenderTargetSupported_REAL"), (uintptr_t)&SDL_RenderTargetSupported);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ResetAssertionReport_REAL"), (uintptr_t)&SDL_ResetAssertionReport);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_ResetKeyboard_REAL"), (uintptr_t)&SDL_ResetKeyboard);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_ResetMouse_REAL"), (uintptr_t)&SDL_ResetMouse);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_RestoreWindow_REAL"), (uintptr_t)&SDL_RestoreWindow);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RunAudio_REAL"), (uintptr_t)&SDL_RunAudio);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_RunThread_REAL"), (uintptr_t)&SDL_RunThread);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_CopyYUVToRGB_REAL"), (uintptr_t)&SDL_SW_CopyYUVToRGB);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_CreateYUVTexture_REAL"), (uintptr_t)&SDL_SW_CreateYUVTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_DestroyYUVTexture_REAL"), (uintptr_t)&SDL_SW_DestroyYUVTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_LockYUVTexture_REAL"), (uintptr_t)&SDL_SW_LockYUVTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_QueryYUVTexturePixels_REAL"), (uintptr_t)&SDL_SW_QueryYUVTexturePixels);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_UnlockYUVTexture_REAL"), (uintptr_t)&SDL_SW_UnlockYUVTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SW_UpdateYUVTexture_REAL"), (uintptr_t)&SDL_SW_UpdateYUVTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_CreateThread_REAL"), (uintptr_t)&SDL_SYS_CreateThread);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_GetInstanceIdOfDeviceIndex_REAL"), (uintptr_t)&SDL_SYS_GetInstanceIdOfDeviceIndex);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticClose_REAL"), (uintptr_t)&SDL_SYS_HapticClose);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticDestroyEffect_REAL"), (uintptr_t)&SDL_SYS_HapticDestroyEffect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticGetEffectStatus_REAL"), (uintptr_t)&SDL_SYS_HapticGetEffectStatus);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticInit_REAL"), (uintptr_t)&SDL_SYS_HapticInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticMouse_REAL"), (uintptr_t)&SDL_SYS_HapticMouse);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticName_REAL"), (uintptr_t)&SDL_SYS_HapticName);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticNewEffect_REAL"), (uintptr_t)&SDL_SYS_HapticNewEffect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticOpen_REAL"), (uintptr_t)&SDL_SYS_HapticOpen);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticOpenFromJoystick_REAL"), (uintptr_t)&SDL_SYS_HapticOpenFromJoystick);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticPause_REAL"), (uintptr_t)&SDL_SYS_HapticPause);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticQuit_REAL"), (uintptr_t)&SDL_SYS_HapticQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticRunEffect_REAL"), (uintptr_t)&SDL_SYS_HapticRunEffect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticSetAutocenter_REAL"), (uintptr_t)&SDL_SYS_HapticSetAutocenter);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticSetGain_REAL"), (uintptr_t)&SDL_SYS_HapticSetGain);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticStopAll_REAL"), (uintptr_t)&SDL_SYS_HapticStopAll);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticStopEffect_REAL"), (uintptr_t)&SDL_SYS_HapticStopEffect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticUnpause_REAL"), (uintptr_t)&SDL_SYS_HapticUnpause);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_HapticUpdateEffect_REAL"), (uintptr_t)&SDL_SYS_HapticUpdateEffect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickAttached_REAL"), (uintptr_t)&SDL_SYS_JoystickAttached);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickClose_REAL"), (uintptr_t)&SDL_SYS_JoystickClose);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickDetect_REAL"), (uintptr_t)&SDL_SYS_JoystickDetect);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickGetDeviceGUID_REAL"), (uintptr_t)&SDL_SYS_JoystickGetDeviceGUID);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickGetGUID_REAL"), (uintptr_t)&SDL_SYS_JoystickGetGUID);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickInit_REAL"), (uintptr_t)&SDL_SYS_JoystickInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickIsHaptic_REAL"), (uintptr_t)&SDL_SYS_JoystickIsHaptic);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickNameForDeviceIndex_REAL"), (uintptr_t)&SDL_SYS_JoystickNameForDeviceIndex);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickNeedsPolling_REAL"), (uintptr_t)&SDL_SYS_JoystickNeedsPolling);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickOpen_REAL"), (uintptr_t)&SDL_SYS_JoystickOpen);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickQuit_REAL"), (uintptr_t)&SDL_SYS_JoystickQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickSameHaptic_REAL"), (uintptr_t)&SDL_SYS_JoystickSameHaptic);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_JoystickUpdate_REAL"), (uintptr_t)&SDL_SYS_JoystickUpdate);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_NumJoysticks_REAL"), (uintptr_t)&SDL_SYS_NumJoysticks);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_SetThreadPriority_REAL"), (uintptr_t)&SDL_SYS_SetThreadPriority);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_SetupThread_REAL"), (uintptr_t)&SDL_SYS_SetupThread);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SYS_WaitThread_REAL"), (uintptr_t)&SDL_SYS_WaitThread);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SaveAllDollarTemplates_REAL"), (uintptr_t)&SDL_SaveAllDollarTemplates);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SaveBMP_RW_REAL"), (uintptr_t)&SDL_SaveBMP_RW);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SaveDollarTemplate_REAL"), (uintptr_t)&SDL_SaveDollarTemplate);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SemPost_REAL"), (uintptr_t)&SDL_SemPost);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SemTryWait_REAL"), (uintptr_t)&SDL_SemTryWait);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SemValue_REAL"), (uintptr_t)&SDL_SemValue);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SemWait_REAL"), (uintptr_t)&SDL_SemWait);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SemWaitTimeout_REAL"), (uintptr_t)&SDL_SemWaitTimeout);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendClipboardUpdate_REAL"), (uintptr_t)&SDL_SendClipboardUpdate);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendDropFile_REAL"), (uintptr_t)&SDL_SendDropFile);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendEditingText_REAL"), (uintptr_t)&SDL_SendEditingText);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendGestureMulti_REAL"), (uintptr_t)&SDL_SendGestureMulti);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendKeyboardKey_REAL"), (uintptr_t)&SDL_SendKeyboardKey);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendKeyboardText_REAL"), (uintptr_t)&SDL_SendKeyboardText);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendMouseButton_REAL"), (uintptr_t)&SDL_SendMouseButton);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendMouseMotion_REAL"), (uintptr_t)&SDL_SendMouseMotion);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendMouseWheel_REAL"), (uintptr_t)&SDL_SendMouseWheel);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendQuit_REAL"), (uintptr_t)&SDL_SendQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendSysWMEvent_REAL"), (uintptr_t)&SDL_SendSysWMEvent);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendTouch_REAL"), (uintptr_t)&SDL_SendTouch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendTouchMotion_REAL"), (uintptr_t)&SDL_SendTouchMotion);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SendWindowEvent_REAL"), (uintptr_t)&SDL_SendWindowEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetAssertionHandler_REAL"), (uintptr_t)&SDL_SetAssertionHandler);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetClipRect_REAL"), (uintptr_t)&SDL_SetClipRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetClipboardText_REAL"), (uintptr_t)&SDL_SetClipboardText);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetColorKey_REAL"), (uintptr_t)&SDL_SetColorKey);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetCursor_REAL"), (uintptr_t)&SDL_SetCursor);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetDefaultCursor_REAL"), (uintptr_t)&SDL_SetDefaultCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetError_REAL"), (uintptr_t)&SDL_SetError);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetEventFilter_REAL"), (uintptr_t)&SDL_SetEventFilter);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetHint_REAL"), (uintptr_t)&SDL_SetHint);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetHintWithPriority_REAL"), (uintptr_t)&SDL_SetHintWithPriority);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetKeyboardFocus_REAL"), (uintptr_t)&SDL_SetKeyboardFocus);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetKeymap_REAL"), (uintptr_t)&SDL_SetKeymap);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetModState_REAL"), (uintptr_t)&SDL_SetModState);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetMouseFocus_REAL"), (uintptr_t)&SDL_SetMouseFocus);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetPaletteColors_REAL"), (uintptr_t)&SDL_SetPaletteColors);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetPixelFormatPalette_REAL"), (uintptr_t)&SDL_SetPixelFormatPalette);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetRelativeMouseMode_REAL"), (uintptr_t)&SDL_SetRelativeMouseMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetRenderDrawBlendMode_REAL"), (uintptr_t)&SDL_SetRenderDrawBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetRenderDrawColor_REAL"), (uintptr_t)&SDL_SetRenderDrawColor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetRenderTarget_REAL"), (uintptr_t)&SDL_SetRenderTarget);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetScancodeName_REAL"), (uintptr_t)&SDL_SetScancodeName);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetSurfaceAlphaMod_REAL"), (uintptr_t)&SDL_SetSurfaceAlphaMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetSurfaceBlendMode_REAL"), (uintptr_t)&SDL_SetSurfaceBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetSurfaceColorMod_REAL"), (uintptr_t)&SDL_SetSurfaceColorMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetSurfacePalette_REAL"), (uintptr_t)&SDL_SetSurfacePalette);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetSurfaceRLE_REAL"), (uintptr_t)&SDL_SetSurfaceRLE);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetTextInputRect_REAL"), (uintptr_t)&SDL_SetTextInputRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetTextureAlphaMod_REAL"), (uintptr_t)&SDL_SetTextureAlphaMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetTextureBlendMode_REAL"), (uintptr_t)&SDL_SetTextureBlendMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetTextureColorMod_REAL"), (uintptr_t)&SDL_SetTextureColorMod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetThreadPriority_REAL"), (uintptr_t)&SDL_SetThreadPriority);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowBordered_REAL"), (uintptr_t)&SDL_SetWindowBordered);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowBrightness_REAL"), (uintptr_t)&SDL_SetWindowBrightness);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowData_REAL"), (uintptr_t)&SDL_SetWindowData);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowDisplayMode_REAL"), (uintptr_t)&SDL_SetWindowDisplayMode);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowFullscreen_REAL"), (uintptr_t)&SDL_SetWindowFullscreen);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowGammaRamp_REAL"), (uintptr_t)&SDL_SetWindowGammaRamp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowGrab_REAL"), (uintptr_t)&SDL_SetWindowGrab);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowIcon_REAL"), (uintptr_t)&SDL_SetWindowIcon);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowMaximumSize_REAL"), (uintptr_t)&SDL_SetWindowMaximumSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowMinimumSize_REAL"), (uintptr_t)&SDL_SetWindowMinimumSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowPosition_REAL"), (uintptr_t)&SDL_SetWindowPosition);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowShape_REAL"), (uintptr_t)&SDL_SetWindowShape);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowSize_REAL"), (uintptr_t)&SDL_SetWindowSize);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SetWindowTitle_REAL"), (uintptr_t)&SDL_SetWindowTitle);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShouldAllowTopmost_REAL"), (uintptr_t)&SDL_ShouldAllowTopmost);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShowCursor_REAL"), (uintptr_t)&SDL_ShowCursor);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShowMessageBox_REAL"), (uintptr_t)&SDL_ShowMessageBox);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShowProgressHUD_REAL"), (uintptr_t)&SDL_ShowProgressHUD);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShowSimpleMessageBox_REAL"), (uintptr_t)&SDL_ShowSimpleMessageBox);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ShowWindow_REAL"), (uintptr_t)&SDL_ShowWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_SoftStretch_REAL"), (uintptr_t)&SDL_SoftStretch);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_StartEventLoop_REAL"), (uintptr_t)&SDL_StartEventLoop);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_StartTextInput_REAL"), (uintptr_t)&SDL_StartTextInput);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_StartTicks_REAL"), (uintptr_t)&SDL_StartTicks);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_StopEventLoop_REAL"), (uintptr_t)&SDL_StopEventLoop);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_StopTextInput_REAL"), (uintptr_t)&SDL_StopTextInput);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ThreadID_REAL"), (uintptr_t)&SDL_ThreadID);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_TimerInit_REAL"), (uintptr_t)&SDL_TimerInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_TimerQuit_REAL"), (uintptr_t)&SDL_TimerQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_TouchInit_REAL"), (uintptr_t)&SDL_TouchInit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_TouchQuit_REAL"), (uintptr_t)&SDL_TouchQuit);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_TraverseShapeTree_REAL"), (uintptr_t)&SDL_TraverseShapeTree);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_TryLockMutex_REAL"), (uintptr_t)&SDL_TryLockMutex);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnRLESurface_REAL"), (uintptr_t)&SDL_UnRLESurface);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_UninstallParachute_REAL"), (uintptr_t)&SDL_UninstallParachute);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnionRect_REAL"), (uintptr_t)&SDL_UnionRect);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnloadObject_REAL"), (uintptr_t)&SDL_UnloadObject);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnlockAudio_REAL"), (uintptr_t)&SDL_UnlockAudio);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnlockAudioDevice_REAL"), (uintptr_t)&SDL_UnlockAudioDevice);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnlockMutex_REAL"), (uintptr_t)&SDL_UnlockMutex);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnlockSurface_REAL"), (uintptr_t)&SDL_UnlockSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UnlockTexture_REAL"), (uintptr_t)&SDL_UnlockTexture);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpdateTexture_REAL"), (uintptr_t)&SDL_UpdateTexture);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpdateWindowGrab_REAL"), (uintptr_t)&SDL_UpdateWindowGrab);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpdateWindowSurface_REAL"), (uintptr_t)&SDL_UpdateWindowSurface);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpdateWindowSurfaceRects_REAL"), (uintptr_t)&SDL_UpdateWindowSurfaceRects);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpperBlit_REAL"), (uintptr_t)&SDL_UpperBlit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_UpperBlitScaled_REAL"), (uintptr_t)&SDL_UpperBlitScaled);
-	//hook_addr(so_symbol(&thimbleweed_mod, "SDL_Vibrate_REAL"), (uintptr_t)&SDL_Vibrate);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_VideoInit_REAL"), (uintptr_t)&SDL_VideoInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_VideoQuit_REAL"), (uintptr_t)&SDL_VideoQuit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WaitEvent_REAL"), (uintptr_t)&SDL_WaitEvent);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WaitEventTimeout_REAL"), (uintptr_t)&SDL_WaitEventTimeout);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WaitThread_REAL"), (uintptr_t)&SDL_WaitThread);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WarpMouseInWindow_REAL"), (uintptr_t)&SDL_WarpMouseInWindow);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WasInit_REAL"), (uintptr_t)&SDL_WasInit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteBE16_REAL"), (uintptr_t)&SDL_WriteBE16);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteBE32_REAL"), (uintptr_t)&SDL_WriteBE32);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteBE64_REAL"), (uintptr_t)&SDL_WriteBE64);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteLE16_REAL"), (uintptr_t)&SDL_WriteLE16);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteLE32_REAL"), (uintptr_t)&SDL_WriteLE32);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteLE64_REAL"), (uintptr_t)&SDL_WriteLE64);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_WriteU8_REAL"), (uintptr_t)&SDL_WriteU8);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_abs_REAL"), (uintptr_t)&SDL_abs);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_atof_REAL"), (uintptr_t)&SDL_atof);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_atoi_REAL"), (uintptr_t)&SDL_atoi);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_calloc_REAL"), (uintptr_t)&SDL_calloc);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ceil_REAL"), (uintptr_t)&SDL_ceil);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_cosf_REAL"), (uintptr_t)&SDL_cosf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_free_REAL"), (uintptr_t)&SDL_free);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_getenv_REAL"), (uintptr_t)&SDL_getenv);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_iconv_REAL"), (uintptr_t)&SDL_iconv);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_iconv_close_REAL"), (uintptr_t)&SDL_iconv_close);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_iconv_open_REAL"), (uintptr_t)&SDL_iconv_open);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_iconv_string_REAL"), (uintptr_t)&SDL_iconv_string);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_isdigit_REAL"), (uintptr_t)&SDL_isdigit);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_isspace_REAL"), (uintptr_t)&SDL_isspace);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_itoa_REAL"), (uintptr_t)&SDL_itoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_lltoa_REAL"), (uintptr_t)&SDL_lltoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ltoa_REAL"), (uintptr_t)&SDL_ltoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_malloc_REAL"), (uintptr_t)&SDL_malloc);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_memcmp_REAL"), (uintptr_t)&SDL_memcmp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_memcpy_REAL"), (uintptr_t)&SDL_memcpy);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_memmove_REAL"), (uintptr_t)&SDL_memmove);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_memset_REAL"), (uintptr_t)&SDL_memset);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_qsort_REAL"), (uintptr_t)&SDL_qsort);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_realloc_REAL"), (uintptr_t)&SDL_realloc);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_setenv_REAL"), (uintptr_t)&SDL_setenv);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_sinf_REAL"), (uintptr_t)&SDL_sinf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_snprintf_REAL"), (uintptr_t)&SDL_snprintf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_sscanf_REAL"), (uintptr_t)&SDL_sscanf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strcasecmp_REAL"), (uintptr_t)&SDL_strcasecmp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strchr_REAL"), (uintptr_t)&SDL_strchr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strcmp_REAL"), (uintptr_t)&SDL_strcmp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strdup_REAL"), (uintptr_t)&SDL_strdup);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strlcat_REAL"), (uintptr_t)&SDL_strlcat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strlcpy_REAL"), (uintptr_t)&SDL_strlcpy);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strlen_REAL"), (uintptr_t)&SDL_strlen);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strlwr_REAL"), (uintptr_t)&SDL_strlwr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strncasecmp_REAL"), (uintptr_t)&SDL_strncasecmp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strncmp_REAL"), (uintptr_t)&SDL_strncmp);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strrchr_REAL"), (uintptr_t)&SDL_strrchr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strrev_REAL"), (uintptr_t)&SDL_strrev);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strstr_REAL"), (uintptr_t)&SDL_strstr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strtod_REAL"), (uintptr_t)&SDL_strtod);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strtol_REAL"), (uintptr_t)&SDL_strtol);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strtoll_REAL"), (uintptr_t)&SDL_strtoll);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strtoul_REAL"), (uintptr_t)&SDL_strtoul);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strtoull_REAL"), (uintptr_t)&SDL_strtoull);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_strupr_REAL"), (uintptr_t)&SDL_strupr);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_tolower_REAL"), (uintptr_t)&SDL_tolower);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_toupper_REAL"), (uintptr_t)&SDL_toupper);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_uitoa_REAL"), (uintptr_t)&SDL_uitoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ulltoa_REAL"), (uintptr_t)&SDL_ulltoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_ultoa_REAL"), (uintptr_t)&SDL_ultoa);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_utf8strlcpy_REAL"), (uintptr_t)&SDL_utf8strlcpy);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_vsnprintf_REAL"), (uintptr_t)&SDL_vsnprintf);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_wcslcat_REAL"), (uintptr_t)&SDL_wcslcat);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_wcslcpy_REAL"), (uintptr_t)&SDL_wcslcpy);
-	hook_addr(so_symbol(&thimbleweed_mod, "SDL_wcslen_REAL"), (uintptr_t)&SDL_wcslen);
+
+	// Resolve the whole hook table in a single sweep
+	int num_hooks = sizeof(game_hooks) / sizeof(*game_hooks);
+	so_symbol_key *keys = malloc(num_hooks * sizeof(so_symbol_key));
+	uintptr_t *addrs = malloc(num_hooks * sizeof(uintptr_t));
+	if (keys && addrs) {
+		for (int i = 0; i < num_hooks; i++)
+			so_symbol_key_init(&keys[i], game_hooks[i].symbol);
+		so_symbol_batch(&thimbleweed_mod, keys, addrs, num_hooks);
+	} else {
+		// Out of memory already, look each one up as it gets hooked
+		free(addrs);
+		addrs = NULL;
+	}
+
+#ifdef ENABLE_DEBUG
+	SceUInt64 start = sceKernelGetProcessTimeWide();
+	for (int i = 0; i < num_hooks; i++)
+		so_symbol(&thimbleweed_mod, game_hooks[i].symbol);
+	debugPrintf("patch_game: %d individual lookups in %llu us\n", num_hooks, sceKernelGetProcessTimeWide() - start);
+#endif
+
+	for (int i = 0; i < num_hooks; i++)
+		hook_addr(addrs ? addrs[i] : so_symbol(&thimbleweed_mod, game_hooks[i].symbol), game_hooks[i].func);
+
+	free(keys);
+	free(addrs);
+
+	so_hook_commit();
+	debugPrintf("patch_game: %d hooks installed in %llu us\n", num_hooks + 1, sceKernelGetProcessTimeWide() - patch_start);
+}
+
+#ifdef LAZY_BINDING
+static void lazy_binding_report(void) {
+	so_lazy_report(&thimbleweed_mod);
+}
+#endif
+
+#ifdef PROFILE_IMPORTS
+static void import_profile_report(void) {
+	char path[256];
+	sprintf(path, "%s/imports.txt", data_path);
+	so_import_profile_dump(&thimbleweed_mod, path);
+}
+#endif
+
+#ifdef SAMPLING_PROFILER
+static void sampling_profile_report(void) {
+	char path[256];
+	profiler_stop();
+	sprintf(path, "%s/profile.folded", data_path);
+	profiler_dump(path);
+}
+#endif
+
+// Watermarks are set from what vitaGL has left, since GPU allocations eat into the same pools
+static void mem_set_watermarks(void) {
+	int headroom = mem_in_use + mem_pressure_free();
+	for (int level = MEM_PRESSURE_MODERATE; level < MEM_PRESSURE_LEVELS; level++)
+		mem_marks[level] = headroom - mem_pressure_free_mark[level];
+	mem_low = headroom - MEMORY_REARM_FREE_MB * 1024 * 1024;
+}
+
+static void (*PurgeCache)(void *this);
+
+static void purge_game_caches(void) {
+	PurgeCache(NULL);
 }
 
 void *mem_manager(void *arg) {
-	void (*PurgeCache)(void *this) = (void *)so_symbol(&thimbleweed_mod, "_ZN9GameScene12appLowMemoryEv");
+	PurgeCache = (void *)so_symbol(&thimbleweed_mod, "_ZN9GameScene12appLowMemoryEv");
+	mem_pressure_register(MEM_PRESSURE_MODERATE, "mmap cache", mmap_emu_trim);
+	mem_pressure_register(MEM_PRESSURE_MODERATE, "slab magazines", slab_trim_magazines);
+	mem_pressure_register(MEM_PRESSURE_HIGH, "slab spans", slab_trim);
+	mem_pressure_register(MEM_PRESSURE_CRITICAL, "game caches", purge_game_caches);
+
+	mem_set_watermarks();
+	mem_signal(mem_in_use);
+
 	for (;;) {
-		if (vglMemFree(VGL_MEM_SLOW) < 22 * 1024 * 1024) {
-			PurgeCache(NULL);
+		SceUInt timeout = MEMORY_POLL_MS * 1000;
+		int level;
+		if (sceKernelWaitSema(mem_sema, 1, &timeout) < 0) {
+			// Timed out: textures and buffers the game takes from vitaGL never pass
+			// through the wrappers, so look at what's actually free instead
+			mem_set_watermarks();
+			level = mem_pressure_level();
+			if (level <= mem_signalled) {
+				if (mem_in_use < mem_low)
+					mem_signalled = MEM_PRESSURE_NONE;
+				continue;
+			}
+			mem_signalled = level;
+		} else {
+			level = mem_pressure_level();
 		}
-		sceKernelDelayThread(3 * 1000 * 1000);
+		mem_pressure_reclaim(level);
+		slab_stats();
+		mem_set_watermarks();
 	}
 }
 
@@ -3096,6 +3317,8 @@ void *pthread_main(void *arg) {
 }
 
 int main(int argc, char *argv[]) {
+	slab_init();
+
 	//sceSysmoduleLoadModule(SCE_SYSMODULE_RAZOR_CAPTURE);
 	//SceUID crasher_thread = sceKernelCreateThread("crasher", crasher, 0x40, 0x1000, 0, 0, NULL);
 	//sceKernelStartThread(crasher_thread, 0, NULL);	
@@ -3130,20 +3353,57 @@ int main(int argc, char *argv[]) {
 	char fname[256];
 	sprintf(data_path, "ux0:data/thimbleweed");
 	
+#ifdef TRACE_ALLOCS
+	sprintf(fname, "%s/allocs.bin", data_path);
+	if (alloc_trace_start(fname) == 0)
+		atexit(alloc_trace_stop);
+#endif
+
 	printf("Loading libThimbleweedPark\n");
 	sprintf(fname, "%s/libThimbleweedPark.so", data_path);
 	if (so_file_load(&thimbleweed_mod, fname, LOAD_ADDRESS) < 0)
 		fatal_error("Error could not load %s.", fname);
-	so_relocate(&thimbleweed_mod);
-	so_resolve(&thimbleweed_mod, default_dynlib, sizeof(default_dynlib), 0);
+#ifdef LAZY_BINDING
+	thimbleweed_mod.lazy_bind = 1;
+	atexit(lazy_binding_report);
+#endif
+#ifdef PROFILE_IMPORTS
+	thimbleweed_mod.profile_imports = 1;
+	atexit(import_profile_report);
+#endif
+#ifdef SAMPLING_PROFILER
+	thimbleweed_mod.profile_imports = 1;
+#endif
+
+	// Name hashes are generated at build time, see gen_dynlib_hashes.cmake
+	for (int i = 0; i < numhooks; i++)
+		default_dynlib[i].hash = default_dynlib_hashes[i];
+
+	uint8_t prelink_key[SO_KEY_SIZE];
+	so_prelink_key(&thimbleweed_mod, default_dynlib, sizeof(default_dynlib), prelink_key);
+	sprintf(fname, "%s/prelink.bin", data_path);
+	if (so_prelink_load(&thimbleweed_mod, fname, prelink_key) < 0) {
+		so_relocate_resolve(&thimbleweed_mod, default_dynlib, sizeof(default_dynlib), 0);
+		so_prelink_save(&thimbleweed_mod, fname, prelink_key);
+	}
 
 	vglUseTripleBuffering(GL_FALSE);
 	vglSetParamBufferSize(3 * 1024 * 1024);
 	vglSetSemanticBindingMode(VGL_MODE_POSTPONED);
 	vglInitWithCustomThreshold(0, SCREEN_W, SCREEN_H, MEMORY_VITAGL_THRESHOLD_MB * 1024 * 1024, 0, 0, 0, SCE_GXM_MULTISAMPLE_NONE);
 	
-	patch_game();
 	so_flush_caches(&thimbleweed_mod);
+	patch_game();
+	so_arena_stats(&thimbleweed_mod);
+#ifdef CRASH_REPORTS
+	sprintf(fname, "%s/crash.txt", data_path);
+	if (crash_handler_init(fname) < 0)
+		printf("Crash handler could not be installed.\n");
+#endif
+#ifdef SAMPLING_PROFILER
+	if (profiler_start(&thimbleweed_mod, 1000) == 0)
+		atexit(sampling_profile_report);
+#endif
 	so_initialize(&thimbleweed_mod);
 	
 	memset(fake_vm, 'A', sizeof(fake_vm));
@@ -3193,6 +3453,7 @@ int main(int argc, char *argv[]) {
 
 	pthread_t t, t2;
 	pthread_attr_t attr, attr2;
+	mem_sema = sceKernelCreateSema("mem_manager", 0, 0, 1, NULL);
 	pthread_attr_init(&attr);
 	pthread_attr_setstacksize(&attr, 512 * 1024);
 	pthread_create(&t, &attr, mem_manager, NULL);
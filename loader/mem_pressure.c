@@ -0,0 +1,90 @@
+/* mem_pressure.c -- graduated responses to running low on memory
+ *
+ * Reclaim actions are registered against the level they're worth running at, and
+ * a level runs its own actions plus all the cheaper ones below it. What each one
+ * gave back is measured from vitaGL's free counters around the call.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <vitasdk.h>
+#include <vitaGL.h>
+
+#include "main.h"
+#include "config.h"
+#include "mem_pressure.h"
+
+#define MAX_RECLAIMERS 16
+
+const int mem_pressure_free_mark[MEM_PRESSURE_LEVELS] = {
+	0x7fffffff,
+	MEMORY_MODERATE_FREE_MB * 1024 * 1024,
+	MEMORY_HIGH_FREE_MB * 1024 * 1024,
+	MEMORY_PURGE_FREE_MB * 1024 * 1024,
+};
+
+static const char *level_names[MEM_PRESSURE_LEVELS] = { "none", "moderate", "high", "critical" };
+
+static struct {
+	const char *name;
+	int level;
+	void (*reclaim)(void);
+	int reclaimed;
+} reclaimers[MAX_RECLAIMERS];
+static int num_reclaimers = 0;
+
+static int triggers[MEM_PRESSURE_LEVELS];
+static int reclaimed[MEM_PRESSURE_LEVELS];
+
+int mem_pressure_register(int level, const char *name, void (*reclaim)(void)) {
+	if (num_reclaimers == MAX_RECLAIMERS)
+		return -1;
+
+	reclaimers[num_reclaimers].name = name;
+	reclaimers[num_reclaimers].level = level;
+	reclaimers[num_reclaimers].reclaim = reclaim;
+	reclaimers[num_reclaimers].reclaimed = 0;
+	num_reclaimers++;
+	return 0;
+}
+
+// Heap allocations can land in any of the pools, so they all count
+int mem_pressure_free(void) {
+	return vglMemFree(VGL_MEM_ALL);
+}
+
+int mem_pressure_level(void) {
+	int free_mem = mem_pressure_free();
+	int level = MEM_PRESSURE_NONE;
+	while (level < MEM_PRESSURE_CRITICAL && free_mem < mem_pressure_free_mark[level + 1])
+		level++;
+	return level;
+}
+
+void mem_pressure_reclaim(int level) {
+	if (level == MEM_PRESSURE_NONE)
+		return;
+	triggers[level]++;
+
+	// Cheapest first, a level runs everything registered at or below it
+	int total = 0;
+	for (int l = MEM_PRESSURE_MODERATE; l <= level; l++) {
+		for (int i = 0; i < num_reclaimers; i++) {
+			if (reclaimers[i].level != l)
+				continue;
+			int before = mem_pressure_free();
+			reclaimers[i].reclaim();
+			int freed = mem_pressure_free() - before;
+			if (freed < 0)
+				freed = 0;
+			reclaimers[i].reclaimed += freed;
+			total += freed;
+			debugPrintf("mem_pressure: %s reclaimed %d KB\n", reclaimers[i].name, freed / 1024);
+		}
+	}
+	reclaimed[level] += total;
+
+	debugPrintf("mem_pressure: %s pressure #%d, %d KB reclaimed (%d KB total), %d KB free\n",
+		level_names[level], triggers[level], total / 1024, reclaimed[level] / 1024, mem_pressure_free() / 1024);
+}
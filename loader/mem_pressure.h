@@ -0,0 +1,20 @@
+#ifndef __MEM_PRESSURE_H__
+#define __MEM_PRESSURE_H__
+
+enum {
+  MEM_PRESSURE_NONE,
+  MEM_PRESSURE_MODERATE, // trim our own caches
+  MEM_PRESSURE_HIGH,
+  MEM_PRESSURE_CRITICAL, // let the game throw its caches away
+  MEM_PRESSURE_LEVELS
+};
+
+// Free bytes below which each level kicks in
+extern const int mem_pressure_free_mark[MEM_PRESSURE_LEVELS];
+
+int mem_pressure_register(int level, const char *name, void (*reclaim)(void));
+int mem_pressure_free(void);
+int mem_pressure_level(void);
+void mem_pressure_reclaim(int level);
+
+#endif
@@ -0,0 +1,280 @@
+/* mmap_emu.c -- file backed mmap on top of plain reads
+ *
+ * There's no way to catch the first touch of a page from userland, so mappings
+ * are filled up front, MMAP_READAHEAD bytes per read, with anything past the end
+ * of the file left zeroed as it would be on Linux. Read-only mappings of the same
+ * file range are shared and refcounted, and stay cached for a while after the last
+ * unmap (up to MMAP_CACHE_MAX bytes) until memory pressure drops them. A copy is
+ * only handed out again while the file keeps the size and mtime it was read with,
+ * and not after the file got opened for writing. Writes to MAP_SHARED mappings only
+ * reach the file when they're unmapped.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <vitasdk.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+#include "mmap_emu.h"
+
+#define MAX_MMAP_FDS 256
+#define MAX_MAPPINGS 64
+
+typedef struct {
+	uintptr_t addr; // 0 for a free slot
+	size_t length;
+	int refs; // 0 while only cached
+	int shared_ro; // read-only file mapping other callers can share
+	int writeback; // MAP_SHARED and writable, goes back to the file on unmap
+	size_t file_length; // bytes that came from the file, the rest is zero fill
+	char *path;
+	int64_t offset;
+	off_t file_size; // what the file looked like when it was read, for shared_ro
+	time_t file_mtime;
+} mmap_region;
+
+static char *fd_paths[MAX_MMAP_FDS];
+static mmap_region regions[MAX_MAPPINGS];
+static size_t cached_bytes = 0;
+static pthread_mutex_t mmap_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+// open() hands out the fds, so that's where the path behind each one gets noted
+void mmap_emu_open(int fd, const char *path) {
+	if (fd < 0 || fd >= MAX_MMAP_FDS)
+		return;
+	pthread_mutex_lock(&mmap_mutex);
+	free(fd_paths[fd]);
+	fd_paths[fd] = strdup(path);
+	pthread_mutex_unlock(&mmap_mutex);
+}
+
+void mmap_emu_close(int fd) {
+	if (fd < 0 || fd >= MAX_MMAP_FDS)
+		return;
+	pthread_mutex_lock(&mmap_mutex);
+	free(fd_paths[fd]);
+	fd_paths[fd] = NULL;
+	pthread_mutex_unlock(&mmap_mutex);
+}
+
+// Returns how much of the range the file had
+static int mmap_fill(void *dst, size_t length, const char *path, int64_t offset) {
+	SceUID fd = sceIoOpen(path, SCE_O_RDONLY, 0);
+	if (fd < 0)
+		return -1;
+
+	size_t done = 0;
+	while (done < length) {
+		size_t chunk = length - done < MMAP_READAHEAD ? length - done : MMAP_READAHEAD;
+		int n = sceIoPread(fd, (uint8_t *)dst + done, chunk, offset + done);
+		if (n <= 0)
+			break;
+		done += n;
+	}
+	sceIoClose(fd);
+
+	memset((uint8_t *)dst + done, 0, length - done);
+	return done;
+}
+
+static void mmap_writeback(mmap_region *r) {
+	SceUID fd = sceIoOpen(r->path, SCE_O_WRONLY, 0);
+	if (fd < 0)
+		return;
+	sceIoPwrite(fd, (void *)r->addr, r->file_length, r->offset);
+	sceIoClose(fd);
+}
+
+// Stops handing out r, a copy that's only cached goes away entirely. Call with mmap_mutex held
+static void mmap_unshare(mmap_region *r) {
+	r->shared_ro = 0;
+	if (r->refs)
+		return;
+	cached_bytes -= r->length;
+	free((void *)r->addr);
+	free(r->path);
+	memset(r, 0, sizeof(mmap_region));
+}
+
+// Same file range already mapped read-only, hand out the existing copy. Call with mmap_mutex held
+static void *mmap_share(const char *path, int64_t offset, size_t size, const struct stat *st) {
+	for (int i = 0; i < MAX_MAPPINGS; i++) {
+		mmap_region *r = &regions[i];
+		if (!r->addr || !r->shared_ro || r->offset != offset || r->length != size || strcmp(r->path, path))
+			continue;
+
+		// The file changed since this copy was read
+		if (r->file_size != st->st_size || r->file_mtime != st->st_mtime) {
+			mmap_unshare(r);
+			continue;
+		}
+
+		if (r->refs++ == 0)
+			cached_bytes -= r->length;
+		return (void *)r->addr;
+	}
+	return MMAP_FAILED;
+}
+
+/*
+ * mmap_emu: the file is read with mmap_mutex released, so one big mapping doesn't hold
+ * up every other mmap and open. The region only goes into the table once it's filled;
+ * if another thread mapped the same read-only range meanwhile, its copy wins.
+*/
+void *mmap_emu(void *addr, size_t length, int prot, int flags, int fd, int64_t offset) {
+	if (length == 0 || (offset & (MMAP_PAGE_SIZE - 1)) || (flags & MMAP_FIXED))
+		return MMAP_FAILED;
+
+	int anonymous = flags & MMAP_ANONYMOUS;
+	int writable = prot & MMAP_PROT_WRITE;
+	int shared_ro = !anonymous && !writable;
+	size_t size = ALIGN_MEM(length, MMAP_PAGE_SIZE);
+	void *mem = MMAP_FAILED;
+	char *path = NULL;
+	void *buf = NULL;
+	mmap_region evicted = { 0 };
+	struct stat st;
+
+	if (!anonymous) {
+		pthread_mutex_lock(&mmap_mutex);
+		if (fd >= 0 && fd < MAX_MMAP_FDS && fd_paths[fd])
+			path = strdup(fd_paths[fd]);
+		pthread_mutex_unlock(&mmap_mutex);
+		if (!path || stat(path, &st) < 0)
+			goto out;
+	}
+
+	if (shared_ro) {
+		pthread_mutex_lock(&mmap_mutex);
+		mem = mmap_share(path, offset, size, &st);
+		pthread_mutex_unlock(&mmap_mutex);
+		if (mem != MMAP_FAILED)
+			goto out;
+	}
+
+	buf = memalign(MMAP_PAGE_SIZE, size);
+	if (!buf)
+		goto out;
+
+	int file_length = 0;
+	if (anonymous)
+		memset(buf, 0, size);
+	else if ((file_length = mmap_fill(buf, size, path, offset)) < 0)
+		goto out;
+
+	pthread_mutex_lock(&mmap_mutex);
+	if (shared_ro)
+		mem = mmap_share(path, offset, size, &st);
+	if (mem == MMAP_FAILED) {
+		mmap_region *r = NULL;
+		for (int i = 0; i < MAX_MAPPINGS; i++) {
+			if (!regions[i].addr) {
+				r = &regions[i];
+				break;
+			}
+			if (!regions[i].refs && !r)
+				r = &regions[i];
+		}
+		if (r && r->addr) { // every slot is taken, make room by dropping a cached one
+			evicted = *r;
+			cached_bytes -= r->length;
+		}
+		if (r) {
+			r->addr = (uintptr_t)buf;
+			r->length = size;
+			r->refs = 1;
+			r->shared_ro = shared_ro;
+			r->writeback = !anonymous && writable && (flags & MMAP_SHARED);
+			r->file_length = file_length;
+			r->path = path;
+			r->offset = offset;
+			r->file_size = anonymous ? 0 : st.st_size;
+			r->file_mtime = anonymous ? 0 : st.st_mtime;
+			mem = buf;
+			path = NULL; // the region owns it now
+		}
+	}
+	pthread_mutex_unlock(&mmap_mutex);
+
+out:
+	if (mem != buf)
+		free(buf);
+	free((void *)evicted.addr);
+	free(evicted.path);
+	free(path);
+	if (mem == MMAP_FAILED)
+		debugPrintf("mmap: failed to map %u bytes of fd %d at 0x%llx\n", length, fd, offset);
+	return mem;
+}
+
+// Only whole mappings can be unmapped. The last unmap writes back and frees outside the lock
+int munmap_emu(void *addr, size_t length) {
+	mmap_region last = { 0 };
+	int ret = -1;
+
+	pthread_mutex_lock(&mmap_mutex);
+	for (int i = 0; i < MAX_MAPPINGS; i++) {
+		mmap_region *r = &regions[i];
+		if (r->addr != (uintptr_t)addr || !r->refs)
+			continue;
+
+		// Splitting a region isn't supported, refuse rather than drop the whole of it
+		if (ALIGN_MEM(length, MMAP_PAGE_SIZE) != r->length)
+			break;
+
+		if (--r->refs == 0) {
+			if (r->shared_ro && cached_bytes + r->length <= MMAP_CACHE_MAX) {
+				cached_bytes += r->length;
+			} else {
+				last = *r;
+				memset(r, 0, sizeof(mmap_region));
+			}
+		}
+		ret = 0;
+		break;
+	}
+	pthread_mutex_unlock(&mmap_mutex);
+
+	if (ret < 0)
+		errno = EINVAL;
+
+	if (last.addr) {
+		if (last.writeback) {
+			mmap_writeback(&last);
+			mmap_emu_invalidate(last.path); // copies read before are stale now
+		}
+		free((void *)last.addr);
+		free(last.path);
+	}
+
+	return ret;
+}
+
+// The file is about to change, stop sharing what was read from it
+void mmap_emu_invalidate(const char *path) {
+	pthread_mutex_lock(&mmap_mutex);
+	for (int i = 0; i < MAX_MAPPINGS; i++) {
+		mmap_region *r = &regions[i];
+		if (r->addr && r->shared_ro && !strcmp(r->path, path))
+			mmap_unshare(r);
+	}
+	pthread_mutex_unlock(&mmap_mutex);
+}
+
+// Drops every cached copy, mappings still in use stay
+void mmap_emu_trim(void) {
+	pthread_mutex_lock(&mmap_mutex);
+	for (int i = 0; i < MAX_MAPPINGS; i++) {
+		mmap_region *r = &regions[i];
+		if (r->addr && !r->refs)
+			mmap_unshare(r);
+	}
+	pthread_mutex_unlock(&mmap_mutex);
+}
@@ -0,0 +1,26 @@
+#ifndef __MMAP_EMU_H__
+#define __MMAP_EMU_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Bionic's values, the game passes these through untouched
+#define MMAP_PROT_WRITE 0x2
+#define MMAP_SHARED 0x01
+#define MMAP_PRIVATE 0x02
+#define MMAP_FIXED 0x10
+#define MMAP_ANONYMOUS 0x20
+#define MMAP_FAILED ((void *)-1)
+
+#define MMAP_PAGE_SIZE 0x1000
+#define MMAP_READAHEAD (64 * 1024) // bytes read from the file per request
+#define MMAP_CACHE_MAX (8 * 1024 * 1024) // read-only mappings kept around after their last unmap
+
+void mmap_emu_open(int fd, const char *path);
+void mmap_emu_close(int fd);
+void *mmap_emu(void *addr, size_t length, int prot, int flags, int fd, int64_t offset);
+int munmap_emu(void *addr, size_t length);
+void mmap_emu_invalidate(const char *path);
+void mmap_emu_trim(void);
+
+#endif
@@ -0,0 +1,75 @@
+/* obj_pool.c -- lock-free pool of fixed-size objects
+ *
+ * Free objects form a Treiber stack whose head is swapped together with a
+ * generation tag through a 64-bit CAS (LDREXD/STREXD), so a pop racing with a
+ * pop and push of the same object can't corrupt the list. Slabs are never given
+ * back, which is what keeps reading a stale next link safe.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "obj_pool.h"
+
+typedef struct obj_pool_node {
+	struct obj_pool_node *next;
+} obj_pool_node;
+
+#define POOL_PTR(head) ((obj_pool_node *)(uintptr_t)(uint32_t)(head))
+#define POOL_TAG(head) ((uint32_t)((head) >> 32))
+#define POOL_HEAD(ptr, tag) (((uint64_t)(tag) << 32) | (uint32_t)(uintptr_t)(ptr))
+
+static void obj_pool_push(obj_pool *p, obj_pool_node *first, obj_pool_node *last) {
+	uint64_t old = __atomic_load_n(&p->head, __ATOMIC_RELAXED);
+	uint64_t head;
+	do {
+		last->next = POOL_PTR(old);
+		head = POOL_HEAD(first, POOL_TAG(old) + 1);
+	} while (!__atomic_compare_exchange_n(&p->head, &old, head, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+static obj_pool_node *obj_pool_pop(obj_pool *p) {
+	uint64_t old = __atomic_load_n(&p->head, __ATOMIC_ACQUIRE);
+	for (;;) {
+		obj_pool_node *node = POOL_PTR(old);
+		if (!node)
+			return NULL;
+		// node->next is stale if someone else got node first, the tag then fails the CAS
+		uint64_t head = POOL_HEAD(node->next, POOL_TAG(old) + 1);
+		if (__atomic_compare_exchange_n(&p->head, &old, head, 1, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+			return node;
+	}
+}
+
+// The first object of a new slab goes to the caller, the rest to the free list in one push
+static obj_pool_node *obj_pool_grow(obj_pool *p) {
+	uint8_t *slab = memalign(8, p->obj_size * OBJ_POOL_SLAB);
+	if (!slab)
+		return NULL;
+
+	for (int i = 1; i < OBJ_POOL_SLAB - 1; i++)
+		((obj_pool_node *)(slab + i * p->obj_size))->next = (obj_pool_node *)(slab + (i + 1) * p->obj_size);
+	obj_pool_push(p, (obj_pool_node *)(slab + p->obj_size), (obj_pool_node *)(slab + (OBJ_POOL_SLAB - 1) * p->obj_size));
+	__atomic_add_fetch(&p->num_slabs, 1, __ATOMIC_RELAXED);
+
+	return (obj_pool_node *)slab;
+}
+
+void *obj_pool_alloc(obj_pool *p) {
+	obj_pool_node *node = obj_pool_pop(p);
+	if (!node)
+		node = obj_pool_grow(p);
+	if (node)
+		memset(node, 0, p->obj_size);
+
+	return node;
+}
+
+void obj_pool_free(obj_pool *p, void *obj) {
+	if (obj)
+		obj_pool_push(p, obj, obj);
+}
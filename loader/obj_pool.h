@@ -0,0 +1,21 @@
+#ifndef __OBJ_POOL_H__
+#define __OBJ_POOL_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define OBJ_POOL_SLAB 64 // objects carved out of each allocation
+
+typedef struct {
+  volatile uint64_t head; // free list top in the low word, ABA tag in the high one
+  size_t obj_size;
+  int num_slabs;
+} obj_pool;
+
+// Every object also has to hold a free list link while it's free
+#define OBJ_POOL(size) { 0, ((size) + 7) & ~7, 0 }
+
+void *obj_pool_alloc(obj_pool *p);
+void obj_pool_free(obj_pool *p, void *obj);
+
+#endif
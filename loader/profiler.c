@@ -0,0 +1,123 @@
+/* profiler.c -- sampling profiler over the import call sites of a module
+ *
+ * Userland can't read another thread's registers, so samples come from the
+ * counting thunks instead: every profiled import call leaves its return address
+ * and import index in so_last_import, and a timer thread takes them out. Each
+ * sample is the calling game function plus the shim it went into, which is what
+ * the folded output (caller;import count) is made of. An interval without any
+ * import call gives no sample rather than counting the previous one again.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <vitasdk.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+#include "profiler.h"
+
+#define PROFILER_SLOTS 4096 // distinct caller/import pairs kept
+
+typedef struct {
+	uintptr_t caller; // function start, 0 for code outside any loaded module
+	uint32_t import; // default_dynlib index + 1, 0 for an empty slot
+	uint32_t count;
+} profiler_slot;
+
+static struct {
+	so_module *mod;
+	profiler_slot *slots;
+	int interval;
+	volatile int running;
+	int samples, dropped;
+	pthread_t thread;
+} prof;
+
+static void profiler_record(uintptr_t lr, uint32_t import) {
+	const symtab_entry *e = so_addr_symbol(lr, NULL);
+	uintptr_t caller = e ? e->addr : 0;
+
+	uint32_t hash = (caller >> 1) * 2654435761u ^ import;
+	for (int i = 0; i < PROFILER_SLOTS; i++) {
+		profiler_slot *slot = &prof.slots[(hash + i) & (PROFILER_SLOTS - 1)];
+		if (slot->import == 0) {
+			slot->caller = caller;
+			slot->import = import + 1;
+		}
+		if (slot->caller == caller && slot->import == import + 1) {
+			slot->count++;
+			prof.samples++;
+			return;
+		}
+	}
+	prof.dropped++;
+}
+
+static void *profiler_thread(void *arg) {
+	while (prof.running) {
+		uint64_t last = __atomic_exchange_n(&so_last_import, 0, __ATOMIC_RELAXED);
+		uint32_t lr = (uint32_t)last;
+		uint32_t import = (uint32_t)(last >> 32);
+		if (lr && import < prof.mod->size_dynlib / sizeof(so_default_dynlib))
+			profiler_record(lr, import);
+		sceKernelDelayThread(prof.interval);
+	}
+	return NULL;
+}
+
+int profiler_start(so_module *mod, int interval_us) {
+	if (prof.running)
+		return 0;
+
+	prof.mod = mod;
+	prof.interval = interval_us;
+	prof.slots = calloc(PROFILER_SLOTS, sizeof(profiler_slot));
+	if (!prof.slots || so_addr_index_build() < 0) {
+		free(prof.slots);
+		prof.slots = NULL;
+		return -1;
+	}
+
+	prof.running = 1;
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, 64 * 1024);
+	if (pthread_create(&prof.thread, &attr, profiler_thread, NULL) != 0) {
+		prof.running = 0;
+		return -1;
+	}
+
+	return 0;
+}
+
+void profiler_stop(void) {
+	if (!prof.running)
+		return;
+	prof.running = 0;
+	pthread_join(prof.thread, NULL);
+}
+
+int profiler_dump(const char *path) {
+	if (!prof.slots || !prof.mod->dynlib)
+		return -1;
+
+	FILE *f = fopen(path, "w");
+	if (!f)
+		return -1;
+
+	for (int i = 0; i < PROFILER_SLOTS; i++) {
+		profiler_slot *slot = &prof.slots[i];
+		if (slot->import == 0)
+			continue;
+		const symtab_entry *e = slot->caller ? so_addr_symbol(slot->caller, NULL) : NULL;
+		fprintf(f, "%s;%s %u\n", e ? e->name : "[external]", prof.mod->dynlib[slot->import - 1].symbol, slot->count);
+	}
+	fclose(f);
+
+	debugPrintf("profiler: %d samples, %d dropped\n", prof.samples, prof.dropped);
+	return 0;
+}
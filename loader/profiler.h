@@ -0,0 +1,10 @@
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include "so_util.h"
+
+int profiler_start(so_module *mod, int interval_us);
+void profiler_stop(void);
+int profiler_dump(const char *path);
+
+#endif
@@ -0,0 +1,69 @@
+/* pthread_static.c -- lazy objects behind Bionic's static pthread initializers
+ *
+ * Bionic's static initializers leave a type tag where the object pointer goes.
+ * The first thread to use one swaps in a real object with a CAS, and threads
+ * that raced it give theirs back to the pool and use the winner's.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include "pthread_static.h"
+
+// glibc only has these as _NP extensions, for the host build
+#if !defined(PTHREAD_RECURSIVE_MUTEX_INITIALIZER) && defined(PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP)
+#define PTHREAD_RECURSIVE_MUTEX_INITIALIZER PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP
+#define PTHREAD_ERRORCHECK_MUTEX_INITIALIZER PTHREAD_ERRORCHECK_MUTEX_INITIALIZER_NP
+#endif
+
+obj_pool pthread_pool = OBJ_POOL(sizeof(pthread_obj));
+
+pthread_mutex_t *init_static_mutex_slow(pthread_mutex_t **mutex, pthread_mutex_t *type) {
+	static const pthread_mutex_t init_normal = PTHREAD_MUTEX_INITIALIZER;
+	static const pthread_mutex_t init_recursive = PTHREAD_RECURSIVE_MUTEX_INITIALIZER;
+	static const pthread_mutex_t init_errorcheck = PTHREAD_ERRORCHECK_MUTEX_INITIALIZER;
+	const pthread_mutex_t *init;
+
+	switch ((uintptr_t)type) {
+	case MUTEX_TYPE_NORMAL:
+		init = &init_normal;
+		break;
+	case MUTEX_TYPE_RECURSIVE:
+		init = &init_recursive;
+		break;
+	case MUTEX_TYPE_ERRORCHECK:
+		init = &init_errorcheck;
+		break;
+	default:
+		return type;
+	}
+
+	pthread_mutex_t *mtx = obj_pool_alloc(&pthread_pool);
+	if (!mtx)
+		return NULL;
+	*mtx = *init;
+
+	if (!__atomic_compare_exchange_n(mutex, &type, mtx, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+		obj_pool_free(&pthread_pool, mtx);
+		return type;
+	}
+
+	return mtx;
+}
+
+pthread_cond_t *init_static_cond_slow(pthread_cond_t **cond) {
+	static const pthread_cond_t init = PTHREAD_COND_INITIALIZER;
+
+	pthread_cond_t *c = obj_pool_alloc(&pthread_pool);
+	if (!c)
+		return NULL;
+	*c = init;
+
+	pthread_cond_t *expected = NULL;
+	if (!__atomic_compare_exchange_n(cond, &expected, c, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+		obj_pool_free(&pthread_pool, c);
+		return expected;
+	}
+
+	return c;
+}
@@ -0,0 +1,43 @@
+#ifndef __PTHREAD_STATIC_H__
+#define __PTHREAD_STATIC_H__
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "obj_pool.h"
+
+// Tags Bionic's static initializers leave where our object pointer goes
+#define  MUTEX_TYPE_NORMAL	 0x0000
+#define  MUTEX_TYPE_RECURSIVE  0x4000
+#define  MUTEX_TYPE_ERRORCHECK 0x8000
+
+// The game creates and destroys sync objects all the time, they all come out of one pool
+typedef union {
+  pthread_mutex_t mutex;
+  pthread_mutexattr_t mutexattr;
+  pthread_cond_t cond;
+  pthread_condattr_t condattr;
+  pthread_attr_t attr;
+} pthread_obj;
+
+extern obj_pool pthread_pool;
+
+pthread_mutex_t *init_static_mutex_slow(pthread_mutex_t **mutex, pthread_mutex_t *type);
+pthread_cond_t *init_static_cond_slow(pthread_cond_t **cond);
+
+// Already initialized is the common case, one load and one predicted branch
+static inline pthread_mutex_t *init_static_mutex(pthread_mutex_t **mutex) {
+  pthread_mutex_t *mtx = __atomic_load_n(mutex, __ATOMIC_ACQUIRE);
+  if (__builtin_expect((uintptr_t)mtx > MUTEX_TYPE_ERRORCHECK, 1))
+    return mtx;
+  return init_static_mutex_slow(mutex, mtx);
+}
+
+static inline pthread_cond_t *init_static_cond(pthread_cond_t **cond) {
+  pthread_cond_t *c = __atomic_load_n(cond, __ATOMIC_ACQUIRE);
+  if (__builtin_expect(c != NULL, 1))
+    return c;
+  return init_static_cond_slow(cond);
+}
+
+#endif
@@ -0,0 +1,409 @@
+/* slab.c -- thread cached size-class allocator for small objects
+ *
+ * Requests up to SLAB_MAX bytes are rounded to one of a few size classes and
+ * carved out of 64 KB spans taken from vitaGL. Each thread keeps a magazine of
+ * free objects per class, so most allocs and frees touch no lock at all; full
+ * and empty magazines are traded with a per-class depot. A page map with one
+ * byte per 64 KB of address space tells slab pointers apart from vitaGL ones.
+ *
+ * Thread caches are kept on a list so the magazines of threads that went away
+ * without calling slab_thread_exit (native threads, pthread_exit) can be reaped.
+ * slab_trim gives spans whose objects are all back in the depot to vitaGL.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <vitasdk.h>
+#include <vitaGL.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+
+#include "main.h"
+#include "slab.h"
+
+#define SLAB_SPAN_SHIFT 16
+#define SLAB_SPAN (1 << SLAB_SPAN_SHIFT)
+#define SLAB_MAG 32 // objects per magazine
+#define SLAB_CLASSES 20
+
+static const uint16_t class_size[SLAB_CLASSES] = {
+	16, 32, 48, 64, 80, 96, 112, 128,
+	160, 192, 224, 256,
+	320, 384, 448, 512,
+	640, 768, 896, 1024,
+};
+
+static uint8_t size_class[SLAB_MAX / SLAB_ALIGN + 1];
+static uint8_t span_map[1 << (32 - SLAB_SPAN_SHIFT)]; // size class + 1, 0 if not a slab span
+
+typedef struct slab_magazine {
+	struct slab_magazine *next;
+	int count;
+	void *objs[SLAB_MAG];
+} slab_magazine;
+
+// Objects that couldn't go back into a magazine, linked through their first word
+typedef struct slab_loose {
+	struct slab_loose *next;
+} slab_loose;
+
+typedef struct {
+	SceKernelLwMutexWork lock;
+	slab_magazine *full, *empty;
+	slab_loose *loose;
+	uintptr_t cur, end; // uncarved part of the newest span
+	int num_spans;
+} slab_depot;
+
+typedef struct slab_cache {
+	struct slab_cache *next;
+	SceUID thid; // 0 once its thread is gone and the magazines went back to the depots
+	slab_magazine *mags[SLAB_CLASSES];
+} slab_cache;
+
+static slab_depot depots[SLAB_CLASSES];
+static SceKernelLwMutexWork caches_lock;
+static slab_cache *caches = NULL;
+static __thread slab_cache *cache;
+static int slab_ready = 0;
+
+void slab_init(void) {
+	for (int c = 0, s = 0; s <= SLAB_MAX / SLAB_ALIGN; s++) {
+		if (s * SLAB_ALIGN > class_size[c])
+			c++;
+		size_class[s] = c;
+	}
+
+	for (int c = 0; c < SLAB_CLASSES; c++)
+		sceKernelCreateLwMutex(&depots[c].lock, "slab depot", 0, 0, NULL);
+	sceKernelCreateLwMutex(&caches_lock, "slab caches", 0, 0, NULL);
+
+	slab_ready = 1;
+}
+
+static int thread_gone(SceUID thid) {
+	SceKernelThreadInfo info;
+	info.size = sizeof(info);
+	return sceKernelGetThreadInfo(thid, &info) < 0;
+}
+
+// Partially filled magazines count as full
+static void slab_return_mags(slab_cache *t) {
+	for (int c = 0; c < SLAB_CLASSES; c++) {
+		slab_magazine *m = t->mags[c];
+		if (!m)
+			continue;
+		slab_depot *d = &depots[c];
+		sceKernelLockLwMutex(&d->lock, 1, NULL);
+		if (m->count) {
+			m->next = d->full;
+			d->full = m;
+		} else {
+			m->next = d->empty;
+			d->empty = m;
+		}
+		sceKernelUnlockLwMutex(&d->lock, 1);
+		t->mags[c] = NULL;
+	}
+}
+
+// First slab use on a thread: take over the cache of a thread that's gone, magazines and all
+static __attribute__((noinline)) slab_cache *slab_attach(void) {
+	SceUID thid = sceKernelGetThreadId();
+	slab_cache *t;
+
+	sceKernelLockLwMutex(&caches_lock, 1, NULL);
+	for (t = caches; t; t = t->next) {
+		if (!t->thid || thread_gone(t->thid))
+			break;
+	}
+	if (!t && (t = vglMalloc(sizeof(slab_cache))) != NULL) {
+		memset(t, 0, sizeof(slab_cache));
+		t->next = caches;
+		caches = t;
+	}
+	if (t)
+		t->thid = thid;
+	sceKernelUnlockLwMutex(&caches_lock, 1);
+
+	cache = t;
+	return t;
+}
+
+static void slab_reap(void) {
+	sceKernelLockLwMutex(&caches_lock, 1, NULL);
+	for (slab_cache *t = caches; t; t = t->next) {
+		if (t->thid && thread_gone(t->thid)) {
+			slab_return_mags(t);
+			t->thid = 0;
+		}
+	}
+	sceKernelUnlockLwMutex(&caches_lock, 1);
+}
+
+// Fills m from loose objects first, then from the current span, taking a new span when it runs out
+static void slab_carve(slab_depot *d, int c, slab_magazine *m) {
+	while (m->count < SLAB_MAG && d->loose) {
+		m->objs[m->count++] = d->loose;
+		d->loose = d->loose->next;
+	}
+
+	while (m->count < SLAB_MAG) {
+		if (d->cur == d->end) {
+			uintptr_t span = (uintptr_t)vglMemalign(SLAB_SPAN, SLAB_SPAN);
+			if (!span)
+				return;
+			span_map[span >> SLAB_SPAN_SHIFT] = c + 1;
+			d->cur = span;
+			d->end = span + (SLAB_SPAN / class_size[c]) * class_size[c];
+			d->num_spans++;
+		}
+		m->objs[m->count++] = (void *)d->cur;
+		d->cur += class_size[c];
+	}
+}
+
+static __attribute__((noinline)) void *slab_refill(int c) {
+	slab_cache *t = cache ? cache : slab_attach();
+	if (!t)
+		return NULL;
+	slab_depot *d = &depots[c];
+	slab_magazine *m = t->mags[c];
+
+	// A cache taken over from a dead thread can come with objects, they'd be lost on the empty list
+	if (m && m->count)
+		return m->objs[--m->count];
+
+	sceKernelLockLwMutex(&d->lock, 1, NULL);
+	if (d->full) {
+		slab_magazine *full = d->full;
+		d->full = full->next;
+		if (m) {
+			m->next = d->empty;
+			d->empty = m;
+		}
+		m = full;
+	} else {
+		if (!m && d->empty) {
+			m = d->empty;
+			d->empty = m->next;
+		}
+		if (!m) {
+			m = vglMalloc(sizeof(slab_magazine));
+			if (m)
+				m->count = 0;
+		}
+		if (m)
+			slab_carve(d, c, m);
+	}
+	sceKernelUnlockLwMutex(&d->lock, 1);
+
+	t->mags[c] = m;
+	if (!m || m->count == 0)
+		return NULL;
+	return m->objs[--m->count];
+}
+
+static __attribute__((noinline)) void slab_flush(int c, void *ptr) {
+	slab_cache *t = cache ? cache : slab_attach();
+	slab_depot *d = &depots[c];
+	slab_magazine *m = t ? t->mags[c] : NULL;
+
+	sceKernelLockLwMutex(&d->lock, 1, NULL);
+	if (!t) {
+		slab_loose *l = ptr;
+		l->next = d->loose;
+		d->loose = l;
+		sceKernelUnlockLwMutex(&d->lock, 1);
+		return;
+	}
+	if (m) {
+		m->next = d->full;
+		d->full = m;
+	}
+	m = d->empty;
+	if (m)
+		d->empty = m->next;
+	else if ((m = vglMalloc(sizeof(slab_magazine))) == NULL) {
+		slab_loose *l = ptr;
+		l->next = d->loose;
+		d->loose = l;
+	}
+	sceKernelUnlockLwMutex(&d->lock, 1);
+
+	t->mags[c] = m;
+	if (m) {
+		m->count = 0;
+		m->objs[m->count++] = ptr;
+	}
+}
+
+void *slab_alloc(size_t size) {
+	if (size > SLAB_MAX || !slab_ready)
+		return NULL;
+
+	int c = size_class[(size + SLAB_ALIGN - 1) / SLAB_ALIGN];
+	slab_cache *t = cache;
+	slab_magazine *m = t ? t->mags[c] : NULL;
+	if (__builtin_expect(m && m->count, 1))
+		return m->objs[--m->count];
+	return slab_refill(c);
+}
+
+// Returns 0 if ptr isn't a slab object, so the caller can hand it to vitaGL
+int slab_free(void *ptr) {
+	int c = span_map[(uintptr_t)ptr >> SLAB_SPAN_SHIFT] - 1;
+	if (c < 0)
+		return 0;
+
+	slab_cache *t = cache;
+	slab_magazine *m = t ? t->mags[c] : NULL;
+	if (__builtin_expect(m && m->count < SLAB_MAG, 1))
+		m->objs[m->count++] = ptr;
+	else
+		slab_flush(c, ptr);
+	return 1;
+}
+
+size_t slab_usable_size(void *ptr) {
+	int c = span_map[(uintptr_t)ptr >> SLAB_SPAN_SHIFT] - 1;
+	return c < 0 ? 0 : class_size[c];
+}
+
+// Hands a finished thread's magazines to the depots and frees its cache for the next thread
+void slab_thread_exit(void) {
+	slab_cache *t = cache;
+	if (!t)
+		return;
+	slab_return_mags(t);
+	sceKernelLockLwMutex(&caches_lock, 1, NULL);
+	t->thid = 0;
+	sceKernelUnlockLwMutex(&caches_lock, 1);
+	cache = NULL;
+}
+
+/*
+ * slab_release_spans: gives back the spans of a class whose objects are all free.
+ * Only what sits in the depot is known to be free, so a span with an object in some
+ * live thread's magazine stays. free_objs covers span indices lo and up and must be
+ * zero for the class's spans; it's left that way. Call with the depot locked.
+*/
+static void slab_release_spans(slab_depot *d, int c, uint16_t *free_objs, int lo, int hi) {
+	const uint16_t released = 0xffff;
+	int per_span = SLAB_SPAN / class_size[c];
+	int num_released = 0;
+
+	for (slab_magazine *m = d->full; m; m = m->next) {
+		for (int i = 0; i < m->count; i++)
+			free_objs[((uintptr_t)m->objs[i] >> SLAB_SPAN_SHIFT) - lo]++;
+	}
+	for (slab_loose *l = d->loose; l; l = l->next)
+		free_objs[((uintptr_t)l >> SLAB_SPAN_SHIFT) - lo]++;
+	if (d->cur != d->end)
+		free_objs[((d->end - 1) >> SLAB_SPAN_SHIFT) - lo] += (d->end - d->cur) / class_size[c];
+
+	for (int s = lo; s <= hi; s++) {
+		if (span_map[s] != c + 1)
+			continue;
+		if (free_objs[s - lo] == per_span) {
+			free_objs[s - lo] = released;
+			num_released++;
+		} else {
+			free_objs[s - lo] = 0;
+		}
+	}
+	if (!num_released)
+		return;
+
+	// Take the released spans' objects off the free lists before the memory goes
+	slab_magazine **mp = &d->full;
+	while (*mp) {
+		slab_magazine *m = *mp;
+		int n = 0;
+		for (int i = 0; i < m->count; i++) {
+			if (free_objs[((uintptr_t)m->objs[i] >> SLAB_SPAN_SHIFT) - lo] != released)
+				m->objs[n++] = m->objs[i];
+		}
+		m->count = n;
+		if (n) {
+			mp = &m->next;
+		} else {
+			*mp = m->next;
+			m->next = d->empty;
+			d->empty = m;
+		}
+	}
+	slab_loose **lp = &d->loose;
+	while (*lp) {
+		if (free_objs[((uintptr_t)*lp >> SLAB_SPAN_SHIFT) - lo] == released)
+			*lp = (*lp)->next;
+		else
+			lp = &(*lp)->next;
+	}
+	if (d->end && free_objs[((d->end - 1) >> SLAB_SPAN_SHIFT) - lo] == released)
+		d->cur = d->end = 0;
+
+	for (int s = lo; s <= hi; s++) {
+		if (span_map[s] == c + 1 && free_objs[s - lo] == released) {
+			span_map[s] = 0;
+			vglFree((void *)((uintptr_t)s << SLAB_SPAN_SHIFT));
+			free_objs[s - lo] = 0;
+			d->num_spans--;
+		}
+	}
+}
+
+// Reaps dead threads' magazines, then returns free spans and empty magazines to vitaGL
+// Hands back empty magazines and, with free_objs, every span with nothing allocated from it
+static void slab_trim_depots(uint16_t *free_objs, int lo, int hi) {
+	for (int c = 0; c < SLAB_CLASSES; c++) {
+		slab_depot *d = &depots[c];
+		sceKernelLockLwMutex(&d->lock, 1, NULL);
+		if (free_objs)
+			slab_release_spans(d, c, free_objs, lo, hi);
+		slab_magazine *m = d->empty;
+		d->empty = NULL;
+		sceKernelUnlockLwMutex(&d->lock, 1);
+
+		while (m) {
+			slab_magazine *next = m->next;
+			vglFree(m);
+			m = next;
+		}
+	}
+}
+
+// Cheap: magazines of dead threads go back to the depots, empty ones get freed
+void slab_trim_magazines(void) {
+	slab_reap();
+	slab_trim_depots(NULL, 0, -1);
+}
+
+void slab_trim(void) {
+	int lo = INT_MAX, hi = -1;
+
+	slab_reap();
+
+	for (int s = 0; s < (int)sizeof(span_map); s++) {
+		if (span_map[s]) {
+			if (s < lo)
+				lo = s;
+			hi = s;
+		}
+	}
+	uint16_t *free_objs = hi >= lo ? vglCalloc(hi - lo + 1, sizeof(uint16_t)) : NULL;
+
+	slab_trim_depots(free_objs, lo, hi);
+
+	if (free_objs)
+		vglFree(free_objs);
+}
+
+void slab_stats(void) {
+	int num_spans = 0;
+	for (int c = 0; c < SLAB_CLASSES; c++)
+		num_spans += depots[c].num_spans;
+	debugPrintf("slab: %d spans, %d KB\n", num_spans, num_spans * (SLAB_SPAN / 1024));
+}
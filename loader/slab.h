@@ -0,0 +1,18 @@
+#ifndef __SLAB_H__
+#define __SLAB_H__
+
+#include <stddef.h>
+
+#define SLAB_MAX 1024 // largest request served from the slabs
+#define SLAB_ALIGN 16 // every slab object is aligned to this
+
+void slab_init(void);
+void slab_thread_exit(void);
+void *slab_alloc(size_t size);
+int slab_free(void *ptr);
+size_t slab_usable_size(void *ptr);
+void slab_trim_magazines(void);
+void slab_trim(void);
+void slab_stats(void);
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef __SO_BACKEND_H__
+#define __SO_BACKEND_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Everything so_util needs from the platform to map, patch and time a module
+typedef struct so_backend {
+  // Maps size bytes at addr (0: anywhere), returns a block id or < 0 on failure
+  int (*alloc)(const char *name, size_t size, uintptr_t addr, int exec, uintptr_t *base);
+  void (*free)(int blockid);
+  // memcpy that can also target exec blocks, which may not be writable directly
+  void (*code_memcpy)(void *dst, const void *src, size_t size);
+  void (*flush)(void *addr, size_t size);
+  uint64_t (*time)(void); // microseconds
+  // Last resort for imports no table provides, may be NULL
+  void *(*get_proc)(const char *symbol);
+} so_backend;
+
+extern const so_backend so_vita_backend;
+extern const so_backend so_posix_backend; // mmap based, for host builds
+
+void so_set_backend(const so_backend *b);
+
+#endif
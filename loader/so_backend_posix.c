@@ -0,0 +1,125 @@
+/* so_backend_posix.c -- mmap backed memory for so_util on Linux hosts
+ *
+ * Lets the ELF parsing, relocation and symbol lookup code run on a dev box. Exec
+ * blocks are mapped read+exec and only made writable for the length of a
+ * code_memcpy, the same way they're only writable through kubridge on the Vita.
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <sys/mman.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "so_backend.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+#define MAX_BLOCKS 64
+
+static struct {
+	uintptr_t base; // 0 for a free slot
+	size_t size;
+	int exec;
+} blocks[MAX_BLOCKS];
+static pthread_mutex_t blocks_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int posix_alloc(const char *name, size_t size, uintptr_t addr, int exec, uintptr_t *base) {
+	int prot = PROT_READ | (exec ? PROT_EXEC : PROT_WRITE);
+	int flags = MAP_PRIVATE | MAP_ANONYMOUS | (addr ? MAP_FIXED_NOREPLACE : 0);
+
+	void *mem = mmap((void *)addr, size, prot, flags, -1, 0);
+	if (mem == MAP_FAILED)
+		return -1;
+	// Kernels before 4.17 take MAP_FIXED_NOREPLACE as a hint
+	if (addr && (uintptr_t)mem != addr) {
+		munmap(mem, size);
+		return -1;
+	}
+
+	pthread_mutex_lock(&blocks_mutex);
+	int blockid = -1;
+	for (int i = 0; i < MAX_BLOCKS; i++) {
+		if (!blocks[i].base) {
+			blocks[i].base = (uintptr_t)mem;
+			blocks[i].size = size;
+			blocks[i].exec = exec;
+			blockid = i + 1;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&blocks_mutex);
+
+	if (blockid < 0) {
+		munmap(mem, size);
+		return -1;
+	}
+
+	*base = (uintptr_t)mem;
+	return blockid;
+}
+
+static void posix_free(int blockid) {
+	if (blockid < 1 || blockid > MAX_BLOCKS)
+		return;
+
+	pthread_mutex_lock(&blocks_mutex);
+	uintptr_t base = blocks[blockid - 1].base;
+	size_t size = blocks[blockid - 1].size;
+	blocks[blockid - 1].base = 0;
+	pthread_mutex_unlock(&blocks_mutex);
+
+	if (base)
+		munmap((void *)base, size);
+}
+
+static void posix_code_memcpy(void *dst, const void *src, size_t size) {
+	uintptr_t start = (uintptr_t)dst, end = start + size;
+	uintptr_t page_mask = ~((uintptr_t)sysconf(_SC_PAGESIZE) - 1);
+	int exec = 0;
+
+	pthread_mutex_lock(&blocks_mutex);
+	for (int i = 0; i < MAX_BLOCKS; i++) {
+		if (blocks[i].base && blocks[i].exec && start < blocks[i].base + blocks[i].size && end > blocks[i].base) {
+			exec = 1;
+			break;
+		}
+	}
+
+	if (exec) {
+		// Still under the lock, so two writers can't make a page read-only under each other
+		void *page = (void *)(start & page_mask);
+		size_t len = ((end + ~page_mask) & page_mask) - (start & page_mask);
+		mprotect(page, len, PROT_READ | PROT_WRITE);
+		memcpy(dst, src, size);
+		mprotect(page, len, PROT_READ | PROT_EXEC);
+	} else {
+		memcpy(dst, src, size);
+	}
+	pthread_mutex_unlock(&blocks_mutex);
+}
+
+static void posix_flush(void *addr, size_t size) {
+	__builtin___clear_cache((char *)addr, (char *)addr + size);
+}
+
+static uint64_t posix_time(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// No get_proc: host libraries can't stand in for the Android ones a module imports
+const so_backend so_posix_backend = {
+	.alloc = posix_alloc,
+	.free = posix_free,
+	.code_memcpy = posix_code_memcpy,
+	.flush = posix_flush,
+	.time = posix_time,
+	.get_proc = NULL,
+};
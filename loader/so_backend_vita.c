@@ -0,0 +1,59 @@
+/* so_backend_vita.c -- kubridge backed memory for so_util
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <vitasdk.h>
+#include <kubridge.h>
+#include <vitaGL.h>
+
+#include <string.h>
+
+#include "so_backend.h"
+
+#ifndef SCE_KERNEL_MEMBLOCK_TYPE_USER_RX
+#define SCE_KERNEL_MEMBLOCK_TYPE_USER_RX                 (0x0C20D050)
+#endif
+
+static int vita_alloc(const char *name, size_t size, uintptr_t addr, int exec, uintptr_t *base) {
+	SceKernelAllocMemBlockKernelOpt opt;
+	memset(&opt, 0, sizeof(SceKernelAllocMemBlockKernelOpt));
+	opt.size = sizeof(SceKernelAllocMemBlockKernelOpt);
+	if (addr) {
+		opt.attr = 0x1;
+		opt.field_C = (SceUInt32)addr;
+	}
+
+	SceUID blockid = kuKernelAllocMemBlock(name, exec ? SCE_KERNEL_MEMBLOCK_TYPE_USER_RX : SCE_KERNEL_MEMBLOCK_TYPE_USER_RW, size, &opt);
+	if (blockid < 0)
+		return blockid;
+
+	sceKernelGetMemBlockBase(blockid, (void **)base);
+	return blockid;
+}
+
+static void vita_free(int blockid) {
+	sceKernelFreeMemBlock(blockid);
+}
+
+static void vita_code_memcpy(void *dst, const void *src, size_t size) {
+	kuKernelCpuUnrestrictedMemcpy(dst, src, size);
+}
+
+static void vita_flush(void *addr, size_t size) {
+	kuKernelFlushCaches(addr, size);
+}
+
+static uint64_t vita_time(void) {
+	return sceKernelGetProcessTimeWide();
+}
+
+const so_backend so_vita_backend = {
+	.alloc = vita_alloc,
+	.free = vita_free,
+	.code_memcpy = vita_code_memcpy,
+	.flush = vita_flush,
+	.time = vita_time,
+	.get_proc = vglGetProcAddress,
+};
@@ -7,7 +7,7 @@
  */
 
 #include <vitasdk.h>
-#include <kubridge.h>
+#include <pthread.h>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,10 +16,9 @@
 #include "main.h"
 #include "dialog.h"
 #include "so_util.h"
-
-#ifndef SCE_KERNEL_MEMBLOCK_TYPE_USER_RX
-#define SCE_KERNEL_MEMBLOCK_TYPE_USER_RX                 (0x0C20D050)
-#endif
+#include "sha1.h"
+#include "insn_reloc.h"
+#include "so_backend.h"
 
 typedef struct b_enc {
 	union {
@@ -58,6 +57,338 @@ typedef struct ldst_enc {
 
 #define PATCH_SZ 0x10000 //64 KB-ish arenas
 static so_module *head = NULL, *tail = NULL;
+#ifdef __vita__
+static const so_backend *backend = &so_vita_backend;
+#else
+static const so_backend *backend = &so_posix_backend;
+#endif
+
+static uintptr_t so_alloc_arena(so_module *so, uintptr_t range, uintptr_t dst, size_t sz);
+static int so_island_region_add(so_module *so, SceUID blockid, uintptr_t base, size_t size);
+static void so_island_region_free_all(so_module *so);
+static void so_global_index_free(void);
+
+/*
+ * address index: the text, data, GOT and island ranges of every loaded module,
+ * sorted and non-overlapping so an address maps back to its owner with a binary
+ * search. Loading a module or adding an island region marks it for a rebuild.
+*/
+static struct {
+	so_range *ranges;
+	int num_ranges;
+	int dirty;
+} addr_index = { .dirty = 1 };
+
+static void so_addr_index_add(so_module *mod, uintptr_t start, uintptr_t end, int kind) {
+	if (start >= end)
+		return;
+	so_range *r = &addr_index.ranges[addr_index.num_ranges++];
+	r->start = start;
+	r->end = end;
+	r->mod = mod;
+	r->kind = kind;
+}
+
+static int so_range_cmp(const void *a, const void *b) {
+	const so_range *ra = a, *rb = b;
+	return ra->start < rb->start ? -1 : ra->start > rb->start;
+}
+
+// Span of the GOT slots the loader writes to, taken from DT_PLTGOT and the relocations
+static void so_got_range(so_module *mod, uintptr_t *start, uintptr_t *end) {
+	uintptr_t lo = UINTPTR_MAX, hi = 0;
+
+	for (int i = 0; i < mod->num_dynamic; i++) {
+		if (mod->dynamic[i].d_tag == DT_PLTGOT) {
+			lo = mod->text_base + mod->dynamic[i].d_un.d_ptr;
+			hi = lo + 3 * sizeof(uintptr_t); // GOT[0..2] are reserved
+		}
+	}
+
+	for (int i = 0; i < mod->num_reldyn + mod->num_relplt; i++) {
+		Elf32_Rel *rel = i < mod->num_reldyn ? &mod->reldyn[i] : &mod->relplt[i - mod->num_reldyn];
+		int type = ELF32_R_TYPE(rel->r_info);
+		if (type != R_ARM_JUMP_SLOT && type != R_ARM_GLOB_DAT)
+			continue;
+		uintptr_t slot = mod->text_base + rel->r_offset;
+		if (slot < lo)
+			lo = slot;
+		if (slot + sizeof(uintptr_t) > hi)
+			hi = slot + sizeof(uintptr_t);
+	}
+
+	*start = lo < hi ? lo : 0;
+	*end = lo < hi ? hi : 0;
+}
+
+int so_addr_index_build(void) {
+	int max_ranges = 0;
+	for (so_module *curr = head; curr; curr = curr->next)
+		max_ranges += 1 + curr->n_data + 2 + curr->num_regions;
+
+	so_range *ranges = realloc(addr_index.ranges, max_ranges * sizeof(so_range) + 1);
+	if (!ranges)
+		return -1;
+	addr_index.ranges = ranges;
+	addr_index.num_ranges = 0;
+
+	for (so_module *curr = head; curr; curr = curr->next) {
+		if (!curr->syms.entries)
+			symtab_build(&curr->syms, curr->dynsym, curr->num_dynsym, curr->dynstr, curr->text_base);
+
+		so_addr_index_add(curr, curr->text_base, curr->text_base + curr->text_size, SO_RANGE_TEXT);
+
+		// The GOT is carved out of whichever data segment holds it
+		uintptr_t got_start, got_end;
+		so_got_range(curr, &got_start, &got_end);
+		for (int i = 0; i < curr->n_data; i++) {
+			uintptr_t start = curr->data_base[i], end = start + curr->data_size[i];
+			if (got_start >= start && got_end <= end && got_start < got_end) {
+				so_addr_index_add(curr, start, got_start, SO_RANGE_DATA);
+				so_addr_index_add(curr, got_start, got_end, SO_RANGE_GOT);
+				start = got_end;
+			}
+			so_addr_index_add(curr, start, end, SO_RANGE_DATA);
+		}
+
+		// The .text padding cave starts at text_size, so it's indexed like any other region
+		for (int i = 0; i < curr->num_regions; i++)
+			so_addr_index_add(curr, curr->regions[i].base, curr->regions[i].base + curr->regions[i].size, SO_RANGE_ISLAND);
+	}
+
+	qsort(addr_index.ranges, addr_index.num_ranges, sizeof(so_range), so_range_cmp);
+	addr_index.dirty = 0;
+
+	return 0;
+}
+
+const so_range *so_addr_range(uintptr_t addr) {
+	if (addr_index.dirty && so_addr_index_build() < 0)
+		return NULL;
+
+	int lo = 0, hi = addr_index.num_ranges - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		so_range *r = &addr_index.ranges[mid];
+		if (addr < r->start)
+			hi = mid - 1;
+		else if (addr >= r->end)
+			lo = mid + 1;
+		else
+			return r;
+	}
+
+	return NULL;
+}
+
+// Function containing a code address, and the module it belongs to
+const symtab_entry *so_addr_symbol(uintptr_t addr, so_module **mod) {
+	const so_range *r = so_addr_range(addr);
+	if (mod)
+		*mod = r ? r->mod : NULL;
+	if (!r || r->kind != SO_RANGE_TEXT)
+		return NULL;
+
+	return symtab_lookup(&r->mod->syms, addr);
+}
+
+static so_module *so_find_text_module(uintptr_t addr) {
+	const so_range *r = so_addr_range(addr);
+	return r && r->kind == SO_RANGE_TEXT ? r->mod : NULL;
+}
+
+/*
+ * hook transactions: while one is open, every write the hooking code makes to
+ * text or to the arenas is queued. so_hook_commit then applies the queue with a
+ * single write per touched page and flushes only the dirty cache lines. The
+ * bytes each committed write replaced go to an undo log for so_hook_revert.
+*/
+#define SO_PAGE_SIZE 0x1000
+#define SO_CACHE_LINE 32
+
+typedef struct {
+	uintptr_t addr;
+	size_t size;
+	size_t offs; // into the data pool
+	int seq; // queue order, later writes win
+} so_patch;
+
+typedef struct {
+	so_patch *patches;
+	int num_patches, max_patches;
+	uint8_t *pool;
+	size_t pool_size, pool_max;
+} so_patch_log;
+
+static int txn_open = 0;
+static so_patch_log txn, undo;
+
+static int so_patch_log_add(so_patch_log *log, uintptr_t addr, const void *data, size_t size) {
+	if (log->num_patches == log->max_patches) {
+		int max = log->max_patches ? log->max_patches * 2 : 64;
+		so_patch *patches = realloc(log->patches, max * sizeof(so_patch));
+		if (!patches)
+			return -1;
+		log->patches = patches;
+		log->max_patches = max;
+	}
+	if (log->pool_size + size > log->pool_max) {
+		size_t max = log->pool_max ? log->pool_max * 2 : 1024;
+		while (max < log->pool_size + size)
+			max *= 2;
+		uint8_t *pool = realloc(log->pool, max);
+		if (!pool)
+			return -1;
+		log->pool = pool;
+		log->pool_max = max;
+	}
+
+	so_patch *p = &log->patches[log->num_patches];
+	p->addr = addr;
+	p->size = size;
+	p->offs = log->pool_size;
+	p->seq = log->num_patches++;
+	sceClibMemcpy(log->pool + log->pool_size, data, size);
+	log->pool_size += size;
+	return 0;
+}
+
+static void so_patch_log_free(so_patch_log *log) {
+	free(log->patches);
+	free(log->pool);
+	memset(log, 0, sizeof(*log));
+}
+
+static void so_text_write(uintptr_t addr, const void *data, size_t size) {
+	if (txn_open) {
+		// Split at page boundaries so every queued write belongs to exactly one page
+		int queued = 1;
+		for (size_t done = 0; done < size && queued;) {
+			size_t chunk = SO_PAGE_SIZE - ((addr + done) & (SO_PAGE_SIZE - 1));
+			if (chunk > size - done)
+				chunk = size - done;
+			queued = so_patch_log_add(&txn, addr + done, (const uint8_t *)data + done, chunk) == 0;
+			done += chunk;
+		}
+		if (queued)
+			return;
+	}
+
+	backend->code_memcpy((void *)addr, data, size);
+	backend->flush((void *)addr, size);
+}
+
+static int so_patch_cmp(const void *a, const void *b) {
+	const so_patch *pa = a, *pb = b;
+	uintptr_t page_a = pa->addr / SO_PAGE_SIZE, page_b = pb->addr / SO_PAGE_SIZE;
+	if (page_a != page_b)
+		return page_a < page_b ? -1 : 1;
+	return pa->seq - pb->seq;
+}
+
+// Flushes every run of dirty lines in a page, one bit per cache line
+static int so_flush_lines(uintptr_t page, const uint32_t *lines) {
+	int flushes = 0;
+	for (int i = 0; i < SO_PAGE_SIZE / SO_CACHE_LINE;) {
+		if (!(lines[i / 32] & (1u << (i % 32)))) {
+			i++;
+			continue;
+		}
+		int start = i;
+		while (i < SO_PAGE_SIZE / SO_CACHE_LINE && (lines[i / 32] & (1u << (i % 32))))
+			i++;
+		backend->flush((void *)(page + start * SO_CACHE_LINE), (i - start) * SO_CACHE_LINE);
+		flushes++;
+	}
+	return flushes;
+}
+
+void so_hook_begin(void) {
+	txn_open = 1;
+}
+
+int so_hook_commit(void) {
+	static uint8_t page_buf[SO_PAGE_SIZE];
+	SceUInt64 start = backend->time();
+	int pages = 0, flushes = 0;
+
+	txn_open = 0;
+	qsort(txn.patches, txn.num_patches, sizeof(so_patch), so_patch_cmp);
+
+	for (int i = 0; i < txn.num_patches;) {
+		uintptr_t page = txn.patches[i].addr & ~(SO_PAGE_SIZE - 1);
+		uintptr_t lo = txn.patches[i].addr, hi = lo;
+		uint32_t lines[SO_PAGE_SIZE / SO_CACHE_LINE / 32] = {0};
+
+		int end = i;
+		for (; end < txn.num_patches && (txn.patches[end].addr & ~(SO_PAGE_SIZE - 1)) == page; end++) {
+			so_patch *p = &txn.patches[end];
+			if (p->addr < lo)
+				lo = p->addr;
+			if (p->addr + p->size > hi)
+				hi = p->addr + p->size;
+			for (uintptr_t l = (p->addr - page) / SO_CACHE_LINE; l <= (p->addr + p->size - 1 - page) / SO_CACHE_LINE; l++)
+				lines[l / 32] |= 1u << (l % 32);
+		}
+
+		// Read the span back, lay the patches over it in queue order and write it once
+		sceClibMemcpy(page_buf, (void *)lo, hi - lo);
+		if (so_patch_log_add(&undo, lo, page_buf, hi - lo) < 0)
+			debugPrintf("so_hook_commit: undo log full, 0x%08X can't be reverted\n", lo);
+		for (int j = i; j < end; j++)
+			sceClibMemcpy(page_buf + (txn.patches[j].addr - lo), txn.pool + txn.patches[j].offs, txn.patches[j].size);
+		backend->code_memcpy((void *)lo, page_buf, hi - lo);
+
+		flushes += so_flush_lines(page, lines);
+		pages++;
+		i = end;
+	}
+
+	debugPrintf("so_hook_commit: %d writes over %d pages, %d flushes in %llu us\n", txn.num_patches, pages, flushes, backend->time() - start);
+	so_patch_log_free(&txn);
+	return pages;
+}
+
+void so_hook_revert(void) {
+	for (int i = undo.num_patches - 1; i >= 0; i--) {
+		so_patch *p = &undo.patches[i];
+		backend->code_memcpy((void *)p->addr, undo.pool + p->offs, p->size);
+		backend->flush((void *)p->addr, p->size);
+	}
+	so_patch_log_free(&undo);
+}
+
+/*
+ * make_trampoline: relocates the instructions a hook is about to overwrite into the
+ * patch/cave arenas, followed by a jump back to the first untouched instruction.
+ * Calling the trampoline runs the original function without any code rewriting.
+*/
+static uintptr_t so_make_trampoline(uintptr_t addr, size_t patch_size, int thumb) {
+	uint32_t buf[INSN_RELOC_MAX / 4];
+	size_t code_size;
+	int trampoline_sz;
+
+	so_module *mod = so_find_text_module(addr);
+	if (!mod)
+		return 0;
+
+	if (thumb)
+		trampoline_sz = insn_reloc_thumb((const uint16_t *)addr, addr, patch_size, buf, sizeof(buf), &code_size);
+	else
+		trampoline_sz = insn_reloc_arm((const uint32_t *)addr, addr, patch_size, buf, sizeof(buf), &code_size);
+	if (trampoline_sz < 0) {
+		debugPrintf("make_trampoline: can't relocate prologue at 0x%08X\n", addr);
+		return 0;
+	}
+
+	uintptr_t trampoline = so_alloc_arena(mod, NULL, 0, trampoline_sz);
+	if (!trampoline)
+		return 0;
+
+	so_text_write(trampoline, buf, trampoline_sz);
+
+	return thumb ? (trampoline | 1) : trampoline;
+}
 
 so_hook hook_thumb(uintptr_t addr, uintptr_t dst) {
 	so_hook h;
@@ -66,9 +397,13 @@ so_hook hook_thumb(uintptr_t addr, uintptr_t dst) {
 		return;
 	h.thumb_addr = addr;
 	addr &= ~1;
+
+	// Relocate everything the patch (and alignment NOP) clobbers
+	h.trampoline = so_make_trampoline(addr, ((addr & 2) ? 2 : 0) + sizeof(h.patch_instr), 1);
+
 	if (addr & 2) {
 		uint16_t nop = 0xbf00;
-		kuKernelCpuUnrestrictedMemcpy((void *)addr, &nop, sizeof(nop));
+		so_text_write(addr, &nop, sizeof(nop));
 		addr += 2;
 		printf("THUMB UNALIGNED\n");
 	}
@@ -76,8 +411,8 @@ so_hook hook_thumb(uintptr_t addr, uintptr_t dst) {
 	h.addr = addr;
 	h.patch_instr[0] = 0xf000f8df; // LDR PC, [PC]
 	h.patch_instr[1] = dst;
-	kuKernelCpuUnrestrictedMemcpy(&h.orig_instr, (void *)addr, sizeof(h.orig_instr));
-	kuKernelCpuUnrestrictedMemcpy((void *)addr, h.patch_instr, sizeof(h.patch_instr));
+	backend->code_memcpy(&h.orig_instr, (void *)addr, sizeof(h.orig_instr));
+	so_text_write(addr, h.patch_instr, sizeof(h.patch_instr));
 
 	return h;
 }
@@ -86,14 +421,14 @@ so_hook hook_arm(uintptr_t addr, uintptr_t dst) {
 	printf("ARM HOOK\n");
 	if (addr == 0)
 		return;
-	uint32_t hook[2];
 	so_hook h;
 	h.thumb_addr = 0;
 	h.addr = addr;
 	h.patch_instr[0] = 0xe51ff004; // LDR PC, [PC, #-0x4]
 	h.patch_instr[1] = dst;
-	kuKernelCpuUnrestrictedMemcpy(&h.orig_instr, (void *)addr, sizeof(h.orig_instr));
-	kuKernelCpuUnrestrictedMemcpy((void *)addr, h.patch_instr, sizeof(h.patch_instr));
+	backend->code_memcpy(&h.orig_instr, (void *)addr, sizeof(h.orig_instr));
+	h.trampoline = so_make_trampoline(addr, sizeof(h.orig_instr), 0);
+	so_text_write(addr, h.patch_instr, sizeof(h.patch_instr));
 
 	return h;
 }
@@ -107,24 +442,185 @@ so_hook hook_addr(uintptr_t addr, uintptr_t dst) {
 		return hook_arm(addr, dst);
 }
 
+void so_set_backend(const so_backend *b) {
+	backend = b;
+}
+
 void so_flush_caches(so_module *mod) {
-	kuKernelFlushCaches((void *)mod->text_base, mod->text_size);
+	backend->flush((void *)mod->text_base, mod->text_size);
+}
+
+/*
+ * so_source: where _so_load pulls the ELF bytes from. Headers are read into
+ * small heap buffers and every PT_LOAD segment is streamed straight into its
+ * final memblock, so there is never a staging copy of the whole .so around.
+*/
+#define SO_STREAM_CHUNK (256 * 1024)
+
+typedef struct {
+	SceUID fd; // file source, or -1 for a memory source
+	const uint8_t *buf;
+	size_t size;
+	uint8_t *chunk; // bounce buffer for RX memblocks, file source only
+	size_t staged; // bytes of heap used for headers and bounce buffer
+	SHA1_CTX sha1;
+} so_source;
+
+static int so_source_read(so_source *src, void *dst, size_t offset, size_t size) {
+	if (offset > src->size || size > src->size - offset)
+		return -1;
+
+	if (src->fd < 0) {
+		sceClibMemcpy(dst, src->buf + offset, size);
+	} else {
+		if (sceIoLseek(src->fd, offset, SCE_SEEK_SET) != offset)
+			return -1;
+		for (size_t done = 0; done < size;) {
+			int r = sceIoRead(src->fd, (uint8_t *)dst + done, size - done);
+			if (r <= 0)
+				return -1;
+			done += r;
+		}
+	}
+
+	sha1_update(&src->sha1, dst, size);
+	return 0;
+}
+
+static void *so_source_read_alloc(so_source *src, size_t offset, size_t size) {
+	void *dst = malloc(size);
+	if (!dst)
+		return NULL;
+
+	if (so_source_read(src, dst, offset, size) < 0) {
+		free(dst);
+		return NULL;
+	}
+
+	src->staged += size;
+	return dst;
+}
+
+// Reads into memory we can only write through the kernel (code segment)
+static int so_source_read_unrestricted(so_source *src, void *dst, size_t offset, size_t size) {
+	if (offset > src->size || size > src->size - offset)
+		return -1;
+
+	if (src->fd < 0) {
+		sha1_update(&src->sha1, src->buf + offset, size);
+		backend->code_memcpy(dst, src->buf + offset, size);
+		return 0;
+	}
+
+	for (size_t done = 0; done < size;) {
+		size_t len = size - done < SO_STREAM_CHUNK ? size - done : SO_STREAM_CHUNK;
+		if (so_source_read(src, src->chunk, offset + done, len) < 0)
+			return -1;
+		backend->code_memcpy((uint8_t *)dst + done, src->chunk, len);
+		done += len;
+	}
+
+	return 0;
+}
+
+static int so_zero_unrestricted(so_source *src, void *dst, size_t size) {
+	if (src->chunk) {
+		memset(src->chunk, 0, size < SO_STREAM_CHUNK ? size : SO_STREAM_CHUNK);
+		for (size_t done = 0; done < size;) {
+			size_t len = size - done < SO_STREAM_CHUNK ? size - done : SO_STREAM_CHUNK;
+			backend->code_memcpy((uint8_t *)dst + done, src->chunk, len);
+			done += len;
+		}
+	} else {
+		char *zero = calloc(1, size);
+		if (!zero)
+			return -1;
+		backend->code_memcpy(dst, zero, size);
+		free(zero);
+	}
+
+	return 0;
+}
+
+static int so_mapping_cmp(const void *a, const void *b) {
+	uint32_t va = ((const so_mapping_symbol *)a)->offset, vb = ((const so_mapping_symbol *)b)->offset;
+	return va < vb ? -1 : va > vb;
+}
+
+// Keeps the $a/$t/$d symbols of an unstripped module, the rest of .symtab isn't needed
+static void so_load_mapping_symbols(so_module *mod, so_source *src) {
+	for (int i = 0; i < mod->ehdr->e_shnum; i++) {
+		Elf32_Shdr *symtab = &mod->shdr[i];
+		if (symtab->sh_type != SHT_SYMTAB || symtab->sh_link >= mod->ehdr->e_shnum)
+			continue;
+
+		Elf32_Shdr *strtab = &mod->shdr[symtab->sh_link];
+		int num_syms = symtab->sh_size / sizeof(Elf32_Sym);
+		Elf32_Sym *syms = so_source_read_alloc(src, symtab->sh_offset, symtab->sh_size);
+		char *strs = so_source_read_alloc(src, strtab->sh_offset, strtab->sh_size);
+		so_mapping_symbol *map = syms && strs ? malloc(num_syms * sizeof(so_mapping_symbol) + 1) : NULL;
+
+		int n = 0;
+		for (int j = 0; map && j < num_syms; j++) {
+			if (syms[j].st_name + 3 > strtab->sh_size)
+				continue;
+			const char *name = strs + syms[j].st_name;
+			if (name[0] == '$' && (name[1] == 'a' || name[1] == 't' || name[1] == 'd') && (name[2] == '\0' || name[2] == '.')) {
+				map[n].offset = syms[j].st_value & ~1;
+				map[n].kind = name[1];
+				n++;
+			}
+		}
+		free(syms);
+		free(strs);
+
+		if (map && n) {
+			qsort(map, n, sizeof(so_mapping_symbol), so_mapping_cmp);
+			mod->mapping = map;
+			mod->num_mapping = n;
+		} else {
+			free(map);
+		}
+		return;
+	}
+}
+
+static void so_free_headers(so_module *mod) {
+	free(mod->ehdr);
+	free(mod->phdr);
+	free(mod->shdr);
+	free(mod->shstr);
+	mod->ehdr = NULL;
+	mod->phdr = NULL;
+	mod->shdr = NULL;
+	mod->shstr = NULL;
 }
 
-int _so_load(so_module *mod, SceUID so_blockid, void *so_data, uintptr_t load_addr) {
+int _so_load(so_module *mod, so_source *src, uintptr_t load_addr) {
 	int res = 0;
 	uintptr_t data_addr = 0;
-	
-	if (memcmp(so_data, ELFMAG, SELFMAG) != 0) {
+	SceUInt64 start = backend->time();
+
+	sha1_init(&src->sha1);
+
+	mod->ehdr = so_source_read_alloc(src, 0, sizeof(Elf32_Ehdr));
+	if (!mod->ehdr || memcmp(mod->ehdr, ELFMAG, SELFMAG) != 0) {
 		res = -1;
-		goto err_free_so;
+		goto err_free_headers;
 	}
 
-	mod->ehdr = (Elf32_Ehdr *)so_data;
-	mod->phdr = (Elf32_Phdr *)((uintptr_t)so_data + mod->ehdr->e_phoff);
-	mod->shdr = (Elf32_Shdr *)((uintptr_t)so_data + mod->ehdr->e_shoff);
+	mod->phdr = so_source_read_alloc(src, mod->ehdr->e_phoff, mod->ehdr->e_phnum * sizeof(Elf32_Phdr));
+	mod->shdr = so_source_read_alloc(src, mod->ehdr->e_shoff, mod->ehdr->e_shnum * sizeof(Elf32_Shdr));
+	if (!mod->phdr || !mod->shdr || mod->ehdr->e_shstrndx >= mod->ehdr->e_shnum) {
+		res = -1;
+		goto err_free_headers;
+	}
 
-	mod->shstr = (char *)((uintptr_t)so_data + mod->shdr[mod->ehdr->e_shstrndx].sh_offset);
+	mod->shstr = so_source_read_alloc(src, mod->shdr[mod->ehdr->e_shstrndx].sh_offset, mod->shdr[mod->ehdr->e_shstrndx].sh_size);
+	if (!mod->shstr) {
+		res = -1;
+		goto err_free_headers;
+	}
 
 	for (int i = 0; i < mod->ehdr->e_phnum; i++) {
 		if (mod->phdr[i].p_type == PT_LOAD) {
@@ -135,28 +631,16 @@ int _so_load(so_module *mod, SceUID so_blockid, void *so_data, uintptr_t load_ad
 				// Allocate arena for code patches, trampolines, etc
 				// Sits exactly under the desired allocation space
 				mod->patch_size = ALIGN_MEM(PATCH_SZ, mod->phdr[i].p_align);
-				SceKernelAllocMemBlockKernelOpt opt;
-				memset(&opt, 0, sizeof(SceKernelAllocMemBlockKernelOpt));
-				opt.size = sizeof(SceKernelAllocMemBlockKernelOpt);
-				opt.attr = 0x1;
-				opt.field_C = (SceUInt32)load_addr - mod->patch_size;
-				res = mod->patch_blockid = kuKernelAllocMemBlock("rx_block", SCE_KERNEL_MEMBLOCK_TYPE_USER_RX, mod->patch_size, &opt);
+				res = mod->patch_blockid = backend->alloc("rx_block", mod->patch_size, load_addr - mod->patch_size, 1, &mod->patch_base);
 				if (res < 0)
-					goto err_free_so;
+					goto err_free_headers;
 
-				sceKernelGetMemBlockBase(mod->patch_blockid, &mod->patch_base);
-				mod->patch_head = mod->patch_base;
+				so_island_region_add(mod, mod->patch_blockid, mod->patch_base, mod->patch_size);
 				
 				prog_size = ALIGN_MEM(mod->phdr[i].p_memsz, mod->phdr[i].p_align);
-				memset(&opt, 0, sizeof(SceKernelAllocMemBlockKernelOpt));
-				opt.size = sizeof(SceKernelAllocMemBlockKernelOpt);
-				opt.attr = 0x1;
-				opt.field_C = (SceUInt32)load_addr;
-				res = mod->text_blockid = kuKernelAllocMemBlock("rx_block", SCE_KERNEL_MEMBLOCK_TYPE_USER_RX, prog_size, &opt);
+				res = mod->text_blockid = backend->alloc("rx_block", prog_size, load_addr, 1, (uintptr_t *)&prog_data);
 				if (res < 0)
-					goto err_free_so;
-
-				sceKernelGetMemBlockBase(mod->text_blockid, &prog_data);
+					goto err_free_data;
 
 				mod->phdr[i].p_vaddr += (Elf32_Addr)prog_data;
 
@@ -165,32 +649,38 @@ int _so_load(so_module *mod, SceUID so_blockid, void *so_data, uintptr_t load_ad
 		
 				// Use the .text segment padding as a code cave
 				// Word-align it to make it simpler for instruction arena allocation
-				mod->cave_size = ALIGN_MEM(prog_size - mod->phdr[i].p_memsz, 0x4);
-				mod->cave_base = mod->cave_head = prog_data + mod->phdr[i].p_memsz;
-				mod->cave_base = ALIGN_MEM(mod->cave_base, 0x4);
-				mod->cave_head = mod->cave_base;
+				mod->cave_base = ALIGN_MEM((uintptr_t)prog_data + mod->phdr[i].p_memsz, 0x4);
+				mod->cave_size = (uintptr_t)prog_data + prog_size - mod->cave_base;
+				so_island_region_add(mod, 0, mod->cave_base, mod->cave_size);
 				printf("code cave: %d bytes (@0x%08X).\n", mod->cave_size, mod->cave_base);
 
 				data_addr = (uintptr_t)prog_data + prog_size;
+
+				// Code memory isn't writable from usermode, stream it through the kernel
+				if (so_source_read_unrestricted(src, (void *)mod->phdr[i].p_vaddr, mod->phdr[i].p_offset, mod->phdr[i].p_filesz) < 0) {
+					res = -3;
+					goto err_free_data;
+				}
+				if (so_zero_unrestricted(src, prog_data + mod->phdr[i].p_filesz, prog_size - mod->phdr[i].p_filesz) < 0) {
+					res = -3;
+					goto err_free_data;
+				}
 			} else {
-				if (data_addr == 0)
-					goto err_free_so;
+				if (data_addr == 0) {
+					res = -1;
+					goto err_free_headers;
+				}
 
-				if (mod->n_data >= MAX_DATA_SEG)
+				if (mod->n_data >= MAX_DATA_SEG) {
+					res = -1;
 					goto err_free_data;
+				}
 
 				prog_size = ALIGN_MEM(mod->phdr[i].p_memsz + mod->phdr[i].p_vaddr - (data_addr - mod->text_base), mod->phdr[i].p_align);
 
-				SceKernelAllocMemBlockKernelOpt opt;
-				memset(&opt, 0, sizeof(SceKernelAllocMemBlockKernelOpt));
-				opt.size = sizeof(SceKernelAllocMemBlockKernelOpt);
-				opt.attr = 0x1;
-				opt.field_C = (SceUInt32)data_addr;
-				res = mod->data_blockid[mod->n_data] = kuKernelAllocMemBlock("rw_block", SCE_KERNEL_MEMBLOCK_TYPE_USER_RW, prog_size, &opt);
+				res = mod->data_blockid[mod->n_data] = backend->alloc("rw_block", prog_size, data_addr, 0, (uintptr_t *)&prog_data);
 				if (res < 0)
-					goto err_free_text;
-
-				sceKernelGetMemBlockBase(mod->data_blockid[mod->n_data], &prog_data);
+					goto err_free_data;
 				data_addr = (uintptr_t)prog_data + prog_size;
 
 				mod->phdr[i].p_vaddr += (Elf32_Addr)mod->text_base;
@@ -198,14 +688,16 @@ int _so_load(so_module *mod, SceUID so_blockid, void *so_data, uintptr_t load_ad
 				mod->data_base[mod->n_data] = mod->phdr[i].p_vaddr;
 				mod->data_size[mod->n_data] = mod->phdr[i].p_memsz;
 				mod->n_data++;
-			}
-
-			char *zero = malloc(prog_size - mod->phdr[i].p_filesz);
-			memset(zero, 0, prog_size - mod->phdr[i].p_filesz);
-			kuKernelCpuUnrestrictedMemcpy(prog_data + mod->phdr[i].p_filesz, zero, prog_size - mod->phdr[i].p_filesz);
-			free(zero);
 
-			kuKernelCpuUnrestrictedMemcpy((void *)mod->phdr[i].p_vaddr, (void *)((uintptr_t)so_data + mod->phdr[i].p_offset), mod->phdr[i].p_filesz);
+				// Data memory is plain RW, read the segment right into place and only clear what's left
+				uintptr_t file_end = mod->phdr[i].p_vaddr + mod->phdr[i].p_filesz;
+				memset(prog_data, 0, mod->phdr[i].p_vaddr - (uintptr_t)prog_data);
+				memset((void *)file_end, 0, (uintptr_t)prog_data + prog_size - file_end);
+				if (so_source_read(src, (void *)mod->phdr[i].p_vaddr, mod->phdr[i].p_offset, mod->phdr[i].p_filesz) < 0) {
+					res = -3;
+					goto err_free_data;
+				}
+			}
 		}
 	}
 
@@ -232,6 +724,11 @@ int _so_load(so_module *mod, SceUID so_blockid, void *so_data, uintptr_t load_ad
 			mod->num_init_array = sh_size / sizeof(void *);
 		} else if (strcmp(sh_name, ".hash") == 0) {
 			mod->hash = (void *)sh_addr;
+		} else if (strcmp(sh_name, ".gnu.hash") == 0) {
+			mod->gnu_hash = (void *)sh_addr;
+		} else if (strcmp(sh_name, ".text") == 0) {
+			mod->code_base = sh_addr;
+			mod->code_size = sh_size;
 		}
 	}
 
@@ -244,6 +741,8 @@ int _so_load(so_module *mod, SceUID so_blockid, void *so_data, uintptr_t load_ad
 		goto err_free_data;
 	}
 
+	so_load_mapping_symbols(mod, src);
+
 	for (int i = 0; i < mod->num_dynamic; i++) {
 		switch (mod->dynamic[i].d_tag) {
 		case DT_SONAME:
@@ -254,7 +753,13 @@ int _so_load(so_module *mod, SceUID so_blockid, void *so_data, uintptr_t load_ad
 		}
 	}
 
-	sceKernelFreeMemBlock(so_blockid);
+	sha1_final(&src->sha1, mod->sha1);
+
+	debugPrintf("so_load: %u bytes image, %u bytes staged, %llu us\n", src->size, src->staged, backend->time() - start);
+
+	// A new module invalidates the merged export index and the address index
+	so_global_index_free();
+	addr_index.dirty = 1;
 
 	if (!head && !tail) {
 		head = mod;
@@ -267,55 +772,49 @@ int _so_load(so_module *mod, SceUID so_blockid, void *so_data, uintptr_t load_ad
 	return 0;
 
 err_free_data:
+	so_island_region_free_all(mod);
 	for (int i = 0; i < mod->n_data; i++)
-		sceKernelFreeMemBlock(mod->data_blockid[i]);
-err_free_text:
-	sceKernelFreeMemBlock(mod->text_blockid);
-err_free_so:
-	sceKernelFreeMemBlock(so_blockid);
+		backend->free(mod->data_blockid[i]);
+	backend->free(mod->text_blockid);
+	backend->free(mod->patch_blockid);
+err_free_headers:
+	so_free_headers(mod);
 
 	return res;
 }
 
 int so_mem_load(so_module *mod, void *buffer, size_t so_size, uintptr_t load_addr) {
-	SceUID so_blockid;
-	void *so_data;
+	so_source src;
 
 	memset(mod, 0, sizeof(so_module));
+	memset(&src, 0, sizeof(so_source));
+	src.fd = -1;
+	src.buf = buffer;
+	src.size = so_size;
 
-	so_blockid = sceKernelAllocMemBlock("so block", SCE_KERNEL_MEMBLOCK_TYPE_USER_RW, (so_size + 0xfff) & ~0xfff, NULL);
-	if (so_blockid < 0)
-		return so_blockid;
-
-	sceKernelGetMemBlockBase(so_blockid, &so_data);
-	sceClibMemcpy(so_data, buffer, so_size);
-	
-	return _so_load(mod, so_blockid, so_data, load_addr);
+	return _so_load(mod, &src, load_addr);
 }
 
 int so_file_load(so_module *mod, const char *filename, uintptr_t load_addr) {
-	SceUID so_blockid;
-	void *so_data;
+	so_source src;
 
 	memset(mod, 0, sizeof(so_module));
+	memset(&src, 0, sizeof(so_source));
 
-	SceUID fd = sceIoOpen(filename, SCE_O_RDONLY, 0);
-	if (fd < 0)
-		return fd;
+	src.fd = sceIoOpen(filename, SCE_O_RDONLY, 0);
+	if (src.fd < 0)
+		return src.fd;
 
-	size_t so_size = sceIoLseek(fd, 0, SCE_SEEK_END);
-	sceIoLseek(fd, 0, SCE_SEEK_SET);
+	src.size = sceIoLseek(src.fd, 0, SCE_SEEK_END);
+	src.chunk = malloc(SO_STREAM_CHUNK);
+	src.staged = SO_STREAM_CHUNK;
 
-	so_blockid = sceKernelAllocMemBlock("so block", SCE_KERNEL_MEMBLOCK_TYPE_USER_RW, (so_size + 0xfff) & ~0xfff, NULL);
-	if (so_blockid < 0)
-		return so_blockid;
+	int res = _so_load(mod, &src, load_addr);
 
-	sceKernelGetMemBlockBase(so_blockid, &so_data);
-
-	sceIoRead(fd, so_data, so_size);
-	sceIoClose(fd);
+	free(src.chunk);
+	sceIoClose(src.fd);
 
-	return _so_load(mod, so_blockid, so_data, load_addr);
+	return res;
 }
 
 int so_relocate(so_module *mod) {
@@ -349,7 +848,238 @@ int so_relocate(so_module *mod) {
 	return 0;
 }
 
+uint32_t so_hash(const uint8_t *name) {
+	uint64_t h = 0, g;
+	while (*name) {
+		h = (h << 4) + *name++;
+		if ((g = (h & 0xf0000000)) != 0)
+			h ^= g >> 24;
+		h &= 0x0fffffff;
+	}
+	return h;
+}
+
+uint32_t so_gnu_hash(const uint8_t *name) {
+	uint32_t h = 5381;
+	while (*name)
+		h = (h << 5) + h + *name++;
+	return h;
+}
+
+/*
+ * dynlib index: open addressing hash table over a so_default_dynlib array.
+ * Built once for a given table and then probed for every import, so that
+ * resolution costs a hash plus (usually) a single strcmp instead of a
+ * linear scan over the whole table. Keyed by so_gnu_hash so that tables
+ * can carry their hashes precomputed with SO_GNU_HASH.
+*/
+static struct {
+	so_default_dynlib *table;
+	int num_entries;
+	uint32_t mask;
+	int *slots; // index into table, -1 if empty
+	uint32_t *hashes; // so_gnu_hash of every table entry
+} dynlib_index;
+
+static void so_dynlib_index_build(so_default_dynlib *default_dynlib, int num_entries) {
+	free(dynlib_index.slots);
+	free(dynlib_index.hashes);
+
+	// Keep load factor under 50% so probe chains stay short
+	uint32_t num_slots = 16;
+	while (num_slots < (uint32_t)num_entries * 2)
+		num_slots <<= 1;
+
+	dynlib_index.table = default_dynlib;
+	dynlib_index.num_entries = num_entries;
+	dynlib_index.mask = num_slots - 1;
+	dynlib_index.slots = malloc(num_slots * sizeof(int));
+	dynlib_index.hashes = malloc(num_entries * sizeof(uint32_t));
+	memset(dynlib_index.slots, 0xFF, num_slots * sizeof(int));
+
+	for (int i = 0; i < num_entries; i++) {
+		uint32_t hash = default_dynlib[i].hash ? default_dynlib[i].hash : so_gnu_hash((const uint8_t *)default_dynlib[i].symbol);
+		dynlib_index.hashes[i] = hash;
+		for (uint32_t j = hash & dynlib_index.mask;; j = (j + 1) & dynlib_index.mask) {
+			int idx = dynlib_index.slots[j];
+			if (idx == -1) {
+				dynlib_index.slots[j] = i;
+				break;
+			}
+			// Duplicated entries: first one wins, same as a linear scan would do
+			if (dynlib_index.hashes[idx] == hash && strcmp(default_dynlib[idx].symbol, default_dynlib[i].symbol) == 0)
+				break;
+		}
+	}
+}
+
+static so_default_dynlib *so_dynlib_lookup(so_default_dynlib *default_dynlib, int size_default_dynlib, const char *symbol) {
+	int num_entries = size_default_dynlib / sizeof(so_default_dynlib);
+	if (dynlib_index.table != default_dynlib || dynlib_index.num_entries != num_entries)
+		so_dynlib_index_build(default_dynlib, num_entries);
+
+	uint32_t hash = so_gnu_hash((const uint8_t *)symbol);
+	for (uint32_t j = hash & dynlib_index.mask;; j = (j + 1) & dynlib_index.mask) {
+		int idx = dynlib_index.slots[j];
+		if (idx == -1)
+			return NULL;
+		if (dynlib_index.hashes[idx] == hash && strcmp(default_dynlib[idx].symbol, symbol) == 0)
+			return &default_dynlib[idx];
+	}
+}
+
+/*
+ * dependency graph: every loaded module gets its DT_NEEDED entries matched against
+ * the other loaded modules once. Modules are then relocated and initialized in
+ * topological order, dependencies first, and the exports of every module that is
+ * somebody's dependency go to one global index so each import costs one probe.
+*/
+typedef struct {
+	const char *name;
+	uint32_t hash; // so_gnu_hash
+	uintptr_t addr;
+	so_module *mod;
+	int weak;
+} so_global_sym;
+
+static struct {
+	so_global_sym *syms;
+	int num_syms;
+	uint32_t mask;
+	int *slots; // index into syms, -1 if empty
+} global_index;
+
+static void so_global_index_free(void) {
+	free(global_index.syms);
+	free(global_index.slots);
+	memset(&global_index, 0, sizeof(global_index));
+}
+
+static void so_link_needed(so_module *mod) {
+	mod->num_needed = 0;
+	for (int i = 0; i < mod->num_dynamic; i++) {
+		if (mod->dynamic[i].d_tag != DT_NEEDED)
+			continue;
+
+		const char *name = mod->dynstr + mod->dynamic[i].d_un.d_ptr;
+		for (so_module *curr = head; curr; curr = curr->next) {
+			if (curr != mod && curr->soname && strcmp(curr->soname, name) == 0) {
+				if (mod->num_needed < MAX_NEEDED)
+					mod->needed[mod->num_needed++] = curr;
+				break;
+			}
+		}
+	}
+}
+
+static void so_topo_visit(so_module *mod, so_module **order, int *n) {
+	if (mod->visit)
+		return; // done, or a cycle we just break here
+	mod->visit = 1;
+	for (int i = 0; i < mod->num_needed; i++)
+		so_topo_visit(mod->needed[i], order, n);
+	order[(*n)++] = mod;
+}
+
+// Dependencies before their dependents; returns the number of modules
+static int so_topo_order(so_module ***order) {
+	int num_mods = 0;
+	for (so_module *curr = head; curr; curr = curr->next) {
+		so_link_needed(curr);
+		curr->visit = 0;
+		num_mods++;
+	}
+
+	*order = malloc(num_mods * sizeof(so_module *));
+	if (!*order)
+		return 0;
+
+	int n = 0;
+	for (so_module *curr = head; curr; curr = curr->next)
+		so_topo_visit(curr, *order, &n);
+	return n;
+}
+
+static void so_global_index_add(so_global_sym *sym) {
+	for (uint32_t j = sym->hash & global_index.mask;; j = (j + 1) & global_index.mask) {
+		int idx = global_index.slots[j];
+		if (idx == -1) {
+			global_index.slots[j] = sym - global_index.syms;
+			return;
+		}
+		so_global_sym *curr = &global_index.syms[idx];
+		if (curr->hash == sym->hash && strcmp(curr->name, sym->name) == 0) {
+			// First definition in scope order wins, unless it was weak
+			if (curr->weak && !sym->weak)
+				global_index.slots[j] = sym - global_index.syms;
+			return;
+		}
+	}
+}
+
+// order is dependencies first, the lookup scope goes the other way like ld.so's
+static void so_global_index_build(so_module **order, int num_mods) {
+	so_global_index_free();
+
+	int num_syms = 0;
+	for (int i = 0; i < num_mods; i++) {
+		if (order[i]->visit == 2)
+			num_syms += order[i]->num_dynsym;
+	}
+	if (num_syms == 0)
+		return;
+
+	uint32_t num_slots = 16;
+	while (num_slots < (uint32_t)num_syms * 2)
+		num_slots <<= 1;
+
+	global_index.syms = malloc(num_syms * sizeof(so_global_sym));
+	global_index.slots = malloc(num_slots * sizeof(int));
+	if (!global_index.syms || !global_index.slots) {
+		so_global_index_free();
+		return;
+	}
+	global_index.mask = num_slots - 1;
+	memset(global_index.slots, 0xFF, num_slots * sizeof(int));
+
+	for (int i = num_mods - 1; i >= 0; i--) {
+		so_module *mod = order[i];
+		if (mod->visit != 2)
+			continue;
+
+		for (int j = 0; j < mod->num_dynsym; j++) {
+			Elf32_Sym *sym = &mod->dynsym[j];
+			int bind = ELF32_ST_BIND(sym->st_info);
+			if (sym->st_shndx == SHN_UNDEF || (bind != STB_GLOBAL && bind != STB_WEAK))
+				continue;
+
+			so_global_sym *g = &global_index.syms[global_index.num_syms++];
+			g->name = mod->dynstr + sym->st_name;
+			g->hash = so_gnu_hash((const uint8_t *)g->name);
+			g->addr = mod->text_base + sym->st_value;
+			g->mod = mod;
+			g->weak = bind == STB_WEAK;
+			so_global_index_add(g);
+		}
+	}
+}
+
 uintptr_t so_resolve_link(so_module *mod, const char *symbol) {
+	if (global_index.slots) {
+		uint32_t hash = so_gnu_hash((const uint8_t *)symbol);
+		for (uint32_t j = hash & global_index.mask;; j = (j + 1) & global_index.mask) {
+			int idx = global_index.slots[j];
+			if (idx == -1)
+				return 0;
+			so_global_sym *g = &global_index.syms[idx];
+			if (g->hash == hash && strcmp(g->name, symbol) == 0)
+				return g->mod != mod ? g->addr : 0;
+		}
+	}
+
+	so_symbol_key key;
+	key.name = NULL;
+
 	for (int i = 0; i < mod->num_dynamic; i++) {
 		switch (mod->dynamic[i].d_tag) {
 		case DT_NEEDED:
@@ -357,7 +1087,10 @@ uintptr_t so_resolve_link(so_module *mod, const char *symbol) {
 			so_module *curr = head;
 			while (curr) {
 				if (curr != mod && strcmp(curr->soname, mod->dynstr + mod->dynamic[i].d_un.d_ptr) == 0) {
-					uintptr_t link = so_symbol(curr, symbol);
+					// Hash the name once and reuse it for every candidate module
+					if (!key.name)
+						so_symbol_key_init(&key, symbol);
+					uintptr_t link = so_symbol_key_lookup(curr, &key);
 					if (link)
 						return link;
 				}
@@ -374,55 +1107,312 @@ uintptr_t so_resolve_link(so_module *mod, const char *symbol) {
 	return 0;
 }
 
+static Elf32_Rel *so_find_plt_rel(so_module *mod, uintptr_t got);
+
 void reloc_err(uintptr_t got0)
 {
 	// Find to which module this missing symbol belongs
-	int found = 0;
-	so_module *curr = head;
-	while (curr && !found) {
-		for (int i = 0; i < curr->n_data; i++)
-			if ((got0 >= curr->data_base[i]) && (got0 <= (uintptr_t)(curr->data_base[i] + curr->data_size[i])))
-				found = 1;
-		
-		if (!found)
-			curr = curr->next;
-	}
-
-	if (curr) {
-		// Attempt to find symbol name and then display error
-		for (int i = 0; i < curr->num_reldyn + curr->num_relplt; i++) {
-			Elf32_Rel *rel = i < curr->num_reldyn ? &curr->reldyn[i] : &curr->relplt[i - curr->num_reldyn];
-			Elf32_Sym *sym = &curr->dynsym[ELF32_R_SYM(rel->r_info)];
-			uintptr_t *ptr = (uintptr_t *)(curr->text_base + rel->r_offset);
-
-			int type = ELF32_R_TYPE(rel->r_info);
-			switch (type) {
-				case R_ARM_JUMP_SLOT:
-				{
-					if (got0 == (uintptr_t)ptr) {
-						fatal_error("Unknown symbol \"%s\" (%p).\n", curr->dynstr + sym->st_name, (void*)got0);
-					}
-					break;
-				}
-			}
-		}
+	const so_range *r = so_addr_range(got0);
+	Elf32_Rel *rel = r ? so_find_plt_rel(r->mod, got0) : NULL;
+
+	if (rel) {
+		Elf32_Sym *sym = &r->mod->dynsym[ELF32_R_SYM(rel->r_info)];
+		fatal_error("Unknown symbol \"%s\" (%p).\n", r->mod->dynstr + sym->st_name, (void*)got0);
 	}
 
 	// Ooops, this shouldn't have happened.
 	fatal_error("Unknown symbol \"???\" (%p).\n", (void*)got0);
 }
 
+#ifdef __arm__
 __attribute__((naked)) void plt0_stub()
 {
 	register uintptr_t got0 asm("r12");
 	reloc_err(got0);
 }
+#else
+// Host builds map and link modules but never run them, so only the address matters
+void plt0_stub()
+{
+	reloc_err(0);
+}
+#endif
 
-int so_resolve(so_module *mod, so_default_dynlib *default_dynlib, int size_default_dynlib, int default_dynlib_only) {
-	for (int i = 0; i < mod->num_reldyn + mod->num_relplt; i++) {
-		Elf32_Rel *rel = i < mod->num_reldyn ? &mod->reldyn[i] : &mod->relplt[i - mod->num_reldyn];
-		Elf32_Sym *sym = &mod->dynsym[ELF32_R_SYM(rel->r_info)];
-		uintptr_t *ptr = (uintptr_t *)(mod->text_base + rel->r_offset);
+/*
+ * import profile: how many times each default_dynlib entry got bound and, for
+ * modules with profile_imports set, how many times it got called. Calls go through
+ * a thunk in the patch arena that atomically bumps the entry's counter and leaves
+ * its return address and index in so_last_import before jumping on to the real
+ * function. The pair goes out with STREXD, so a reader never sees half of one call
+ * and half of another.
+*/
+volatile uint64_t so_last_import;
+
+static struct {
+	so_default_dynlib *table;
+	int num_entries;
+	uint32_t *binds;
+	uint32_t *calls;
+	uintptr_t *thunks;
+} import_profile;
+
+static int so_import_profile_init(so_default_dynlib *table, int num_entries) {
+	if (import_profile.table == table && import_profile.num_entries == num_entries)
+		return 0;
+
+	free(import_profile.binds);
+	free(import_profile.calls);
+	free(import_profile.thunks);
+	import_profile.table = table;
+	import_profile.num_entries = num_entries;
+	import_profile.binds = calloc(num_entries, sizeof(uint32_t));
+	import_profile.calls = calloc(num_entries, sizeof(uint32_t));
+	import_profile.thunks = calloc(num_entries, sizeof(uintptr_t));
+	if (!import_profile.binds || !import_profile.calls || !import_profile.thunks) {
+		import_profile.table = NULL;
+		return -1;
+	}
+	return 0;
+}
+
+static uintptr_t so_import_profile_bind(so_module *mod, int type, so_default_dynlib *entry, so_default_dynlib *table, int size_table) {
+	if (so_import_profile_init(table, size_table / sizeof(so_default_dynlib)) < 0)
+		return entry->func;
+
+	int idx = entry - table;
+	import_profile.binds[idx]++;
+	if (!mod->profile_imports || type != R_ARM_JUMP_SLOT)
+		return entry->func;
+
+	if (!import_profile.thunks[idx]) {
+		uint32_t thunk[20] = {
+			0xe92d000f, // PUSH {R0-R3}
+			0xe59f0038, // LDR R0, [PC, #0x38] ; counter
+			0xe1901f9f, // 1: LDREX R1, [R0]
+			0xe2811001, // ADD R1, R1, #1
+			0xe180cf91, // STREX IP, R1, [R0]
+			0xe35c0000, // CMP IP, #0
+			0x1afffffa, // BNE 1b
+			0xe59fc024, // LDR IP, [PC, #0x24] ; so_last_import
+			0xe1a0000e, // MOV R0, LR
+			0xe59f1020, // LDR R1, [PC, #0x20] ; entry index
+			0xe1bc2f9f, // 2: LDREXD R2, R3, [IP]
+			0xe1ac3f90, // STREXD R3, R0, R1, [IP]
+			0xe3530000, // CMP R3, #0
+			0x1afffffb, // BNE 2b
+			0xe8bd000f, // POP {R0-R3}
+			0xe51ff004, // LDR PC, [PC, #-0x4]
+			entry->func,
+			(uintptr_t)&import_profile.calls[idx],
+			(uintptr_t)&so_last_import,
+			idx
+		};
+		uintptr_t addr = so_alloc_arena(mod, NULL, 0, sizeof(thunk));
+		if (!addr)
+			return entry->func;
+		so_text_write(addr, thunk, sizeof(thunk));
+		import_profile.thunks[idx] = addr;
+	}
+
+	return import_profile.thunks[idx];
+}
+
+static int so_import_profile_cmp(const void *a, const void *b) {
+	int ia = *(const int *)a, ib = *(const int *)b;
+	if (import_profile.calls[ia] != import_profile.calls[ib])
+		return import_profile.calls[ia] < import_profile.calls[ib] ? 1 : -1;
+	if (import_profile.binds[ia] != import_profile.binds[ib])
+		return import_profile.binds[ia] < import_profile.binds[ib] ? 1 : -1;
+	return ia - ib;
+}
+
+int so_import_profile_dump(so_module *mod, const char *path) {
+	static const char *type_names[SO_STAT_TYPES] = { "ABS32", "GLOB_DAT", "JUMP_SLOT" };
+	so_reloc_stats *stats = &mod->reloc_stats;
+
+	FILE *f = fopen(path, "w");
+	if (!f)
+		return -1;
+
+	fprintf(f, "# relocation bound unbound\n");
+	for (int i = 0; i < SO_STAT_TYPES; i++)
+		fprintf(f, "%s %d %d\n", type_names[i], stats->bound[i], stats->unbound[i]);
+
+	int n = import_profile.table ? import_profile.num_entries : 0;
+	int *order = malloc(n * sizeof(int) + 1);
+	if (order) {
+		for (int i = 0; i < n; i++)
+			order[i] = i;
+		qsort(order, n, sizeof(int), so_import_profile_cmp);
+
+		fprintf(f, "# symbol binds calls%s\n", mod->profile_imports ? "" : " (not counted)");
+		for (int i = 0; i < n; i++) {
+			int idx = order[i];
+			fprintf(f, "%s %u %u\n", import_profile.table[idx].symbol, import_profile.binds[idx], import_profile.calls[idx]);
+		}
+		free(order);
+	}
+
+	fclose(f);
+	return 0;
+}
+
+static int so_bind_import(so_module *mod, int type, uintptr_t *ptr, const char *symbol, so_default_dynlib *default_dynlib, int size_default_dynlib, int default_dynlib_only) {
+	int resolved = 0;
+	if (!default_dynlib_only) {
+		uintptr_t link = so_resolve_link(mod, symbol);
+		if (link) {
+			// debugPrintf("Resolved from dependencies: %s\n", symbol);
+			if (type == R_ARM_ABS32)
+				*ptr += link;
+			else
+				*ptr = link;
+			resolved = 1;
+		}
+	}
+
+	so_default_dynlib *entry = so_dynlib_lookup(default_dynlib, size_default_dynlib, symbol);
+	if (entry) {
+		*ptr = so_import_profile_bind(mod, type, entry, default_dynlib, size_default_dynlib);
+		resolved = 1;
+	}
+
+	if (!resolved && backend->get_proc) {
+		void *f = backend->get_proc(symbol);
+		if (f) {
+			*ptr = f;
+			resolved = 1;
+		}
+	}
+
+	if (!resolved) {
+		if (type == R_ARM_JUMP_SLOT) {
+			printf("Unresolved import: %s\n", symbol);
+			*ptr = (uintptr_t)&plt0_stub;
+		}
+		else {
+			//printf("Unresolved import: %s\n", symbol);
+		}
+	}
+
+	return resolved;
+}
+
+/*
+ * Lazy binding: PLT slots start out pointing at so_lazy_stub. The PLT entry leaves
+ * the GOT slot address in r12, so on first call the stub looks up the relocation
+ * owning that slot, binds it, patches the slot and tail-jumps to the target.
+*/
+#ifdef __arm__
+__attribute__((naked)) void so_lazy_stub()
+{
+	asm volatile(
+		"push {r0-r4, lr}\n"
+		"mov r0, r12\n"
+		"bl so_lazy_bind\n"
+		"mov r12, r0\n"
+		"pop {r0-r4, lr}\n"
+		"bx r12\n"
+	);
+}
+#else
+void so_lazy_stub()
+{
+	reloc_err(0);
+}
+#endif
+
+static Elf32_Rel *so_find_plt_rel(so_module *mod, uintptr_t got) {
+	Elf32_Addr offset = got - mod->text_base;
+
+	// .rel.plt is laid out in GOT order, try a binary search first
+	int lo = 0, hi = mod->num_relplt - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		if (mod->relplt[mid].r_offset == offset)
+			return &mod->relplt[mid];
+		if (mod->relplt[mid].r_offset < offset)
+			lo = mid + 1;
+		else
+			hi = mid - 1;
+	}
+
+	for (int i = 0; i < mod->num_relplt; i++) {
+		if (mod->relplt[i].r_offset == offset)
+			return &mod->relplt[i];
+	}
+
+	return NULL;
+}
+
+// Binding can rebuild the address and dynlib indices and allocate profiling thunks
+static pthread_mutex_t lazy_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+uintptr_t so_lazy_bind(uintptr_t got) {
+	pthread_mutex_lock(&lazy_mutex);
+
+	// Another thread may have bound this slot while we waited
+	uintptr_t target = *(volatile uintptr_t *)got;
+	if (target != (uintptr_t)&so_lazy_stub) {
+		pthread_mutex_unlock(&lazy_mutex);
+		return target;
+	}
+
+	const so_range *r = so_addr_range(got);
+	so_module *mod = r ? r->mod : NULL;
+	Elf32_Rel *rel = mod ? so_find_plt_rel(mod, got) : NULL;
+	if (!rel || !mod->dynlib)
+		reloc_err(got);
+
+	Elf32_Sym *sym = &mod->dynsym[ELF32_R_SYM(rel->r_info)];
+	target = 0;
+	so_bind_import(mod, R_ARM_JUMP_SLOT, &target, mod->dynstr + sym->st_name, mod->dynlib, mod->size_dynlib, mod->dynlib_only);
+	if (target == (uintptr_t)&plt0_stub)
+		reloc_err(got);
+
+	*(volatile uintptr_t *)got = target;
+	mod->num_lazy_bound++;
+	pthread_mutex_unlock(&lazy_mutex);
+
+	return target;
+}
+
+void so_lazy_report(so_module *mod) {
+	printf("Lazy binding: %d of %d imports bound.\n", mod->num_lazy_bound, mod->num_lazy);
+}
+
+static int so_resolve_import(so_module *mod, int type, uintptr_t *ptr, const char *symbol, so_default_dynlib *default_dynlib, int size_default_dynlib, int default_dynlib_only) {
+	if (type == R_ARM_JUMP_SLOT && mod->lazy_bind) {
+		*ptr = (uintptr_t)&so_lazy_stub;
+		mod->num_lazy++;
+		return 1;
+	}
+
+	return so_bind_import(mod, type, ptr, symbol, default_dynlib, size_default_dynlib, default_dynlib_only);
+}
+
+static void so_stats_import(so_reloc_stats *stats, int type, int resolved) {
+	int idx = type == R_ARM_ABS32 ? SO_STAT_ABS32 : (type == R_ARM_GLOB_DAT ? SO_STAT_GLOB_DAT : SO_STAT_JUMP_SLOT);
+	if (resolved)
+		stats->bound[idx]++;
+	else
+		stats->unbound[idx]++;
+}
+
+int so_resolve(so_module *mod, so_default_dynlib *default_dynlib, int size_default_dynlib, int default_dynlib_only) {
+	SceUInt64 start = backend->time();
+
+	mod->dynlib = default_dynlib;
+	mod->size_dynlib = size_default_dynlib;
+	mod->dynlib_only = default_dynlib_only;
+	mod->num_lazy = 0;
+	memset(mod->reloc_stats.bound, 0, sizeof(mod->reloc_stats.bound));
+	memset(mod->reloc_stats.unbound, 0, sizeof(mod->reloc_stats.unbound));
+
+	for (int i = 0; i < mod->num_reldyn + mod->num_relplt; i++) {
+		Elf32_Rel *rel = i < mod->num_reldyn ? &mod->reldyn[i] : &mod->relplt[i - mod->num_reldyn];
+		Elf32_Sym *sym = &mod->dynsym[ELF32_R_SYM(rel->r_info)];
+		uintptr_t *ptr = (uintptr_t *)(mod->text_base + rel->r_offset);
 
 		int type = ELF32_R_TYPE(rel->r_info);
 		switch (type) {
@@ -430,58 +1420,228 @@ int so_resolve(so_module *mod, so_default_dynlib *default_dynlib, int size_defau
 		case R_ARM_GLOB_DAT:
 		case R_ARM_JUMP_SLOT:
 		{
-			if (sym->st_shndx == SHN_UNDEF) {
-				int resolved = 0;
-				if (!default_dynlib_only) {
-					uintptr_t link = so_resolve_link(mod, mod->dynstr + sym->st_name);
-					if (link) {
-						// debugPrintf("Resolved from dependencies: %s\n", mod->dynstr + sym->st_name);
-						if (type == R_ARM_ABS32)
-							*ptr += link;
-						else
-							*ptr = link;
-						resolved = 1;
-					}
-				}
+			if (sym->st_shndx == SHN_UNDEF)
+				so_stats_import(&mod->reloc_stats, type, so_resolve_import(mod, type, ptr, mod->dynstr + sym->st_name, default_dynlib, size_default_dynlib, default_dynlib_only));
+			break;
+		}
+		default:
+			break;
+		}
+	}
 
-				for (int j = 0; j < size_default_dynlib / sizeof(so_default_dynlib); j++) {
-					if (strcmp(mod->dynstr + sym->st_name, default_dynlib[j].symbol) == 0) {
-						*ptr = default_dynlib[j].func;
-						resolved = 1;
-						break;
-					}
-				}
-				
-				if (!resolved) {
-					void *f = vglGetProcAddress(mod->dynstr + sym->st_name);
-					if (f) {
-						*ptr = f;
-						resolved = 1;
-						break;
-					}
-				}
+	debugPrintf("so_resolve: %d relocations processed in %llu us\n", mod->num_reldyn + mod->num_relplt, backend->time() - start);
 
-				if (!resolved) {
-					if (type == R_ARM_JUMP_SLOT) {
-						printf("Unresolved import: %s\n", mod->dynstr + sym->st_name);
-						*ptr = (uintptr_t)&plt0_stub;
-					}
-					else {
-						//printf("Unresolved import: %s\n", mod->dynstr + sym->st_name);
-					}
-				}
-			}
+	return 0;
+}
 
-			break;
+/*
+ * relocate_resolve: so_relocate and so_resolve fused in a single walk, so every
+ * Elf32_Rel and every GOT slot is only touched once.
+*/
+int so_relocate_resolve(so_module *mod, so_default_dynlib *default_dynlib, int size_default_dynlib, int default_dynlib_only) {
+	so_reloc_stats *stats = &mod->reloc_stats;
+	SceUInt64 start = backend->time();
+
+	memset(stats, 0, sizeof(so_reloc_stats));
+	mod->dynlib = default_dynlib;
+	mod->size_dynlib = size_default_dynlib;
+	mod->dynlib_only = default_dynlib_only;
+	mod->num_lazy = 0;
+
+	Elf32_Rel *rel = mod->reldyn;
+	Elf32_Rel *rel_end = mod->reldyn + mod->num_reldyn;
+	for (int i = 0; i < mod->num_reldyn + mod->num_relplt; i++, rel++) {
+		if (rel == rel_end)
+			rel = mod->relplt;
+
+		uintptr_t *ptr = (uintptr_t *)(mod->text_base + rel->r_offset);
+		int type = ELF32_R_TYPE(rel->r_info);
+
+		if (type == R_ARM_RELATIVE) {
+			*ptr += mod->text_base;
+			stats->relative++;
+			continue;
 		}
+
+		Elf32_Sym *sym = &mod->dynsym[ELF32_R_SYM(rel->r_info)];
+		switch (type) {
+		case R_ARM_ABS32:
+			stats->abs32++;
+			break;
+		case R_ARM_GLOB_DAT:
+			stats->glob_dat++;
+			break;
+		case R_ARM_JUMP_SLOT:
+			stats->jump_slot++;
+			break;
 		default:
+			fatal_error("Error unknown relocation type %x\n", type);
 			break;
 		}
+
+		if (sym->st_shndx != SHN_UNDEF) {
+			if (type == R_ARM_ABS32)
+				*ptr += mod->text_base + sym->st_value;
+			else
+				*ptr = mod->text_base + sym->st_value;
+		} else {
+			int resolved = so_resolve_import(mod, type, ptr, mod->dynstr + sym->st_name, default_dynlib, size_default_dynlib, default_dynlib_only);
+			so_stats_import(stats, type, resolved);
+			stats->imports++;
+			if (!resolved)
+				stats->unresolved++;
+		}
+	}
+
+	stats->time = backend->time() - start;
+	debugPrintf("so_relocate_resolve: %d RELATIVE, %d ABS32, %d GLOB_DAT, %d JUMP_SLOT (%d imports, %d unresolved) in %llu us\n",
+		stats->relative, stats->abs32, stats->glob_dat, stats->jump_slot, stats->imports, stats->unresolved, stats->time);
+
+	return 0;
+}
+
+/*
+ * prelink cache: snapshot of the data segments right after so_relocate + so_resolve.
+ * The key covers everything the relocated image depends on (the .so contents, the
+ * load address and the import table with its native addresses), so a matching
+ * cache can be copied back in bulk instead of walking every Elf32_Rel again.
+*/
+#define PRELINK_MAGIC 0x4B4C5250 // 'PRLK'
+#define PRELINK_VERSION 1
+
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint8_t key[SO_KEY_SIZE];
+	uint32_t n_data;
+	uint32_t img_size[MAX_DATA_SEG];
+} so_prelink_hdr;
+
+void so_prelink_key(so_module *mod, so_default_dynlib *default_dynlib, int size_default_dynlib, uint8_t *key) {
+	SHA1_CTX ctx;
+	uint32_t version = PRELINK_VERSION;
+	uintptr_t stub[4] = { (uintptr_t)&plt0_stub, (uintptr_t)&so_lazy_stub, mod->lazy_bind, mod->profile_imports };
+
+	sha1_init(&ctx);
+	sha1_update(&ctx, (const BYTE *)&version, sizeof(version));
+	sha1_update(&ctx, mod->sha1, sizeof(mod->sha1));
+	sha1_update(&ctx, (const BYTE *)&mod->text_base, sizeof(mod->text_base));
+	sha1_update(&ctx, (const BYTE *)mod->data_base, sizeof(mod->data_base));
+	sha1_update(&ctx, (const BYTE *)stub, sizeof(stub));
+	for (int i = 0; i < size_default_dynlib / sizeof(so_default_dynlib); i++) {
+		sha1_update(&ctx, (const BYTE *)default_dynlib[i].symbol, strlen(default_dynlib[i].symbol) + 1);
+		sha1_update(&ctx, (const BYTE *)&default_dynlib[i].func, sizeof(default_dynlib[i].func));
+	}
+	sha1_final(&ctx, key);
+}
+
+// Returns the size of the relocated part of each data segment, or -1 if a relocation lands elsewhere
+static int so_prelink_extents(so_module *mod, uint32_t *img_size) {
+	memset(img_size, 0, sizeof(uint32_t) * MAX_DATA_SEG);
+
+	for (int i = 0; i < mod->num_reldyn + mod->num_relplt; i++) {
+		Elf32_Rel *rel = i < mod->num_reldyn ? &mod->reldyn[i] : &mod->relplt[i - mod->num_reldyn];
+		uintptr_t ptr = mod->text_base + rel->r_offset;
+
+		int seg;
+		for (seg = 0; seg < mod->n_data; seg++) {
+			if (ptr >= mod->data_base[seg] && ptr + sizeof(uintptr_t) <= mod->data_base[seg] + mod->data_size[seg])
+				break;
+		}
+		if (seg == mod->n_data)
+			return -1;
+
+		uint32_t end = ptr + sizeof(uintptr_t) - mod->data_base[seg];
+		if (end > img_size[seg])
+			img_size[seg] = end;
 	}
 
 	return 0;
 }
 
+int so_prelink_save(so_module *mod, const char *path, const uint8_t *key) {
+	so_prelink_hdr hdr;
+
+	// Counting thunks live in the patch arena, which isn't part of the snapshot, and
+	// lazy slots need the dynlib table that only so_resolve/so_relocate_resolve set
+	if (mod->profile_imports || mod->lazy_bind)
+		return -1;
+
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.magic = PRELINK_MAGIC;
+	hdr.version = PRELINK_VERSION;
+	memcpy(hdr.key, key, SO_KEY_SIZE);
+	hdr.n_data = mod->n_data;
+
+	if (so_prelink_extents(mod, hdr.img_size) < 0)
+		return -1;
+
+	SceUID fd = sceIoOpen(path, SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+	if (fd < 0)
+		return fd;
+
+	int res = sceIoWrite(fd, &hdr, sizeof(hdr)) == sizeof(hdr) ? 0 : -2;
+	for (int i = 0; i < mod->n_data && res == 0; i++) {
+		if (sceIoWrite(fd, (void *)mod->data_base[i], hdr.img_size[i]) != hdr.img_size[i])
+			res = -2;
+	}
+	sceIoClose(fd);
+
+	// Never leave a truncated cache behind
+	if (res < 0)
+		sceIoRemove(path);
+
+	return res;
+}
+
+int so_prelink_load(so_module *mod, const char *path, const uint8_t *key) {
+	so_prelink_hdr hdr;
+
+	if (mod->lazy_bind)
+		return -1;
+
+	SceUID fd = sceIoOpen(path, SCE_O_RDONLY, 0);
+	if (fd < 0)
+		return fd;
+
+	int res = 0;
+	if (sceIoRead(fd, &hdr, sizeof(hdr)) != sizeof(hdr) ||
+		hdr.magic != PRELINK_MAGIC ||
+		hdr.version != PRELINK_VERSION ||
+		memcmp(hdr.key, key, SO_KEY_SIZE) != 0 ||
+		hdr.n_data != mod->n_data) {
+		res = -1;
+	}
+
+	size_t total_size = 0;
+	for (int i = 0; i < mod->n_data && res == 0; i++) {
+		if (hdr.img_size[i] > mod->data_size[i])
+			res = -1;
+		total_size += hdr.img_size[i];
+	}
+
+	// Stage the images first so that a short read can't leave the segments
+	// half relocated for the fallback path
+	uint8_t *img = NULL;
+	if (res == 0) {
+		img = malloc(total_size);
+		if (!img || sceIoRead(fd, img, total_size) != total_size)
+			res = -2;
+	}
+	sceIoClose(fd);
+
+	if (res == 0) {
+		uint8_t *src = img;
+		for (int i = 0; i < mod->n_data; i++) {
+			sceClibMemcpy((void *)mod->data_base[i], src, hdr.img_size[i]);
+			src += hdr.img_size[i];
+		}
+	}
+	free(img);
+
+	return res;
+}
+
 int so_resolve_with_dummy(so_module *mod, so_default_dynlib *default_dynlib, int size_default_dynlib, int default_dynlib_only) {
 	for (int i = 0; i < mod->num_reldyn + mod->num_relplt; i++) {
 		Elf32_Rel *rel = i < mod->num_reldyn ? &mod->reldyn[i] : &mod->relplt[i - mod->num_reldyn];
@@ -495,12 +1655,8 @@ int so_resolve_with_dummy(so_module *mod, so_default_dynlib *default_dynlib, int
 		case R_ARM_JUMP_SLOT:
 		{
 			if (sym->st_shndx == SHN_UNDEF) {
-				for (int j = 0; j < size_default_dynlib / sizeof(so_default_dynlib); j++) {
-					if (strcmp(mod->dynstr + sym->st_name, default_dynlib[j].symbol) == 0) {
-						*ptr = &ret0;
-						break;
-					}
-				}
+				if (so_dynlib_lookup(default_dynlib, size_default_dynlib, mod->dynstr + sym->st_name))
+					*ptr = &ret0;
 			}
 
 			break;
@@ -520,70 +1676,416 @@ void so_initialize(so_module *mod) {
 	}
 }
 
-uint32_t so_hash(const uint8_t *name) {
-	uint64_t h = 0, g;
-	while (*name) {
-		h = (h << 4) + *name++;
-		if ((g = (h & 0xf0000000)) != 0)
-			h ^= g >> 24;
-		h &= 0x0fffffff;
+int so_relocate_resolve_all(so_default_dynlib *default_dynlib, int size_default_dynlib, int default_dynlib_only) {
+	SceUInt64 start = backend->time();
+	so_module **order;
+	int num_mods = so_topo_order(&order);
+	if (num_mods == 0) {
+		free(order);
+		return -1;
 	}
-	return h;
+
+	// Only modules something depends on can satisfy imports
+	for (int i = 0; i < num_mods; i++)
+		order[i]->visit = 1;
+	for (int i = 0; i < num_mods; i++) {
+		for (int j = 0; j < order[i]->num_needed; j++)
+			order[i]->needed[j]->visit = 2;
+	}
+	so_global_index_build(order, num_mods);
+
+	for (int i = 0; i < num_mods; i++)
+		so_relocate_resolve(order[i], default_dynlib, size_default_dynlib, default_dynlib_only);
+
+	debugPrintf("so_relocate_resolve_all: %d modules, %d indexed exports in %llu us\n", num_mods, global_index.num_syms, backend->time() - start);
+	free(order);
+	return 0;
 }
 
-static int so_symbol_index(so_module *mod, const char *symbol)
+void so_initialize_all(void) {
+	so_module **order;
+	int num_mods = so_topo_order(&order);
+	for (int i = 0; i < num_mods; i++)
+		so_initialize(order[i]);
+	free(order);
+}
+
+void so_symbol_key_init(so_symbol_key *key, const char *symbol) {
+	key->name = symbol;
+	key->hash = so_hash((const uint8_t *)symbol);
+	key->gnu_hash = so_gnu_hash((const uint8_t *)symbol);
+}
+
+static int so_symbol_index_key(so_module *mod, const so_symbol_key *key)
 {
+	if (mod->gnu_hash) {
+		uint32_t nbucket = mod->gnu_hash[0];
+		uint32_t symoffset = mod->gnu_hash[1];
+		uint32_t bloom_size = mod->gnu_hash[2];
+		uint32_t bloom_shift = mod->gnu_hash[3];
+		uint32_t *bloom = &mod->gnu_hash[4];
+		uint32_t *bucket = &bloom[bloom_size];
+		uint32_t *chain = &bucket[nbucket];
+
+		// Bloom filter rejects most misses without touching the buckets
+		uint32_t word = bloom[(key->gnu_hash / 32) % bloom_size];
+		uint32_t mask = (1u << (key->gnu_hash % 32)) | (1u << ((key->gnu_hash >> bloom_shift) % 32));
+		if ((word & mask) != mask)
+			return -1;
+
+		uint32_t i = bucket[key->gnu_hash % nbucket];
+		if (i < symoffset)
+			return -1;
+
+		for (;; i++) {
+			uint32_t h = chain[i - symoffset];
+			if ((h | 1) == (key->gnu_hash | 1) &&
+				mod->dynsym[i].st_shndx != SHN_UNDEF &&
+				mod->dynsym[i].st_info != SHN_UNDEF &&
+				strcmp(mod->dynstr + mod->dynsym[i].st_name, key->name) == 0)
+				return i;
+			if (h & 1)
+				return -1;
+		}
+	}
+
 	if (mod->hash) {
-		uint32_t hash = so_hash((const uint8_t *)symbol);
 		uint32_t nbucket = mod->hash[0];
 		uint32_t *bucket = &mod->hash[2];
 		uint32_t *chain = &bucket[nbucket];
-		for (int i = bucket[hash % nbucket]; i; i = chain[i]) {
+		for (int i = bucket[key->hash % nbucket]; i; i = chain[i]) {
 			if (mod->dynsym[i].st_shndx == SHN_UNDEF)
 				continue;
-			if (mod->dynsym[i].st_info != SHN_UNDEF && strcmp(mod->dynstr + mod->dynsym[i].st_name, symbol) == 0)
+			if (mod->dynsym[i].st_info != SHN_UNDEF && strcmp(mod->dynstr + mod->dynsym[i].st_name, key->name) == 0)
 				return i;
 		}
+
+		// The hash table covers the whole dynsym, a miss is final
+		return -1;
 	}
 
 	for (int i = 0; i < mod->num_dynsym; i++) {
 		if (mod->dynsym[i].st_shndx == SHN_UNDEF)
 			continue;
-		if (mod->dynsym[i].st_info != SHN_UNDEF && strcmp(mod->dynstr + mod->dynsym[i].st_name, symbol) == 0)
+		if (mod->dynsym[i].st_info != SHN_UNDEF && strcmp(mod->dynstr + mod->dynsym[i].st_name, key->name) == 0)
 			return i;
 	}
 
 	return -1;
 }
 
+static int so_symbol_index(so_module *mod, const char *symbol)
+{
+	so_symbol_key key;
+	so_symbol_key_init(&key, symbol);
+	return so_symbol_index_key(mod, &key);
+}
+
+uintptr_t so_symbol_key_lookup(so_module *mod, const so_symbol_key *key) {
+	int index = so_symbol_index_key(mod, key);
+	if (index == -1)
+		return NULL;
+
+	return mod->text_base + mod->dynsym[index].st_value;
+}
+
+typedef struct {
+	uint32_t bucket;
+	int idx;
+} so_batch_slot;
+
+static int so_batch_cmp(const void *a, const void *b) {
+	const so_batch_slot *sa = a, *sb = b;
+	if (sa->bucket != sb->bucket)
+		return sa->bucket < sb->bucket ? -1 : 1;
+	return sa->idx - sb->idx;
+}
+
+/*
+ * symbol_batch: resolves n pre-hashed keys in one sweep. Lookups are sorted by
+ * hash bucket so the bucket and chain arrays are walked front to back instead
+ * of being hit at random by every individual so_symbol call.
+*/
+int so_symbol_batch(so_module *mod, const so_symbol_key *keys, uintptr_t *addrs, int n) {
+	SceUInt64 start = backend->time();
+	so_batch_slot *order = malloc(n * sizeof(so_batch_slot));
+	int found = 0;
+
+	// No room to sort, the lookups just won't be grouped by bucket
+	if (!order) {
+		for (int i = 0; i < n; i++) {
+			addrs[i] = so_symbol_key_lookup(mod, &keys[i]);
+			if (addrs[i])
+				found++;
+		}
+		return found;
+	}
+
+	for (int i = 0; i < n; i++) {
+		order[i].idx = i;
+		if (mod->gnu_hash)
+			order[i].bucket = keys[i].gnu_hash % mod->gnu_hash[0];
+		else if (mod->hash)
+			order[i].bucket = keys[i].hash % mod->hash[0];
+		else
+			order[i].bucket = 0;
+	}
+	qsort(order, n, sizeof(so_batch_slot), so_batch_cmp);
+
+	for (int i = 0; i < n; i++) {
+		int idx = order[i].idx;
+		addrs[idx] = so_symbol_key_lookup(mod, &keys[idx]);
+		if (addrs[idx])
+			found++;
+	}
+
+	free(order);
+	debugPrintf("so_symbol_batch: %d of %d symbols found in %llu us\n", found, n, backend->time() - start);
+
+	return found;
+}
+
+/*
+ * island allocator: the patch arena under the text, the .text padding cave and
+ * any arenas grown later are regions with address-ordered free lists. Ranged
+ * allocations take the free spot nearest to dst, carved from whichever end of a
+ * free block is closer so blocks don't get split up.
+*/
+static int so_island_region_add(so_module *so, SceUID blockid, uintptr_t base, size_t size) {
+	if (so->num_regions == MAX_ISLAND_REGIONS || size == 0)
+		return -1;
+
+	so_island *blk = malloc(sizeof(so_island));
+	if (!blk)
+		return -1;
+	blk->addr = base;
+	blk->size = size;
+	blk->next = NULL;
+
+	so_island_region *r = &so->regions[so->num_regions++];
+	addr_index.dirty = 1;
+	r->blockid = blockid;
+	r->base = base;
+	r->size = size;
+	r->free = blk;
+	return 0;
+}
+
+static void so_island_region_free_all(so_module *so) {
+	for (int i = 0; i < so->num_regions; i++) {
+		so_island *blk = so->regions[i].free;
+		while (blk) {
+			so_island *next = blk->next;
+			free(blk);
+			blk = next;
+		}
+		// The first patch arena is released with the rest of the module blocks
+		if (i > 0 && so->regions[i].blockid > 0)
+			backend->free(so->regions[i].blockid);
+	}
+	so->num_regions = 0;
+}
+
+// New patch arena right under the lowest one we have, so it stays close to the text
+static int so_island_grow(so_module *so, size_t sz) {
+	uintptr_t lowest = so->patch_base;
+	for (int i = 0; i < so->num_regions; i++) {
+		if (so->regions[i].blockid > 0 && so->regions[i].base < lowest)
+			lowest = so->regions[i].base;
+	}
+
+	size_t size = ALIGN_MEM(sz, PATCH_SZ);
+	uintptr_t base;
+	SceUID blockid = backend->alloc("rx_block", size, lowest - size, 1, &base);
+	if (blockid < 0)
+		return -1;
+
+	if (so_island_region_add(so, blockid, base, size) < 0) {
+		backend->free(blockid);
+		return -1;
+	}
+
+	debugPrintf("island: grew patch arena by %u bytes (@0x%08X)\n", size, base);
+	return 0;
+}
+
+static uintptr_t so_island_pick(so_module *so, uintptr_t range, uintptr_t dst, size_t sz) {
+	so_island **best_link = NULL;
+	uintptr_t best_addr = 0;
+	uintptr_t best_dist = (uintptr_t)-1;
+
+	for (int i = 0; i < so->num_regions; i++) {
+		for (so_island **link = &so->regions[i].free; *link; link = &(*link)->next) {
+			so_island *blk = *link;
+			if (blk->size < sz)
+				continue;
+
+			if (!range) {
+				// Any spot will do, first fit keeps the patch arena filling up first
+				best_link = link;
+				best_addr = blk->addr;
+				goto found;
+			}
+
+			uintptr_t lo = blk->addr, hi = blk->addr + blk->size - sz;
+			uintptr_t dist_lo = lo > dst ? lo - dst : dst - lo;
+			uintptr_t dist_hi = hi > dst ? hi - dst : dst - hi;
+			uintptr_t addr = dist_lo <= dist_hi ? lo : hi;
+			uintptr_t dist = dist_lo <= dist_hi ? dist_lo : dist_hi;
+			if (dist <= range && dist < best_dist) {
+				best_link = link;
+				best_addr = addr;
+				best_dist = dist;
+			}
+		}
+	}
+
+	if (!best_link)
+		return 0;
+
+found:;
+	so_island *blk = *best_link;
+	if (best_addr == blk->addr)
+		blk->addr += sz;
+	blk->size -= sz;
+	if (blk->size == 0) {
+		*best_link = blk->next;
+		free(blk);
+	}
+
+	so->num_islands++;
+	so->island_bytes += sz;
+	return best_addr;
+}
+
 /*
- * alloc_arena: allocates space on either patch or cave arenas, 
+ * alloc_island: allocates space on the island regions, growing the patch arena when full
  * range: maximum range from allocation to dst (ignored if NULL)
  * dst: destination address
+ * max_regions: don't grow past this many regions
 */
-static uintptr_t so_alloc_arena(so_module *so, uintptr_t range, uintptr_t dst, size_t sz) {
-	// Is address in range?
-	#define inrange(lsr, gtr, range) \
-		(((uintptr_t)(range) == (uintptr_t)NULL) || ((uintptr_t)(range) >= ((uintptr_t)(gtr) - (uintptr_t)(lsr))))
-	// Space left on block
-	#define blkavail(type) (so->type##_size - (so->type##_head - so->type##_base))
-	
+static uintptr_t so_alloc_island(so_module *so, uintptr_t range, uintptr_t dst, size_t sz, int max_regions) {
 	// keep allocations 4-byte aligned for simplicity
 	sz = ALIGN_MEM(sz, 4);
 
-	if (sz <= (blkavail(patch)) && inrange(so->patch_base, dst, range)) {
-		so->patch_head += sz;
-		return (so->patch_head - sz);
-	} else if (sz <= (blkavail(cave)) && inrange(dst, so->cave_base, range)) {
-		so->cave_head += sz;
-		return (so->cave_head - sz);
+	uintptr_t addr = so_island_pick(so, range, dst, sz);
+	if (!addr && so->num_regions < max_regions && so_island_grow(so, sz) == 0)
+		addr = so_island_pick(so, range, dst, sz);
+
+	return addr;
+}
+
+static uintptr_t so_alloc_arena(so_module *so, uintptr_t range, uintptr_t dst, size_t sz) {
+	return so_alloc_island(so, range, dst, sz, MAX_ISLAND_REGIONS);
+}
+
+void so_free_arena(so_module *so, uintptr_t addr, size_t sz) {
+	sz = ALIGN_MEM(sz, 4);
+
+	for (int i = 0; i < so->num_regions; i++) {
+		so_island_region *r = &so->regions[i];
+		if (addr < r->base || addr >= r->base + r->size)
+			continue;
+
+		so_island *prev = NULL, *next = r->free;
+		while (next && next->addr < addr) {
+			prev = next;
+			next = next->next;
+		}
+
+		if (prev && prev->addr + prev->size == addr) {
+			prev->size += sz;
+			if (next && prev->addr + prev->size == next->addr) {
+				prev->size += next->size;
+				prev->next = next->next;
+				free(next);
+			}
+		} else if (next && addr + sz == next->addr) {
+			next->addr = addr;
+			next->size += sz;
+		} else {
+			so_island *blk = malloc(sizeof(so_island));
+			if (!blk)
+				return; // leaked, but still safe
+			blk->addr = addr;
+			blk->size = sz;
+			blk->next = next;
+			if (prev)
+				prev->next = blk;
+			else
+				r->free = blk;
+		}
+
+		so->num_islands--;
+		so->island_bytes -= sz;
+		return;
 	}
+}
 
-	return (uintptr_t)NULL;
+// Absolute jump to target placed within range of dst, for bodies that had to go further away
+static uintptr_t so_make_veneer(so_module *so, uintptr_t range, uintptr_t dst, uintptr_t target, int max_regions) {
+	uint32_t veneer[2] = {
+		0xe51ff004, // LDR PC, [PC, #-0x4]
+		target
+	};
+
+	uintptr_t addr = so_alloc_island(so, range, dst, sizeof(veneer), max_regions);
+	if (addr)
+		so_text_write(addr, veneer, sizeof(veneer));
+	return addr;
 }
 
-static void trampoline_ldm(so_module *mod, uint32_t *dst) {
+void so_arena_stats(so_module *so) {
+	size_t free_bytes = 0, largest = 0;
+	int fragments = 0;
+
+	for (int i = 0; i < so->num_regions; i++) {
+		for (so_island *blk = so->regions[i].free; blk; blk = blk->next) {
+			free_bytes += blk->size;
+			if (blk->size > largest)
+				largest = blk->size;
+			fragments++;
+		}
+	}
+
+	debugPrintf("island: %d regions, %d islands using %u bytes, %u bytes free in %d blocks (largest %u, %u%% fragmented)\n",
+		so->num_regions, so->num_islands, so->island_bytes, free_bytes, fragments, largest,
+		free_bytes ? (unsigned)(100 - (uint64_t)largest * 100 / free_bytes) : 0);
+}
+
+// Appends the jump back to funct, places it in an island and branches dst to it
+static int trampoline_install(so_module *mod, uint32_t *dst, uint32_t *funct, uint32_t *ptr, int max_regions) {
 	uint32_t trampoline[1];
+
+	*ptr++ = 0xe51ff004; // LDR PC, [PC, -0x4] ; jmp to [dst+0x4]
+	*ptr++ = dst+1; // .dword <...>	; [dst+0x4]
+
+	size_t trampoline_sz =	((uintptr_t)ptr - (uintptr_t)&funct[0]);
+	uintptr_t patch_addr = so_alloc_island(mod, B_RANGE, B_OFFSET(dst), trampoline_sz, max_regions);
+	uintptr_t entry = patch_addr;
+
+	// No room for the body within branch range, put it anywhere and reach it through a veneer
+	if (!patch_addr) {
+		patch_addr = so_alloc_island(mod, NULL, 0, trampoline_sz, max_regions);
+		if (patch_addr) {
+			entry = so_make_veneer(mod, B_RANGE, B_OFFSET(dst), patch_addr, max_regions);
+			if (!entry)
+				so_free_arena(mod, patch_addr, trampoline_sz);
+		}
+	}
+
+	if (!entry)
+		return -1;
+	
+	// Create sign extended relative address rel_addr
+	trampoline[0] = B(dst, entry).raw;
+
+	so_text_write(patch_addr, funct, trampoline_sz);
+	so_text_write((uintptr_t)dst, trampoline, sizeof(trampoline));
+	return 0;
+}
+
+static int trampoline_ldm(so_module *mod, uint32_t *dst, int max_regions) {
 	uint32_t funct[20] = {0xFAFAFAFA};
 	uint32_t *ptr = funct;
 
@@ -609,21 +2111,29 @@ static void trampoline_ldm(so_module *mod, uint32_t *dst) {
 		*ptr++ = stored;
 	}
 
-	*ptr++ = 0xe51ff004; // LDR PC, [PC, -0x4] ; jmp to [dst+0x4]
-	*ptr++ = dst+1; // .dword <...>	; [dst+0x4]
+	return trampoline_install(mod, dst, funct, ptr, max_regions);
+}
 
-	size_t trampoline_sz =	((uintptr_t)ptr - (uintptr_t)&funct[0]);
-	uintptr_t patch_addr = so_alloc_arena(mod, B_RANGE, B_OFFSET(dst), trampoline_sz);
+static int trampoline_ldrd(so_module *mod, uint32_t *dst, int max_regions) {
+	uint32_t funct[4];
+	uint32_t *ptr = funct;
 
-	if (!patch_addr) {
-		fatal_error("Failed to patch LDMIA at 0x%08X, unable to allocate space.\n", dst);
+	int rt = ((*dst) >> 12) & 0xF;
+	int rn = ((*dst) >> 16) & 0xF;
+	int imm = (((*dst) >> 4) & 0xF0) | ((*dst) & 0xF);
+	if (!((*dst) & (1 << 23)))
+		imm = -imm;
+
+	// Same base clobbering concern as LDM, load the base register last
+	if (rn == rt) {
+		*ptr++ = LDR_OFFS(rt + 1, rn, imm + 4).raw;
+		*ptr++ = LDR_OFFS(rt, rn, imm).raw;
+	} else {
+		*ptr++ = LDR_OFFS(rt, rn, imm).raw;
+		*ptr++ = LDR_OFFS(rt + 1, rn, imm + 4).raw;
 	}
-	
-	// Create sign extended relative address rel_addr
-	trampoline[0] = B(dst, patch_addr).raw;
 
-	kuKernelCpuUnrestrictedMemcpy((void*)patch_addr, funct, trampoline_sz);
-	kuKernelCpuUnrestrictedMemcpy(dst, trampoline, sizeof(trampoline));
+	return trampoline_install(mod, dst, funct, ptr, max_regions);
 }
 
 uintptr_t so_symbol(so_module *mod, const char *symbol) {
@@ -650,9 +2160,243 @@ void so_symbol_fix_ldmia(so_module *mod, const char *symbol) {
 		uint32_t inst = *(uint32_t*)(addr);
 		
 		//Is this an LDMIA instruction with a R0-R12 base register?
-		if (((inst & 0xFFF00000) == 0xE8900000) && (((inst >> 16) & 0xF) < 13) ) {
-			debugPrintf("Found possibly misaligned LDMIA on 0x%08X, trying to fix it... (instr: 0x%08X, to 0x%08X)\n", addr, *(uint32_t*)addr, mod->patch_head);
-			trampoline_ldm(mod, addr);
+		uintptr_t literal;
+		if (insn_unaligned_arm(inst, addr, &literal) == INSN_UNALIGNED_LDM) {
+			debugPrintf("Found possibly misaligned LDMIA on 0x%08X, trying to fix it... (instr: 0x%08X)\n", addr, *(uint32_t*)addr);
+			if (trampoline_ldm(mod, addr, MAX_ISLAND_REGIONS) < 0)
+				fatal_error("Failed to patch LDMIA at 0x%08X, unable to allocate space.\n", addr);
+		}
+	}
+}
+
+/*
+ * fix_unaligned: walks the whole .text once looking for accesses that need word
+ * alignment. Code is only decoded where its mode is known: between $a/$t mapping
+ * symbols when the module still has its .symtab, otherwise within the st_size of
+ * each exported function, whose mode comes from bit 0 of the symbol. Literal pool
+ * words are skipped. The patched offsets are cached per .so hash so later boots
+ * replay them without rescanning. Fixes never take the island regions hooks may
+ * still need, what doesn't fit in FIXUP_MAX_REGIONS is left unpatched.
+*/
+#define FIXUP_MAGIC 0x5846444c // 'LDFX'
+#define FIXUP_VERSION 2
+#define FIXUP_MAX_REGIONS (MAX_ISLAND_REGIONS / 2)
+
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint8_t key[SO_KEY_SIZE];
+	uint32_t count;
+} so_fixup_hdr;
+
+typedef struct {
+	uint32_t offset; // from text_base
+	uint32_t kind;
+} so_fixup;
+
+typedef struct {
+	so_fixup *list;
+	int count, max;
+	int other; // risky but left alone
+} so_fixup_scan;
+
+static int so_sym_addr_cmp(const void *a, const void *b) {
+	uint32_t va = (*(Elf32_Sym * const *)a)->st_value & ~1, vb = (*(Elf32_Sym * const *)b)->st_value & ~1;
+	return va < vb ? -1 : va > vb;
+}
+
+static void so_fixup_add(so_fixup_scan *scan, uint32_t offset, uint32_t kind) {
+	if (scan->count == scan->max) {
+		int max = scan->max ? scan->max * 2 : 64;
+		so_fixup *list = realloc(scan->list, max * sizeof(so_fixup));
+		if (!list)
+			return;
+		scan->list = list;
+		scan->max = max;
+	}
+	scan->list[scan->count].offset = offset;
+	scan->list[scan->count].kind = kind;
+	scan->count++;
+}
+
+// Scans [start, end) in one mode, pool marks one bit per word of the stretch
+static void so_scan_stretch(so_module *mod, so_fixup_scan *scan, uintptr_t start, uintptr_t end, int thumb) {
+	uintptr_t base = start & ~3;
+	size_t words = (end - base + 3) / 4;
+	uint32_t *pool = calloc((words + 31) / 32, sizeof(uint32_t));
+	if (!pool)
+		return;
+
+	#define IN_POOL(a) ((a) >= base && (a) < end && (pool[((a) - base) / 4 / 32] & (1u << (((a) - base) / 4 % 32))))
+
+	for (int pass = 0; pass < 2; pass++) {
+		for (uintptr_t addr = start; addr < end;) {
+			uintptr_t literal;
+			int kind;
+			size_t size = thumb ? INSN_THUMB_SIZE(*(uint16_t *)addr) : 4;
+
+			if (pass && IN_POOL(addr)) {
+				addr += thumb ? 2 : 4;
+				continue;
+			}
+			if (addr + size > end)
+				break;
+
+			if (thumb)
+				kind = insn_unaligned_thumb((const uint16_t *)addr, addr, &literal);
+			else
+				kind = insn_unaligned_arm(*(uint32_t *)addr, addr, &literal);
+
+			if (pass == 0) {
+				// Mark every pool word a literal load can touch, LDRD/VLDR read two
+				for (uintptr_t l = literal & ~3; literal && l < literal + 8; l += 4) {
+					if (l >= base && l < end)
+						pool[(l - base) / 4 / 32] |= 1u << ((l - base) / 4 % 32);
+				}
+			} else if (kind == INSN_UNALIGNED_LDM || kind == INSN_UNALIGNED_LDRD) {
+				so_fixup_add(scan, addr - mod->text_base, kind);
+			} else if (kind != INSN_ALIGNED) {
+				scan->other++;
+			}
+			addr += size;
+		}
+	}
+
+	#undef IN_POOL
+	free(pool);
+}
+
+// Clips [start, end) to .text before scanning it
+static void so_scan_range(so_module *mod, so_fixup_scan *scan, uintptr_t start, uintptr_t end, int thumb) {
+	uintptr_t code_end = mod->code_base + mod->code_size;
+
+	if (start < mod->code_base)
+		start = mod->code_base;
+	if (end > code_end)
+		end = code_end;
+	if (end > start)
+		so_scan_stretch(mod, scan, start, end, thumb);
+}
+
+static void so_scan_unaligned(so_module *mod, so_fixup_scan *scan) {
+	// Each mapping symbol holds until the next one, $d stretches are data
+	if (mod->mapping) {
+		for (int i = 0; i < mod->num_mapping; i++) {
+			uintptr_t start = mod->text_base + mod->mapping[i].offset;
+			uintptr_t end = (i + 1 < mod->num_mapping) ? mod->text_base + mod->mapping[i + 1].offset : mod->code_base + mod->code_size;
+			if (mod->mapping[i].kind != 'd')
+				so_scan_range(mod, scan, start, end, mod->mapping[i].kind == 't');
+		}
+		return;
+	}
+
+	Elf32_Sym **funcs = malloc(mod->num_dynsym * sizeof(Elf32_Sym *));
+	if (!funcs)
+		return;
+
+	int num_funcs = 0;
+	for (int i = 0; i < mod->num_dynsym; i++) {
+		Elf32_Sym *sym = &mod->dynsym[i];
+		if (ELF32_ST_TYPE(sym->st_info) == STT_FUNC && sym->st_shndx != SHN_UNDEF && sym->st_size)
+			funcs[num_funcs++] = sym;
+	}
+	qsort(funcs, num_funcs, sizeof(Elf32_Sym *), so_sym_addr_cmp);
+
+	// Only the function bodies, whatever sits between them could be either mode or data
+	for (int i = 0; i < num_funcs; i++) {
+		uintptr_t start = mod->text_base + (funcs[i]->st_value & ~1);
+		uintptr_t end = start + funcs[i]->st_size;
+		if (i + 1 < num_funcs && end > mod->text_base + (funcs[i + 1]->st_value & ~1))
+			end = mod->text_base + (funcs[i + 1]->st_value & ~1);
+		so_scan_range(mod, scan, start, end, funcs[i]->st_value & 1);
+	}
+
+	free(funcs);
+}
+
+// 0 if patched or skipped as invalid, -1 once the islands are full
+static int so_fixup_apply(so_module *mod, so_fixup *f) {
+	uint32_t *addr = (uint32_t *)(mod->text_base + f->offset);
+	uintptr_t literal;
+
+	// The key already pins the .so, this only guards against a corrupted cache
+	if (f->offset >= mod->text_size || insn_unaligned_arm(*addr, (uintptr_t)addr, &literal) != f->kind)
+		return 0;
+
+	if (f->kind == INSN_UNALIGNED_LDM)
+		return trampoline_ldm(mod, addr, FIXUP_MAX_REGIONS);
+	else
+		return trampoline_ldrd(mod, addr, FIXUP_MAX_REGIONS);
+}
+
+static int so_fixup_load(so_module *mod, const char *path, so_fixup_scan *scan) {
+	so_fixup_hdr hdr;
+
+	SceUID fd = sceIoOpen(path, SCE_O_RDONLY, 0);
+	if (fd < 0)
+		return fd;
+
+	int res = -1;
+	if (sceIoRead(fd, &hdr, sizeof(hdr)) == sizeof(hdr) &&
+		hdr.magic == FIXUP_MAGIC &&
+		hdr.version == FIXUP_VERSION &&
+		memcmp(hdr.key, mod->sha1, SO_KEY_SIZE) == 0) {
+		scan->list = malloc(hdr.count * sizeof(so_fixup) + 1);
+		if (scan->list && sceIoRead(fd, scan->list, hdr.count * sizeof(so_fixup)) == hdr.count * sizeof(so_fixup)) {
+			scan->count = scan->max = hdr.count;
+			res = 0;
 		}
 	}
+	sceIoClose(fd);
+
+	return res;
+}
+
+static void so_fixup_save(so_module *mod, const char *path, so_fixup_scan *scan) {
+	so_fixup_hdr hdr;
+	hdr.magic = FIXUP_MAGIC;
+	hdr.version = FIXUP_VERSION;
+	memcpy(hdr.key, mod->sha1, SO_KEY_SIZE);
+	hdr.count = scan->count;
+
+	SceUID fd = sceIoOpen(path, SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+	if (fd < 0)
+		return;
+
+	int ok = sceIoWrite(fd, &hdr, sizeof(hdr)) == sizeof(hdr) &&
+		sceIoWrite(fd, scan->list, scan->count * sizeof(so_fixup)) == scan->count * sizeof(so_fixup);
+	sceIoClose(fd);
+
+	// Never leave a truncated cache behind
+	if (!ok)
+		sceIoRemove(path);
+}
+
+int so_fix_unaligned(so_module *mod, const char *cache_path) {
+	SceUInt64 start = backend->time();
+	so_fixup_scan scan;
+	memset(&scan, 0, sizeof(scan));
+
+	int cached = so_fixup_load(mod, cache_path, &scan) == 0;
+	if (!cached) {
+		free(scan.list);
+		memset(&scan, 0, sizeof(scan));
+		if (mod->code_size)
+			so_scan_unaligned(mod, &scan);
+		so_fixup_save(mod, cache_path, &scan);
+	}
+
+	int applied = 0;
+	while (applied < scan.count && so_fixup_apply(mod, &scan.list[applied]) == 0)
+		applied++;
+	if (applied < scan.count)
+		debugPrintf("so_fix_unaligned: out of island space, %d sites left unpatched\n", scan.count - applied);
+
+	if (cached)
+		debugPrintf("so_fix_unaligned: %d cached fixes applied in %llu us\n", applied, backend->time() - start);
+	else
+		debugPrintf("so_fix_unaligned: %d fixed, %d left alone, scanned in %llu us\n", applied, scan.other, backend->time() - start);
+
+	free(scan.list);
+	return applied;
 }
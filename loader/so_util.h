@@ -2,25 +2,88 @@
 #define __SO_UTIL_H__
 
 #include "elf.h"
+#include "symtab.h"
 
 #define ALIGN_MEM(x, align) (((x) + ((align) - 1)) & ~((align) - 1))
 #define MAX_DATA_SEG 4
+#define MAX_ISLAND_REGIONS 8
+#define MAX_NEEDED 16
+#define SO_KEY_SIZE 20 // SHA1 digest
 
 typedef struct {
 	uintptr_t addr;
 	uintptr_t thumb_addr;
+	uintptr_t trampoline; // Relocated original prologue, 0 if it couldn't be built
 	uint32_t orig_instr[2];
 	uint32_t patch_instr[2];
 } so_hook;
 
+enum {
+  SO_STAT_ABS32,
+  SO_STAT_GLOB_DAT,
+  SO_STAT_JUMP_SLOT,
+  SO_STAT_TYPES
+};
+
+typedef struct {
+  int relative, abs32, glob_dat, jump_slot;
+  int imports, unresolved;
+  int bound[SO_STAT_TYPES], unbound[SO_STAT_TYPES]; // imports by relocation type
+  SceUInt64 time;
+} so_reloc_stats;
+
+enum {
+  SO_RANGE_TEXT,
+  SO_RANGE_DATA,
+  SO_RANGE_GOT,
+  SO_RANGE_ISLAND, // trampolines, veneers and thunks outside the text
+};
+
+// Address range owned by a loaded module
+typedef struct {
+  uintptr_t start, end;
+  struct so_module *mod;
+  int kind;
+} so_range;
+
+// Free block in an island region
+typedef struct so_island {
+  uintptr_t addr;
+  size_t size;
+  struct so_island *next;
+} so_island;
+
+typedef struct {
+  SceUID blockid; // 0 for the .text padding cave
+  uintptr_t base;
+  size_t size;
+  so_island *free; // address ordered
+} so_island_region;
+
+// ARM mapping symbol from .symtab ($a, $t or $d), marks where code changes mode
+typedef struct {
+  uint32_t offset; // from text_base
+  char kind; // 'a', 't' or 'd'
+} so_mapping_symbol;
+
 typedef struct so_module {
   struct so_module *next;
 
   SceUID patch_blockid, text_blockid, data_blockid[MAX_DATA_SEG];
-  uintptr_t patch_base, patch_head, cave_base, cave_head, text_base, data_base[MAX_DATA_SEG];
+  uintptr_t patch_base, cave_base, text_base, data_base[MAX_DATA_SEG];
   size_t patch_size, cave_size, text_size, data_size[MAX_DATA_SEG];
   int n_data;
 
+  uintptr_t code_base; // .text section, without the PLT and dynamic tables
+  size_t code_size;
+
+  so_mapping_symbol *mapping; // sorted, NULL for stripped modules
+  int num_mapping;
+
+  so_island_region regions[MAX_ISLAND_REGIONS];
+  int num_regions, num_islands;
+  size_t island_bytes;
+
   Elf32_Ehdr *ehdr;
   Elf32_Phdr *phdr;
   Elf32_Shdr *shdr;
@@ -32,6 +95,7 @@ typedef struct so_module {
 
   int (** init_array)(void);
   uint32_t *hash;
+  uint32_t *gnu_hash;
 
   int num_dynamic;
   int num_dynsym;
@@ -42,33 +106,103 @@ typedef struct so_module {
   char *soname;
   char *shstr;
   char *dynstr;
+
+  uint8_t sha1[SO_KEY_SIZE];
+  so_reloc_stats reloc_stats;
+
+  struct so_default_dynlib *dynlib;
+  int size_dynlib, dynlib_only;
+  int lazy_bind; // Bind JUMP_SLOT imports on first call instead of at resolve time
+  int num_lazy, num_lazy_bound;
+  int profile_imports; // Route JUMP_SLOT imports through call counting thunks
+
+  struct so_module *needed[MAX_NEEDED]; // DT_NEEDED entries that are loaded modules
+  int num_needed;
+  int visit; // topological sort mark
+
+  symtab syms; // function symbols, built with the address index
 } so_module;
 
+// Symbol name with its hashes computed once, for repeated lookups across modules
 typedef struct {
+  const char *name;
+  uint32_t hash; // SysV .hash
+  uint32_t gnu_hash; // .gnu.hash
+} so_symbol_key;
+
+typedef struct so_default_dynlib {
   char *symbol;
   uintptr_t func;
+  uint32_t hash; // so_gnu_hash(symbol) if precomputed, 0 to have it hashed when needed
 } so_default_dynlib;
 
+/*
+ * SO_GNU_HASH: so_gnu_hash of a string literal (up to 64 chars) folded at compile time.
+ * The literal is hashed as if NUL padded to 64 chars, then the padding is divided back
+ * out by multiplying with the inverse of 33 mod 2^32 once per padding char.
+ * Longer literals give 0, so lookups must treat a 0 hash as "compare the name".
+*/
+#define SO_HASH_CHAR(s, i) ((uint32_t)(uint8_t)(s)[(i) < sizeof(s) ? (i) : 0] * ((i) < sizeof(s) - 1))
+#define SO_HASH_4(s, i, h) (((((h) * 33 + SO_HASH_CHAR(s, i)) * 33 + SO_HASH_CHAR(s, i + 1)) * 33 + SO_HASH_CHAR(s, i + 2)) * 33 + SO_HASH_CHAR(s, i + 3))
+#define SO_HASH_16(s, i, h) SO_HASH_4(s, i + 12, SO_HASH_4(s, i + 8, SO_HASH_4(s, i + 4, SO_HASH_4(s, i, h))))
+#define SO_HASH_64(s) SO_HASH_16(s, 48, SO_HASH_16(s, 32, SO_HASH_16(s, 16, SO_HASH_16(s, 0, 5381u))))
+#define SO_HASH_UNPAD(k) \
+  (((k) & 1 ? 0x3e0f83e1u : 1u) * ((k) & 2 ? 0xb44e0bc1u : 1u) * ((k) & 4 ? 0x92262781u : 1u) * \
+   ((k) & 8 ? 0xe4648f01u : 1u) * ((k) & 16 ? 0xd0aa1e01u : 1u) * ((k) & 32 ? 0x7cd83c01u : 1u) * ((k) & 64 ? 0x47c07801u : 1u))
+#define SO_GNU_HASH(s) (sizeof(s) - 1 <= 64 ? SO_HASH_64(s) * SO_HASH_UNPAD(64 - (sizeof(s) - 1)) : 0)
+
 so_hook hook_thumb(uintptr_t addr, uintptr_t dst);
 so_hook hook_arm(uintptr_t addr, uintptr_t dst);
 so_hook hook_addr(uintptr_t addr, uintptr_t dst);
+void so_hook_begin(void);
+int so_hook_commit(void);
+void so_hook_revert(void);
 
 void so_flush_caches(so_module *mod);
+void so_free_arena(so_module *so, uintptr_t addr, size_t sz);
+void so_arena_stats(so_module *so);
 int so_file_load(so_module *mod, const char *filename, uintptr_t load_addr);
 int so_mem_load(so_module *mod, void * buffer, size_t so_size, uintptr_t load_addr);
 int so_relocate(so_module *mod);
 int so_resolve(so_module *mod, so_default_dynlib *default_dynlib, int size_default_dynlib, int default_dynlib_only);
+int so_relocate_resolve(so_module *mod, so_default_dynlib *default_dynlib, int size_default_dynlib, int default_dynlib_only);
 int so_resolve_with_dummy(so_module *mod, so_default_dynlib *default_dynlib, int size_default_dynlib, int default_dynlib_only);
+void so_lazy_report(so_module *mod);
+int so_import_profile_dump(so_module *mod, const char *path);
+
+// Latest counted import call, return address in the low word and default_dynlib
+// index in the high one, stored in a single exclusive write. 0 once consumed.
+extern volatile uint64_t so_last_import;
+void so_prelink_key(so_module *mod, so_default_dynlib *default_dynlib, int size_default_dynlib, uint8_t *key);
+int so_prelink_save(so_module *mod, const char *path, const uint8_t *key);
+int so_prelink_load(so_module *mod, const char *path, const uint8_t *key);
 void so_symbol_fix_ldmia(so_module *mod, const char *symbol);
+int so_fix_unaligned(so_module *mod, const char *cache_path);
 void so_initialize(so_module *mod);
+int so_relocate_resolve_all(so_default_dynlib *default_dynlib, int size_default_dynlib, int default_dynlib_only);
+void so_initialize_all(void);
+int so_addr_index_build(void);
+const so_range *so_addr_range(uintptr_t addr);
+const symtab_entry *so_addr_symbol(uintptr_t addr, so_module **mod);
 uintptr_t so_symbol(so_module *mod, const char *symbol);
+uint32_t so_hash(const uint8_t *name);
+uint32_t so_gnu_hash(const uint8_t *name);
+void so_symbol_key_init(so_symbol_key *key, const char *symbol);
+uintptr_t so_symbol_key_lookup(so_module *mod, const so_symbol_key *key);
+int so_symbol_batch(so_module *mod, const so_symbol_key *keys, uintptr_t *addrs, int n);
 
+// Calls the original function through its trampoline, falling back to unpatching if there's none
 #define SO_CONTINUE(type, h, ...) ({ \
-  kuKernelCpuUnrestrictedMemcpy((void *)h.addr, h.orig_instr, sizeof(h.orig_instr)); \
-  kuKernelFlushCaches((void *)h.addr, sizeof(h.orig_instr)); \
-  type r = h.thumb_addr ? ((type(*)())h.thumb_addr)(__VA_ARGS__) : ((type(*)())h.addr)(__VA_ARGS__); \
-  kuKernelCpuUnrestrictedMemcpy((void *)h.addr, h.patch_instr, sizeof(h.patch_instr)); \
-  kuKernelFlushCaches((void *)h.addr, sizeof(h.patch_instr)); \
+  type r; \
+  if (h.trampoline) { \
+    r = ((type(*)())h.trampoline)(__VA_ARGS__); \
+  } else { \
+    kuKernelCpuUnrestrictedMemcpy((void *)h.addr, h.orig_instr, sizeof(h.orig_instr)); \
+    kuKernelFlushCaches((void *)h.addr, sizeof(h.orig_instr)); \
+    r = h.thumb_addr ? ((type(*)())h.thumb_addr)(__VA_ARGS__) : ((type(*)())h.addr)(__VA_ARGS__); \
+    kuKernelCpuUnrestrictedMemcpy((void *)h.addr, h.patch_instr, sizeof(h.patch_instr)); \
+    kuKernelFlushCaches((void *)h.addr, sizeof(h.patch_instr)); \
+  } \
   r; \
 })
 
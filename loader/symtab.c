@@ -0,0 +1,74 @@
+/* symtab.c -- address to function name lookups over a module's dynsym
+ *
+ * This software may be modified and distributed under the terms
+ * of the MIT license.	See the LICENSE file for details.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "symtab.h"
+
+static int symtab_cmp(const void *a, const void *b) {
+	const symtab_entry *ea = a, *eb = b;
+	if (ea->addr != eb->addr)
+		return ea->addr < eb->addr ? -1 : 1;
+	// Aliases: keep the sized one first so lookups report a real extent
+	return (int)(eb->size > 0) - (int)(ea->size > 0);
+}
+
+int symtab_build(symtab *t, const Elf32_Sym *syms, int num_syms, const char *strtab, uintptr_t base) {
+	memset(t, 0, sizeof(symtab));
+	t->entries = malloc(num_syms * sizeof(symtab_entry) + 1);
+	if (!t->entries)
+		return -1;
+
+	for (int i = 0; i < num_syms; i++) {
+		if (ELF32_ST_TYPE(syms[i].st_info) != STT_FUNC || syms[i].st_shndx == SHN_UNDEF)
+			continue;
+		symtab_entry *e = &t->entries[t->num_entries++];
+		e->addr = base + (syms[i].st_value & ~1);
+		e->size = syms[i].st_size;
+		e->name = strtab + syms[i].st_name;
+	}
+	qsort(t->entries, t->num_entries, sizeof(symtab_entry), symtab_cmp);
+
+	// Drop aliases, the first one at an address wins
+	int n = 0;
+	for (int i = 0; i < t->num_entries; i++) {
+		if (n == 0 || t->entries[n - 1].addr != t->entries[i].addr)
+			t->entries[n++] = t->entries[i];
+	}
+	t->num_entries = n;
+
+	return 0;
+}
+
+// Closest function at or below addr; unsized symbols extend up to the next one
+const symtab_entry *symtab_lookup(const symtab *t, uintptr_t addr) {
+	int lo = 0, hi = t->num_entries - 1, found = -1;
+	addr &= ~1;
+
+	while (lo <= hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (t->entries[mid].addr <= addr) {
+			found = mid;
+			lo = mid + 1;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	if (found < 0)
+		return NULL;
+
+	const symtab_entry *e = &t->entries[found];
+	if (e->size && addr >= e->addr + e->size)
+		return NULL;
+	return e;
+}
+
+void symtab_free(symtab *t) {
+	free(t->entries);
+	memset(t, 0, sizeof(symtab));
+}
@@ -0,0 +1,24 @@
+#ifndef __SYMTAB_H__
+#define __SYMTAB_H__
+
+#include <stdint.h>
+
+#include "elf.h"
+
+// Address sorted view of a dynsym, to map code addresses back to function names
+typedef struct {
+  uintptr_t addr; // without the Thumb bit
+  uint32_t size;
+  const char *name;
+} symtab_entry;
+
+typedef struct {
+  symtab_entry *entries;
+  int num_entries;
+} symtab;
+
+int symtab_build(symtab *t, const Elf32_Sym *syms, int num_syms, const char *strtab, uintptr_t base);
+const symtab_entry *symtab_lookup(const symtab *t, uintptr_t addr);
+void symtab_free(symtab *t);
+
+#endif